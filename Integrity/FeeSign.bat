@@ -0,0 +1,16 @@
+::file     FeeSign.bat - signature of flash controller for FEE_SIGN firmware
+::brief    batch script for windows used to conversion of *.hex file for ADuc rf101,
+::         expected signature of Sign command (FeeSign) is written instead of CRC
+::
+::
+::version	  initial version
+::date        17.10.2026(DD.MM.YYYY)
+::note        FeeSignHex.exe is compiled by tests\FeeSignTest\Makefile (MinGW)
+
+:: %1 mean first input argument, in this case path to *.hex file
+
+::conversion of *.hex file to other intel version of *.hex file
+Integrity\srec_cat.exe %1 -intel -o %1
+
+::filling of empty place in memory with 0xFF, signature of pages 0..255 at last 4 places in memory
+Integrity\FeeSignHex.exe %1 %1
@@ -0,0 +1,83 @@
+/**
+ *****************************************************************************
+   @file     FeeSignHex.c
+   @brief    host tool writing expected signature of flash controller to .hex
+             file of firmware, firmware with FEE_SIGN 1 is checking it by
+             Sign command (FeeSign()) instead of CRC
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    image is filled by 0xFF to 0x20000, signature of pages 0..255
+            (feesign.c) is written to 0x1FFFC, 0x1FFFF is 0
+   @note    compiled by tests/FeeSignTest/Makefile, called by FeeSign.bat
+   @code
+        FeeSignHex output\Radio.hex                 // signed in place
+        FeeSignHex output\Radio.hex signed.hex
+        FeeSignHex -c signed.hex                    // exit code 1 if signature is wrong
+   @endcode
+**/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "feesign.h"
+#include "ihex.h"
+
+/** @brief user FLASH of ADuCRF101, 256 pages **/
+#define FLASH_SIZE      0x20000
+
+static unsigned char image[FLASH_SIZE];
+
+static void usage(const char* name)
+{
+  printf("usage: %s [-c] input.hex [output.hex]\n"
+         "  signature of flash controller (FeeSign) is written to 0x%X, output is input if missing\n"
+         "  -c only check signature of input, exit code 1 if it is wrong\n",
+         name, FEE_SIGN_OFFSET(FLASH_SIZE - 1));
+}
+
+int main(int argc, char* argv[])
+{
+  const char *input = NULL, *output = NULL;
+  unsigned long signature, stored;
+  int check = 0, i;
+
+  for (i = 1; i < argc; i++){
+    if (strcmp(argv[i], "-c") == 0)
+      check = 1;
+    else if (strcmp(argv[i], "-h") == 0){
+      usage(argv[0]);
+      return 0;
+    }
+    else if (input == NULL)
+      input = argv[i];
+    else if (output == NULL)
+      output = argv[i];
+    else{
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (input == NULL){
+    usage(argv[0]);
+    return 2;
+  }
+  if (ihexRead(input, image, FLASH_SIZE) < 0)
+    return 2;
+
+  if (check){
+    signature = feeSignature(image, 0, FLASH_SIZE - 1);
+    i = FEE_SIGN_OFFSET(FLASH_SIZE - 1);
+    stored = (unsigned long)image[i] | (unsigned long)image[i + 1] << 8
+             | (unsigned long)image[i + 2] << 16 | (unsigned long)image[i + 3] << 24;
+    printf("signature 0x%06lX, stored 0x%08lX %s\n", signature, stored, signature == stored ? "ok" : "WRONG");
+    return signature == stored ? 0 : 1;
+  }
+
+  signature = feeSignStore(image, 0, FLASH_SIZE - 1);
+  if (ihexWrite(output ? output : input, image, FLASH_SIZE) != 0)
+    return 2;
+  printf("signature 0x%06lX written to 0x%X of %s\n", signature, FEE_SIGN_OFFSET(FLASH_SIZE - 1),
+         output ? output : input);
+  return 0;
+}
@@ -27,6 +27,7 @@
 #if (REFLECT_DATA == TRUE)
 #undef  REFLECT_DATA
 #define REFLECT_DATA(X)			((unsigned char) reflect((X), 8))
+#define REFLECT_USED
 #else
 #undef  REFLECT_DATA
 #define REFLECT_DATA(X)			(X)
@@ -35,12 +36,14 @@
 #if (REFLECT_REMAINDER == TRUE)
 #undef  REFLECT_REMAINDER
 #define REFLECT_REMAINDER(X)	((crc) reflect((X), WIDTH))
+#define REFLECT_USED
 #else
 #undef  REFLECT_REMAINDER
 #define REFLECT_REMAINDER(X)	(X)
 #endif
 
 
+#ifdef REFLECT_USED
 /*********************************************************************
  *
  * Function:    reflect()
@@ -78,6 +81,7 @@ reflect(unsigned long datat, unsigned char nBits)
 	return (reflection);
 
 }	/* reflect() */
+#endif
 
 
 /*********************************************************************
@@ -136,80 +140,111 @@ crcSlow(unsigned char const message[], int nBytes)
 }   /* crcSlow() */
 
 
-crc  crcTable[256];
+/*
+ * The partial CRC lookup table is computed by the compiler from the
+ * parameters of the selected standard, so it is constant in the ROM.
+ * CRC_BIT() is one bit of the modulo-2 division.  The division is
+ * linear, so the remainder of each dividend is the XOR of remainders
+ * CRC_B0..CRC_B7 of its set bits, CRC_B0 is the remainder of 0x01.
+ */
+#define CRC_TOPBIT		((crc) 1 << (WIDTH - 1))
+#define CRC_BIT(X)		((crc) (((X) << 1) ^ (((X) & CRC_TOPBIT) ? POLYNOMIAL : 0)))
+
+#define CRC_B0			((crc) POLYNOMIAL)
+#define CRC_B1			CRC_BIT(CRC_B0)
+#define CRC_B2			CRC_BIT(CRC_B1)
+#define CRC_B3			CRC_BIT(CRC_B2)
+#define CRC_B4			CRC_BIT(CRC_B3)
+#define CRC_B5			CRC_BIT(CRC_B4)
+#define CRC_B6			CRC_BIT(CRC_B5)
+#define CRC_B7			CRC_BIT(CRC_B6)
+
+#define CRC_ENTRY(D)	((crc) (((D) & 0x01 ? CRC_B0 : 0) ^ ((D) & 0x02 ? CRC_B1 : 0) ^ \
+								((D) & 0x04 ? CRC_B2 : 0) ^ ((D) & 0x08 ? CRC_B3 : 0) ^ \
+								((D) & 0x10 ? CRC_B4 : 0) ^ ((D) & 0x20 ? CRC_B5 : 0) ^ \
+								((D) & 0x40 ? CRC_B6 : 0) ^ ((D) & 0x80 ? CRC_B7 : 0)))
+#define CRC_ROW(H)		CRC_ENTRY((H) * 16 + 0),  CRC_ENTRY((H) * 16 + 1),  \
+						CRC_ENTRY((H) * 16 + 2),  CRC_ENTRY((H) * 16 + 3),  \
+						CRC_ENTRY((H) * 16 + 4),  CRC_ENTRY((H) * 16 + 5),  \
+						CRC_ENTRY((H) * 16 + 6),  CRC_ENTRY((H) * 16 + 7),  \
+						CRC_ENTRY((H) * 16 + 8),  CRC_ENTRY((H) * 16 + 9),  \
+						CRC_ENTRY((H) * 16 + 10), CRC_ENTRY((H) * 16 + 11), \
+						CRC_ENTRY((H) * 16 + 12), CRC_ENTRY((H) * 16 + 13), \
+						CRC_ENTRY((H) * 16 + 14), CRC_ENTRY((H) * 16 + 15)
+
+const crc  crcTable[256] =
+{
+    CRC_ROW(0),  CRC_ROW(1),  CRC_ROW(2),  CRC_ROW(3),
+    CRC_ROW(4),  CRC_ROW(5),  CRC_ROW(6),  CRC_ROW(7),
+    CRC_ROW(8),  CRC_ROW(9),  CRC_ROW(10), CRC_ROW(11),
+    CRC_ROW(12), CRC_ROW(13), CRC_ROW(14), CRC_ROW(15)
+};
 
 
 /*********************************************************************
  *
- * Function:    crcInit()
+ * Function:    crcFast()
  * 
- * Description: Populate the partial CRC lookup table.
+ * Description: Compute the CRC of a given message.
  *
- * Notes:		This function must be rerun any time the CRC standard
- *				is changed.  If desired, it can be run "offline" and
- *				the table results stored in an embedded system's ROM.
+ * Notes:		The table crcTable is constant, no initialization.
  *
- * Returns:		None defined.
+ * Returns:		The CRC of the message.
  *
  *********************************************************************/
-void
-crcInit(void)
+crc
+crcFast(unsigned char const message[], int nBytes)
 {
-    crc			   remainder;
-	int			   dividend;
-	unsigned char  bitt;
+    crc	           remainder = INITIAL_REMAINDER;
+    unsigned char  datat;
+	int            byte;
 
 
     /*
-     * Compute the remainder of each possible dividend.
+     * Divide the message by the polynomial, a byte at a time.
      */
-    for (dividend = 0; dividend < 256; ++dividend)
+    for (byte = 0; byte < nBytes; ++byte)
     {
-        /*
-         * Start with the dividend followed by zeros.
-         */
-        remainder = dividend << (WIDTH - 8);
+        datat = REFLECT_DATA(message[byte]) ^ (remainder >> (WIDTH - 8));
+  		remainder = crcTable[datat] ^ (remainder << 8);
+    }
 
-        /*
-         * Perform modulo-2 division, a bit at a time.
-         */
-        for (bitt = 8; bitt > 0; --bitt)
-        {
-            /*
-             * Try to divide the current data bit.
-             */			
-            if (remainder & TOPBIT)
-            {
-                remainder = (remainder << 1) ^ POLYNOMIAL;
-            }
-            else
-            {
-                remainder = (remainder << 1);
-            }
-        }
+    /*
+     * The final remainder is the CRC.
+     */
+    return (REFLECT_REMAINDER(remainder) ^ FINAL_XOR_VALUE);
 
-        /*
-         * Store the result into the table.
-         */
-        crcTable[dividend] = remainder;
-    }
+}   /* crcFast() */
 
-}   /* crcInit() */
+
+#if defined(CRC_CCITT)
+
+/*
+ * Remainders of the 16 nibbles followed by zeros, constant so it stays
+ * in the flash (32 bytes instead of 512 bytes of crcTable).
+ */
+static const crc  crcNibbleTable[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
 
 
 /*********************************************************************
  *
- * Function:    crcFast()
+ * Function:    crcNibble()
  * 
  * Description: Compute the CRC of a given message.
  *
- * Notes:		crcInit() must be called first.
+ * Notes:		Same result as crcSlow() and crcFast(), a nibble at a
+ *				time with the constant crcNibbleTable.  The table is
+ *				only for CRC_CCITT, the standard without reflection.
  *
  * Returns:		The CRC of the message.
  *
  *********************************************************************/
 crc
-crcFast(unsigned char const message[], int nBytes)
+crcNibble(unsigned char const message[], int nBytes)
 {
     crc	           remainder = INITIAL_REMAINDER;
     unsigned char  datat;
@@ -217,17 +252,20 @@ crcFast(unsigned char const message[], int nBytes)
 
 
     /*
-     * Divide the message by the polynomial, a byte at a time.
+     * Divide the message by the polynomial, a nibble at a time.
      */
     for (byte = 0; byte < nBytes; ++byte)
     {
-        datat = REFLECT_DATA(message[byte]) ^ (remainder >> (WIDTH - 8));
-  		remainder = crcTable[datat] ^ (remainder << 8);
+        datat = message[byte];
+        remainder = crcNibbleTable[(remainder >> (WIDTH - 4)) ^ (datat >> 4)] ^ (remainder << 4);
+        remainder = crcNibbleTable[(remainder >> (WIDTH - 4)) ^ (datat & 0x0F)] ^ (remainder << 4);
     }
 
     /*
      * The final remainder is the CRC.
      */
-    return (REFLECT_REMAINDER(remainder) ^ FINAL_XOR_VALUE);
+    return (remainder ^ FINAL_XOR_VALUE);
 
-}   /* crcFast() */
+}   /* crcNibble() */
+
+#endif
@@ -22,9 +22,12 @@
 #endif
 
 /*
- * Select the CRC standard from the list that follows.
+ * Select the CRC standard from the list that follows, CRC_CCITT if
+ * none is defined by the compiler (tests/CrcTest builds all of them).
  */
+#if !defined(CRC_CCITT) && !defined(CRC16) && !defined(CRC32)
 #define CRC_CCITT
+#endif
 
 
 #if defined(CRC_CCITT)
@@ -53,7 +56,7 @@ typedef unsigned short  crc;
 
 #elif defined(CRC32)
 
-typedef unsigned long  crc;
+typedef unsigned int  crc;		/* 32 bits also on 64-bit hosts */
 
 #define CRC_NAME			"CRC-32"
 #define POLYNOMIAL			0x04C11DB7
@@ -70,9 +73,20 @@ typedef unsigned long  crc;
 #endif
 
 
-extern void  crcInit(void);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const crc  crcTable[256];
 extern crc   crcSlow(unsigned char const message[], int nBytes);
 extern crc   crcFast(unsigned char const message[], int nBytes);
+#if defined(CRC_CCITT)
+extern crc   crcNibble(unsigned char const message[], int nBytes);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
 
 
 #endif /* _crc_h */
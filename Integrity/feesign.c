@@ -0,0 +1,52 @@
+#include "feesign.h"
+
+/**
+   @fn     static unsigned long feeWord(const unsigned char image[], unsigned long addr)
+   @brief  32 bit word of FLASH, Cortex-M3 is little endian
+**/
+static unsigned long feeWord(const unsigned char image[], unsigned long addr)
+{
+  return (unsigned long)image[addr] | (unsigned long)image[addr + 1] << 8
+         | (unsigned long)image[addr + 2] << 16 | (unsigned long)image[addr + 3] << 24;
+}
+
+unsigned long feeSignWord(unsigned long signature, unsigned long word)
+{
+  int bit;
+
+  for (bit = 31; bit >= 0; bit--){
+    if (((signature >> 23) ^ (word >> bit)) & 1)
+      signature = ((signature << 1) ^ FEE_SIGN_POLYNOMIAL) & FEE_SIGN_MASK;
+    else
+      signature = (signature << 1) & FEE_SIGN_MASK;
+  }
+  return signature;
+}
+
+unsigned long feeSignature(const unsigned char image[], unsigned long startAddr, unsigned long endAddr)
+{
+  unsigned long signature = FEE_SIGN_SEED;
+  unsigned long addr = startAddr & ~(unsigned long)(FEE_PAGE_SIZE - 1);
+  unsigned long end = FEE_SIGN_OFFSET(endAddr);
+
+  for ( ; addr < end; addr += 4)
+    signature = feeSignWord(signature, feeWord(image, addr));
+  return signature;
+}
+
+unsigned long feeSignStore(unsigned char image[], unsigned long startAddr, unsigned long endAddr)
+{
+  unsigned long signature = feeSignature(image, startAddr, endAddr);
+  unsigned long addr = FEE_SIGN_OFFSET(endAddr);
+
+  image[addr] = (unsigned char)signature;
+  image[addr + 1] = (unsigned char)(signature >> 8);
+  image[addr + 2] = (unsigned char)(signature >> 16);
+  image[addr + 3] = 0;
+  return signature;
+}
+
+int feeSignCheck(const unsigned char image[], unsigned long startAddr, unsigned long endAddr)
+{
+  return feeSignature(image, startAddr, endAddr) == feeWord(image, FEE_SIGN_OFFSET(endAddr));
+}
@@ -0,0 +1,81 @@
+/**
+ *****************************************************************************
+   @file     feesign.h
+   @brief    host model of signature of flash controller of ADuCRF101
+             (FeeSign() and FeeSig() of FeeLib)
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    signature is 24 bit CRC of polynomial x^24 + x^23 + x^6 + x^5 + x + 1
+            with seed 0xFFFFFF, 32 bit words of block are taken from lowest
+            address, each word (little endian in flash) from its MSB
+   @note    last 4 bytes of last page of block are reserved for expected
+            signature, they are not signed, Sign command ends with
+            FEESTA_CMDRES_VERIFYERR if signature differs from them
+   @note    used by FeeSignHex (signature of .hex file, FeeSign.bat),
+            tests/FirmwareSim (FeeSign() of simulated FLASH) and tests/FeeSignTest,
+            firmware is using controller (FEE_SIGN in settings.h)
+   @note    model is written by hardware reference of flash controller, value
+            printed by firmware with wrong signature (FeeSig()) can be compared
+            with FeeSignHex output on board
+   @code
+        feeSignStore(image, 0, 0x1FFFF);      // FeeSignHex
+        if (!feeSignCheck(image, 0, 0x1FFFF)) // Sign command of controller
+          printf("VERIFYERR");
+   @endcode
+**/
+#ifndef _feesign_h
+#define _feesign_h
+
+/** @brief one page of FLASH, Sign command is working with whole pages **/
+#define FEE_PAGE_SIZE           0x200
+/** @brief x^24 + x^23 + x^6 + x^5 + x + 1 without x^24 **/
+#define FEE_SIGN_POLYNOMIAL     0x800063UL
+#define FEE_SIGN_SEED           0xFFFFFFUL
+#define FEE_SIGN_MASK           0xFFFFFFUL
+/** @brief offset of expected signature in block of pages endAddr belongs to **/
+#define FEE_SIGN_OFFSET(endAddr) (((endAddr) | (FEE_PAGE_SIZE - 1)) - 3)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+   @fn     unsigned long feeSignWord(unsigned long signature, unsigned long word)
+   @brief  signature after one word of FLASH
+   @param  unsigned long signature : FEE_SIGN_SEED or result of previous word
+   @param  unsigned long word : 32 bit word, MSB is first
+   @return unsigned long - 24 bit signature
+**/
+unsigned long feeSignWord(unsigned long signature, unsigned long word);
+
+/**
+   @fn     unsigned long feeSignature(const unsigned char image[], unsigned long startAddr, unsigned long endAddr)
+   @brief  signature of pages like FeeSign(startAddr, endAddr) and FeeSig()
+   @param  const unsigned char image[] : FLASH from address 0
+   @param  unsigned long startAddr : address in first page (9 LSBs are ignored)
+   @param  unsigned long endAddr : address in last page (9 LSBs are ignored)
+   @return unsigned long - 24 bit signature, without last 4 bytes of last page
+**/
+unsigned long feeSignature(const unsigned char image[], unsigned long startAddr, unsigned long endAddr);
+
+/**
+   @fn     unsigned long feeSignStore(unsigned char image[], unsigned long startAddr, unsigned long endAddr)
+   @brief  signature of pages is written to last 4 bytes of last page (little endian)
+   @return unsigned long - 24 bit signature
+**/
+unsigned long feeSignStore(unsigned char image[], unsigned long startAddr, unsigned long endAddr);
+
+/**
+   @fn     int feeSignCheck(const unsigned char image[], unsigned long startAddr, unsigned long endAddr)
+   @brief  comparison of Sign command with last 4 bytes of last page
+   @return int - 1 if signature is the same, 0 if controller ends with VERIFYERR
+**/
+int feeSignCheck(const unsigned char image[], unsigned long startAddr, unsigned long endAddr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _feesign_h */
@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <string.h>
+#include "ihex.h"
+
+#define IHEX_LINE       600     /* 255 data bytes are 510 chars */
+#define IHEX_DATA_LEN   16
+
+/**
+   @fn     static int ihexByte(const char* text)
+   @brief  value of 2 hexadecimal chars, -1 if they are not hexadecimal
+**/
+static int ihexByte(const char* text)
+{
+  int value = 0, i;
+
+  for (i = 0; i < 2; i++){
+    value <<= 4;
+    if (text[i] >= '0' && text[i] <= '9')
+      value |= text[i] - '0';
+    else if (text[i] >= 'A' && text[i] <= 'F')
+      value |= text[i] - 'A' + 10;
+    else if (text[i] >= 'a' && text[i] <= 'f')
+      value |= text[i] - 'a' + 10;
+    else
+      return -1;
+  }
+  return value;
+}
+
+long ihexRead(const char* path, unsigned char image[], unsigned long size)
+{
+  char line[IHEX_LINE];
+  unsigned char record[IHEX_LINE / 2];
+  unsigned long base = 0, addr;
+  long bytes = 0;
+  int len, value, i, lineNumber = 0, sum;
+  FILE* file;
+
+  if ((file = fopen(path, "r")) == NULL){
+    printf("can not open %s\n", path);
+    return -1;
+  }
+  memset(image, 0xFF, size);
+  while (fgets(line, sizeof(line), file) != NULL){
+    lineNumber++;
+    len = strcspn(line, "\r\n");
+    if (len == 0)
+      continue;
+    if (line[0] != ':' || len < 11 || (len - 1) % 2 != 0){
+      printf("%s:%d is not Intel HEX record\n", path, lineNumber);
+      fclose(file);
+      return -1;
+    }
+    for (i = 0, sum = 0; i < (len - 1) / 2; i++){
+      if ((value = ihexByte(&line[1 + 2 * i])) < 0){
+        printf("%s:%d is not hexadecimal\n", path, lineNumber);
+        fclose(file);
+        return -1;
+      }
+      record[i] = (unsigned char)value;
+      sum += value;
+    }
+    if (record[0] + 5 != i || (sum & 0xFF) != 0){
+      printf("%s:%d has wrong lenght or checksum\n", path, lineNumber);
+      fclose(file);
+      return -1;
+    }
+    addr = (unsigned long)record[1] << 8 | record[2];
+    switch (record[3]){
+      case 0x00:
+        for (i = 0; i < record[0]; i++, bytes++){
+          if (base + addr + i >= size){
+            printf("%s:%d data at 0x%lX are out of FLASH\n", path, lineNumber, base + addr + i);
+            fclose(file);
+            return -1;
+          }
+          image[base + addr + i] = record[4 + i];
+        }
+        break;
+      case 0x01:
+        fclose(file);
+        return bytes;
+      case 0x02:
+        base = ((unsigned long)record[4] << 8 | record[5]) << 4;
+        break;
+      case 0x04:
+        base = ((unsigned long)record[4] << 8 | record[5]) << 16;
+        break;
+      default:                          /* start address */
+        break;
+    }
+  }
+  fclose(file);
+  return bytes;
+}
+
+/**
+   @fn     static void ihexRecord(FILE* file, unsigned char type, unsigned int addr, const unsigned char* data, int len)
+   @brief  one record with checksum
+**/
+static void ihexRecord(FILE* file, unsigned char type, unsigned int addr, const unsigned char* data, int len)
+{
+  unsigned char sum = (unsigned char)(len + (addr >> 8) + addr + type);
+  int i;
+
+  fprintf(file, ":%02X%04X%02X", len, addr & 0xFFFF, type);
+  for (i = 0; i < len; i++){
+    fprintf(file, "%02X", data[i]);
+    sum += data[i];
+  }
+  fprintf(file, "%02X\n", (unsigned char)-sum);
+}
+
+int ihexWrite(const char* path, const unsigned char image[], unsigned long size)
+{
+  unsigned char base[2];
+  unsigned long addr;
+  FILE* file;
+
+  if ((file = fopen(path, "w")) == NULL){
+    printf("can not write %s\n", path);
+    return -1;
+  }
+  for (addr = 0; addr < size; addr += IHEX_DATA_LEN){
+    if ((addr & 0xFFFF) == 0){
+      base[0] = (unsigned char)(addr >> 24);
+      base[1] = (unsigned char)(addr >> 16);
+      ihexRecord(file, 0x04, 0, base, 2);
+    }
+    ihexRecord(file, 0x00, addr & 0xFFFF, &image[addr],
+               size - addr < IHEX_DATA_LEN ? (int)(size - addr) : IHEX_DATA_LEN);
+  }
+  ihexRecord(file, 0x01, 0, NULL, 0);
+  return fclose(file) == 0 ? 0 : -1;
+}
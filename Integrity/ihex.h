@@ -0,0 +1,44 @@
+/**
+ *****************************************************************************
+   @file     ihex.h
+   @brief    Intel HEX files of FLASH image for host tools (FeeSignHex)
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    data records (00), end of file (01), extended segment (02) and
+            linear (04) address are read, start address records (03, 05) are
+            skipped, image is filled by 0xFF (erased FLASH) like Integrity.bat
+   @note    written file is whole image in records of 16 bytes with extended
+            linear address records, like srec_cat -intel -obs=16
+**/
+#ifndef _ihex_h
+#define _ihex_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+   @fn     long ihexRead(const char* path, unsigned char image[], unsigned long size)
+   @brief  FLASH image of Intel HEX file
+   @param  const char* path : .hex file
+   @param  unsigned char image[] : destination, bytes without data are 0xFF
+   @param  unsigned long size : size of FLASH
+   @return long - number of data bytes, -1 if file is broken or data are out of FLASH
+           (message is printed)
+**/
+long ihexRead(const char* path, unsigned char image[], unsigned long size);
+
+/**
+   @fn     int ihexWrite(const char* path, const unsigned char image[], unsigned long size)
+   @brief  Intel HEX file of FLASH image
+   @return int - 0 if file is written, -1 if not
+**/
+int ihexWrite(const char* path, const unsigned char image[], unsigned long size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ihex_h */
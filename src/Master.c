@@ -100,7 +100,19 @@ uint8_t rxUARTcount[2]={0,0};
 uint8_t rxPAcketTOut=0;
 
 //char lastRadioTransmitBuffer[PACKET_MEMORY_DEPTH];    //buffer with last radio dommand
-uint8_t dmaTxBuffer[2][(PACKET_MEMORY_DEPTH*2)];        //buffer for DMA TX UART channel
+#if BINARY_OUTPUT && (STREAM_FLUSH || !COMPRESSION)
+#error "BINARY_OUTPUT needs COMPRESSION and is not supported with STREAM_FLUSH"
+#endif
+#if STREAM_FLUSH
+#if DMA_CHUNK_DEPTH < COMPRESSION_STREAM_MIN
+#error "DMA_CHUNK_DEPTH is smaller than COMPRESSION_STREAM_MIN"
+#endif
+uint8_t dmaTxBuffer[2][DMA_CHUNK_DEPTH];           //chunks of decompressed packets for DMA TX UART channel
+uint16_t dmaChunkLen[2];                           //lenght of chunk in dmaTxBuffer
+struct decompressStream dmaStream;                 //actually decompressed packet
+#else
+uint8_t dmaTxBuffer[2][DECOMPRESSED_DEPTH];        //buffer for DMA TX UART channel
+#endif
 uint8_t dmaTxPingPong = 0;                              //ping pong pointer in dmaTxBuffer
 uint8_t dmaMessageBuffer[UART_BUFFER_DEEP]; 
 
@@ -113,6 +125,8 @@ int8_t sync_flag = FALSE;    //flag starting sending synchronization packet
 int8_t sync_wait = FALSE;
 int8_t firstRxPkt = FALSE;
 int8_t messageFlag = FALSE;
+int8_t profile_flag = FALSE;  /*!< @brief "PROF$" directive received @see PROFILING */
+int8_t capture_flag = FALSE;  /*!< @brief "CAPT$" directive received @see RADIO_CAPTURE */
 
 
 //variables for DMA_UART_TX_Int_Handler
@@ -122,6 +136,9 @@ int8_t   dmaTxReady[2] = {FALSE, FALSE};    /*!< @brief flag mean that all varia
 uint16_t dmaTxLen;              /*!< @brief global variable, with lenght of packet to send */
 uint8_t* dmaTxPtr;              /*!< @brief global pointer UART transmitting */
 uint8_t  dmaTxPktTotal;
+#if TELEMETRY
+int      dmaSendLen;            /*!< @brief lenght of running DMA transfer @see TELEMETRY */
+#endif
 uint16_t dmaTxTimeoutCounter=0;
 
 struct PRNGslave slaves[NUMBER_OF_SLAVES];
@@ -172,7 +189,7 @@ void readRadioConfiguration(){
     radioConf.Power = RADIO_POWER;
     radioConf.Whitening = DATA_WHITENING;
     radioConf.Manchester = RADIO_MANCHASTER;
-    WriteToFlash((uint8_t *)&radioConf, 0x1f000, sizeof(radioConf));
+    WriteToFlash((uint8_t *)&radioConf, RADIO_CONF_ADDRESS, sizeof(radioConf));
   }
 }
 
@@ -225,6 +242,23 @@ void setSynnicTimer(void){
   NVIC_EnableIRQ(TIMER0_IRQn);
 }
 
+#if TELEMETRY
+/** 
+   @fn     void setTelemetryTimer(void)
+   @brief  set general purpose timer1 for period of telemetry
+   @see    void GP_Tmr1_Int_Handler ()
+   @note   timer predivider factor = 256, processor clock, periodic mode
+**/
+void setTelemetryTimer(void){
+  GptLd (pADI_TM1, TELEMETRY_INTERVAL);   // Interval of 1s
+  GptCfg(pADI_TM1, TCON_CLK_UCLK, TCON_PRE_DIV256, TCON_ENABLE_EN|TCON_RLD_EN|TCON_MOD_PERIODIC);
+  while (GptSta(pADI_TM1)& TSTA_CON);     // wait for sync of TCON write. required because of use of asynchronous clock
+  GptClrInt(pADI_TM1,TCLRI_TMOUT);
+  while (GptSta(pADI_TM1)& TSTA_CLRI);    // wait for sync of TCLRI write. required because of use of asynchronous clock
+  NVIC_EnableIRQ(TIMER1_IRQn);
+}
+#endif
+
 void setBestFrequency(){
   RIE_Response = RadioSetFrequency(radioConf.BaseFrequency);
   if(RIE_Response == RIE_Success){
@@ -315,6 +349,9 @@ void radioInit(void){
    @see DMA_UART_TX_Int_Handler
 **/
 void  dmaSend(void* buff, int len){
+#if TELEMETRY
+  dmaSendLen = len;                       // counted at end of transfer
+#endif
   //DMA UART stream
   DmaInit();
   DmaTransferSetup(UARTTX_C, len, buff);
@@ -344,6 +381,10 @@ uint16_t dma_printf(const char * format /*format*/, ...)
   va_start( args, format );
    
   len = vsprintf((char*)dmaMessageBuffer, format,args);    //vlozenie formatovaneho retazca do buff
+#if STREAM_FLUSH
+  while(dmaTx_flag);    //wait for flush of packets
+  dmaTx_flag = TRUE;
+#endif
   dmaSend(dmaMessageBuffer,len);
 
   va_end( args );
@@ -369,6 +410,7 @@ void radioSend(void* buff, uint8_t len){
   
   if (RIE_Response == RIE_Success){   //send packet
     RIE_Response = RadioTxPacketVariableLen(len, buff); 
+    TELEMETRY_ADD(radioTx, len);
     RX_flag = FALSE;
   }
   
@@ -419,6 +461,29 @@ uint8_t rf_printf(const char * format /*format*/, ...){
   va_end( args );
   return len;
 }
+#if ENTROPY_CODING
+uint8_t entropyBuffer[PACKET_MEMORY_DEPTH];   //decoded payload of packet
+
+/** 
+   @fn     uint16_t entropyPayload(uint8_t* packet, uint16_t len, uint8_t** payload)
+   @brief  payload of packet, decoded if slave coded it (ID of table in head)
+   @param  uint8_t* packet : packet with head
+   @param  uint16_t len : lenght of packet with head
+   @param  uint8_t** payload : pointer at payload (behind head or entropyBuffer)
+   @return uint16_t - lenght of payload, 0 if coded payload is broken (packet is dropped)
+   @note   called from setTransfer() and streamChunk() too, no messages
+**/
+uint16_t entropyPayload(uint8_t* packet, uint16_t len, uint8_t** payload){
+  uint8_t table = ENTROPY_TABLE(packet[0]);
+  
+  *payload = &packet[HEAD_LENGHT];
+  if (table == 0)
+    return len - HEAD_LENGHT;
+  *payload = entropyBuffer;
+  return entropyDecode(table, &packet[HEAD_LENGHT], len - HEAD_LENGHT, entropyBuffer);
+}
+#endif
+
 #if SLOW_FLUSH == 0
 
 /** 
@@ -453,6 +518,9 @@ void setTransfer(void){
         len = pktMemory[actualTxBuffer].lenghtOfPkt[dmaTxPkt];
         
 #if COMPRESSION
+#if ENTROPY_CODING
+        len = entropyPayload(pointer - HEAD_LENGHT, len, &pointer) + HEAD_LENGHT;
+#endif
         dmaTxLen = binaryToHexaDecompression( pointer, 
                                               &dmaTxBuffer[localPingPong][0], 
                                               len - HEAD_LENGHT);
@@ -467,6 +535,9 @@ void setTransfer(void){
       }
       else{
         //dma_printf("\nmissing packet %d #",dmaTxPkt+1);        //message about missing packet
+#if TEXT_DICTIONARY
+        textDecoderLost();                                      //words of window are unknown
+#endif
       }
       dmaTxPkt++;
     }
@@ -495,6 +566,7 @@ void setTransfer(void){
 uint8_t radioRecieve(void){
   uint16_t timeout_timer = 0;
   
+  PROFILE_BEGIN(PROF_RADIO_RECIEVE);
   if (RIE_Response == RIE_Success && RX_flag == FALSE ){
     RIE_Response = RadioRxPacketVariableLen();
     RX_flag = TRUE;
@@ -517,6 +589,7 @@ uint8_t radioRecieve(void){
       if (timeout_timer > T_TIMEOUT){
         LED_ON;
         rxPAcketTOut++;
+        PROFILE_END(PROF_RADIO_RECIEVE);
         return 0;
       }
     }
@@ -526,8 +599,12 @@ uint8_t radioRecieve(void){
   
   LED_ON;
   //citanie paketu z rf kontrolera
+  PROFILE_BEGIN(PROF_RX_PACKET_READ);
   if (RIE_Response == RIE_Success)
     RIE_Response = RadioRxPacketRead(sizeof(Buffer),&PktLen,Buffer,&RSSI);
+  PROFILE_END(PROF_RX_PACKET_READ);
+  if (RIE_Response == RIE_Success)
+    TELEMETRY_ADD(radioRx[slave_ID], PktLen);
   LED_OFF;
   
     //DMA UART stream
@@ -540,6 +617,7 @@ uint8_t radioRecieve(void){
     RIE_Response = RadioRxPacketVariableLen();   
     RX_flag = TRUE;
   }
+  PROFILE_END(PROF_RADIO_RECIEVE);
   return 1;
 }
 /** 
@@ -560,7 +638,11 @@ uint8_t validPacket(void){
   uint8_t i,slv,pktNum;
   
     //extracting slave identifier
+#if ENTROPY_CODING
+  slv = (Buffer[0] & ~ENTROPY_HEAD_MASK)-CHAR_OFFSET;   //bits 7-6 are ID of table
+#else
   slv = Buffer[0]-CHAR_OFFSET;
+#endif
   //extracting number of actual packets
   actualPacket = Buffer[1]-CHAR_OFFSET;
   //extracting number of actual packets
@@ -613,6 +695,7 @@ uint8_t validPacket(void){
 **/
 void copyBufferToMemory(void){
   uint8_t* buf = &pktMemory[actualRxBuffer].packet[actualPacket-1][0];
+  PROFILE_BEGIN(PROF_COPY_BUFFER);
   //extracting number of actual packets
   actualPacket = Buffer[1]-CHAR_OFFSET;
   
@@ -623,6 +706,7 @@ void copyBufferToMemory(void){
   
   memcpy(buf,Buffer,PktLen);//copy packet to memory
   pktMemory[actualRxBuffer].lenghtOfPkt[actualPacket-1] = PktLen;
+  PROFILE_END(PROF_COPY_BUFFER);
 }
 /** 
    @fn     void ifMissPktGet(void)
@@ -658,6 +742,7 @@ void ifMissPktGet(void)
 //////////////send request for retransmition if needed//////////////
   if (numOfReTxPackets != 0)
   {
+    TELEMETRY_ADD(retx, numOfReTxPackets);
     radioSend(str, numOfReTxPackets+4);
     //rf_printf(str);
 
@@ -700,9 +785,30 @@ void Send(char* buff, int len){
     buff++;
   }
 }
+
+#if TELEMETRY
+/** 
+   @fn     void sendTelemetry(void)
+   @brief  print status frame of telemetry on UART if period elapsed
+   @pre    all packets of pktMemory are flushed (flush_flag == FALSE)
+   @note   frame is printed between words of stream, it is waiting only for
+           last DMA transfer
+   @see    telemetryFrame()
+**/
+void sendTelemetry(void){
+  if (telemetry_flag == TRUE){
+    while(dmaTx_flag);    //wait for dma transfer done
+    Send(telemetryBuffer, telemetryFrame(0));
+  }
+}
+#endif
 void slowFlush(){
     uint8_t *pointer;
+#if ENTROPY_CODING
+    uint8_t *payload;
+#endif
     uint16_t len;
+    PROFILE_BEGIN(PROF_SLOW_FLUSH);
 //  if(flush_flag == TRUE && dmaTxReady[localPingPong] == FALSE){
     
     //packet iterate 0..as needed
@@ -715,9 +821,16 @@ void slowFlush(){
         
         len = pktMemory[actualTxBuffer].lenghtOfPkt[dmaTxPkt];
 #if COMPRESSION
+#if ENTROPY_CODING
+        len = entropyPayload(pointer, len, &payload);
+        dmaTxLen = binaryToHexaDecompression( payload, 
+                                              &dmaTxBuffer[0][0], 
+                                              len);
+#else
         dmaTxLen = binaryToHexaDecompression( &pointer[HEAD_LENGHT], 
                                               &dmaTxBuffer[0][0], 
                                               len - HEAD_LENGHT);
+#endif
         while(dmaTx_flag);    //wait for dma transfer done
         dmaTx_flag = TRUE;
         dmaSend((char *)dmaTxBuffer,dmaTxLen);
@@ -733,10 +846,131 @@ void slowFlush(){
       }
       else{
         dma_printf("\nmissing packet %d #",dmaTxPkt+1);        //message about missing packet
+#if TEXT_DICTIONARY
+        textDecoderLost();                                      //words of window are unknown
+#endif
       }
       dmaTxPkt++;
     }
+    PROFILE_END(PROF_SLOW_FLUSH);
 }
+#if STREAM_FLUSH
+/** 
+   @fn     uint16_t streamChunk(uint8_t* chunk)
+   @brief  decompress next DMA_CHUNK_DEPTH chars of packets dmaTxPkt..dmaTxPktTotal
+   @param  uint8_t* chunk : dmaTxBuffer[0] or dmaTxBuffer[1]
+   @return uint16_t - lenght of chunk, 0 if all packets are flushed
+   @note   called from streamFlush() and DMA_UART_TX_Int_Handler()
+**/
+uint16_t streamChunk(uint8_t* chunk){
+  uint8_t *pointer, *payload;
+  uint16_t len = 0, payloadLen;
+  
+  while(len < DMA_CHUNK_DEPTH){
+    if (!decompressStreamDone(&dmaStream)){
+      len += decompressStream(&dmaStream, &chunk[len], DMA_CHUNK_DEPTH - len);
+      if (!decompressStreamDone(&dmaStream))
+        break;                          //chunk is full
+    }
+    if (dmaTxPkt >= dmaTxPktTotal)
+      break;
+    
+    pointer = &pktMemory[actualTxBuffer].packet[dmaTxPkt][0];   //pointer at actuall packet
+    
+    //try if packet is received waiting flag 'w'
+    if(pointer[1]!='w'){
+#if ENTROPY_CODING
+      payloadLen = entropyPayload(pointer, pktMemory[actualTxBuffer].lenghtOfPkt[dmaTxPkt], &payload);
+#else
+      payload = &pointer[HEAD_LENGHT];
+      payloadLen = pktMemory[actualTxBuffer].lenghtOfPkt[dmaTxPkt] - HEAD_LENGHT;
+#endif
+      decompressStreamInit(&dmaStream, payload, payloadLen);
+    }
+    else{
+      if (DMA_CHUNK_DEPTH - len < 24)
+        break;                          //message to next chunk
+      len += sprintf((char*)&chunk[len], "\nmissing packet %d #", dmaTxPkt+1);  //message about missing packet
+#if TEXT_DICTIONARY
+      textDecoderLost();                //words of window are unknown
+#endif
+    }
+    dmaTxPkt++;
+  }
+  return len;
+}
+
+/** 
+   @fn     void streamFlush(void)
+   @brief  start sending of packets decompressed in chunks
+   @note   first chunk is sent, second is prepared, next chunks are
+           decompressed in DMA_UART_TX_Int_Handler() until flush_flag is cleared
+**/
+void streamFlush(void){
+  PROFILE_BEGIN(PROF_SLOW_FLUSH);
+  while(dmaTx_flag);    //wait for dma transfer done
+  decompressStreamInit(&dmaStream, NULL, 0);
+  dmaTxReady[0] = FALSE;
+  dmaTxReady[1] = FALSE;
+  
+  dmaChunkLen[0] = streamChunk(&dmaTxBuffer[0][0]);
+  if (dmaChunkLen[0] == 0){
+    PROFILE_END(PROF_SLOW_FLUSH);
+    return;
+  }
+  flush_flag = TRUE;
+  dmaTx_flag = TRUE;
+  dmaTxPingPong = 0;
+  dmaTxReady[0] = TRUE;
+  NVIC_DisableIRQ(DMA_UART_TX_IRQn);    //interrupt is decompressing to other buffer
+  dmaSend(&dmaTxBuffer[0][0], dmaChunkLen[0]);
+  
+  dmaChunkLen[1] = streamChunk(&dmaTxBuffer[1][0]);
+  dmaTxReady[1] = (dmaChunkLen[1] > 0);
+  NVIC_EnableIRQ(DMA_UART_TX_IRQn);
+  PROFILE_END(PROF_SLOW_FLUSH);
+}
+#endif
+#if BINARY_OUTPUT
+/** 
+   @fn     void binaryFlush(void)
+   @brief  send packets of slot as COBS framed records (Cobs.h) without decompression
+   @note   record is built in dmaTxBuffer[1] while previous frame is sent from
+           dmaTxBuffer[0], missing packet is record without payload
+**/
+void binaryFlush(void){
+  uint8_t *pointer, *payload, *record = &dmaTxBuffer[1][0];
+  uint16_t len;
+  PROFILE_BEGIN(PROF_SLOW_FLUSH);
+  
+  //packet iterate 0..as needed
+  while(dmaTxPkt < dmaTxPktTotal){
+    
+    pointer = &pktMemory[actualTxBuffer].packet[dmaTxPkt][0];   //pointer at actuall packet
+    record[0] = slave_ID;
+    record[1] = dmaTxPkt + 1;
+    len = 0;
+    
+    //try if packet is received waiting flag 'w'
+    if(pointer[1]!='w'){
+      len = pktMemory[actualTxBuffer].lenghtOfPkt[dmaTxPkt];
+#if ENTROPY_CODING
+      len = entropyPayload(pointer, len, &payload);
+#else
+      payload = &pointer[HEAD_LENGHT];
+      len -= HEAD_LENGHT;
+#endif
+      memcpy(&record[RECORD_HEAD], payload, len);
+    }
+    while(dmaTx_flag);    //wait for dma transfer done
+    dmaTxLen = recordEncode(record, len, &dmaTxBuffer[0][0]);
+    dmaTx_flag = TRUE;
+    dmaSend(&dmaTxBuffer[0][0], dmaTxLen);
+    dmaTxPkt++;
+  }
+  PROFILE_END(PROF_SLOW_FLUSH);
+}
+#endif
 /** 
    @fn     void flushBufferedPackets(void)
    @brief  rotate memory and start sending received packets on UART with DMA
@@ -745,7 +979,9 @@ void slowFlush(){
    @note   all managment about sending packets is in @see DMA_UART_TX_Int_Handler()
 **/
 void flushBufferedPackets(void){
-#if SLOW_FLUSH == 0  
+#if STREAM_FLUSH
+  while(flush_flag==TRUE);              //wait untill all packets are flushed
+#elif SLOW_FLUSH == 0  
   //wait untill all packets are flushed
   while(flush_flag==TRUE){
 
@@ -761,6 +997,9 @@ void flushBufferedPackets(void){
   }
 #endif
   dmaTxTimeoutCounter=0;
+  #if TELEMETRY
+  sendTelemetry();        //UART stream is flushed, place for status frame
+  #endif
   //switch buffer 
   actualRxBuffer++;
   actualTxBuffer++;
@@ -771,7 +1010,17 @@ void flushBufferedPackets(void){
   
   dmaTxPkt =0;
   dmaTxPktTotal = pktMemory[actualTxBuffer].numOfPkt;
-#if SLOW_FLUSH
+#if TEXT_DICTIONARY
+  textDecoderReset();                   //packets of slot are one superframe of slave
+#endif
+#if UWB_COMPRESSION
+  uwbDecoderSource(slave_ID);           //references of radars are kept per slave
+#endif
+#if STREAM_FLUSH
+  streamFlush();
+#elif BINARY_OUTPUT
+  binaryFlush();
+#elif SLOW_FLUSH
   slowFlush();
 #else
   flush_flag = TRUE;
@@ -1036,23 +1285,48 @@ void checkBufferedRandomPackets(void){
    @note   programmer CM3WSD is located in "Integrity" folder
    @code   ::code in conv.bat
    @pre    for right generation of .hex file must be call script Integrity.bat located in Integrity folder
+           (FeeSign.bat if FEE_SIGN, expected signature of flash controller instead of CRC)
 */
 void checkIntegrityOfFirmware(void){
+  #ifndef BEGIN_OF_CODE_MEMORY
   #define BEGIN_OF_CODE_MEMORY    (uint8_t *)0x0  // pointer at begining of code memory
+  #endif
   #define LENGHT_OF_CODE_MEMORY   0x20000         // end of code memory
 /*
 512(bytes is one page)*256(pages) = 131072 = 0x20000
 */
 
   crc retval;
+  #if FEE_SIGN
+  int status;
+  #endif
   
-  #if CRC_FAST
-    crcInit();
-  //the reason why use crcSlow is that crcFast is using much more memory
+  PROFILE_BEGIN(PROF_INTEGRITY);
+  #if FEE_SIGN
+    //Sign command of flash controller, it is comparing signature with last 4 bytes of FLASH
+    while (FeeSign(0, LENGHT_OF_CODE_MEMORY - 1) == 0);
+    while ((status = FeeSta()) & FEESTA_CMDBUSY);
+    retval = ((status & FEESTA_CMDRES_MSK) != FEESTA_CMDRES_SUCCESS);
+  #elif CRC_FAST
     retval = crcFast(BEGIN_OF_CODE_MEMORY,LENGHT_OF_CODE_MEMORY);
+  #elif CRC_NIBBLE
+    retval = crcNibble(BEGIN_OF_CODE_MEMORY,LENGHT_OF_CODE_MEMORY);
   #else
     retval = crcSlow(BEGIN_OF_CODE_MEMORY,LENGHT_OF_CODE_MEMORY);
   #endif
+  PROFILE_END(PROF_INTEGRITY);
+  #if PROFILING
+  //CRC functions over one packet
+  PROFILE_BEGIN(PROF_CRC_SLOW);
+  crcSlow(BEGIN_OF_CODE_MEMORY,PACKET_MEMORY_DEPTH);
+  PROFILE_END(PROF_CRC_SLOW);
+  PROFILE_BEGIN(PROF_CRC_NIBBLE);
+  crcNibble(BEGIN_OF_CODE_MEMORY,PACKET_MEMORY_DEPTH);
+  PROFILE_END(PROF_CRC_NIBBLE);
+  PROFILE_BEGIN(PROF_CRC_FAST);
+  crcFast(BEGIN_OF_CODE_MEMORY,PACKET_MEMORY_DEPTH);
+  PROFILE_END(PROF_CRC_FAST);
+  #endif
   
   if (retval == 0){
     printf("\nintegrity check ok#");
@@ -1060,6 +1334,9 @@ void checkIntegrityOfFirmware(void){
   }
   else{
     printf("\nproblem in integrity of firmware #");  
+    #if FEE_SIGN
+    printf("\nsignature of firmware %06X#", FeeSig());
+    #endif
     LED_OFF;
     //while(1);
   }
@@ -1087,6 +1364,9 @@ int main(void)
   memset(pktMemory, 0, sizeof(pktMemory));  
   
   uartInit();
+  #if PROFILING
+  profileInit();
+  #endif
   checkIntegrityOfFirmware();
   ledInit();
   radioInit();
@@ -1094,11 +1374,18 @@ int main(void)
   #if CHECK_PRNG_LOCAL
   initializeRandomCheck();
   #endif
+  #if RADIO_CAPTURE
+  radioCaptureInit();
+  #endif
+  #if TELEMETRY
+  setTelemetryTimer();
+  #endif
 
   while(1)
   {
-    
     if (receivePackets()){            //if some data packets are received
+      TELEMETRY_ADD(slots, 1);
+      TELEMETRY_ADD(slotsUsed, 1);
       #if DEBUG_MESAGES
         dma_printf("\nredeived %d pkts #", pktMemory[actualRxBuffer].numOfPkt);
       #endif
@@ -1111,6 +1398,13 @@ int main(void)
       flushBufferedPackets();         //send on UART received packets
       #endif
     }
+    #if TELEMETRY
+    else{
+      TELEMETRY_ADD(slots, 1);
+      if (flush_flag == FALSE)        //if previous packets are flushed
+        sendTelemetry();
+    }
+    #endif
     
     //if synchronize message received
     if (sync_flag == TRUE)
@@ -1122,23 +1416,49 @@ int main(void)
       messageFlag = FALSE;
     }
     
+    #if PROFILING
+    //print table of profiled sections
+    if (profile_flag == TRUE){
+      while(dmaTx_flag);    //wait for dma transfer done
+      profileDump();
+      profileReset();
+      profile_flag = FALSE;
+    }
+    #endif
+    
+    #if RADIO_CAPTURE
+    //print captured radio frames
+    if (capture_flag == TRUE){
+      while(dmaTx_flag);    //wait for dma transfer done
+      radioCaptureDump();
+      radioCaptureReset();
+      capture_flag = FALSE;
+    }
+    #endif
+    
     initializeNewSlot();
   }
 }
 
 ///////////////////////////////////////////////////////////////////////////
-// GP Timer1 Interrupt handler used for blinking led
+// GP Timer1 Interrupt handler 
+// used for measure troughput any 1s
 ///////////////////////////////////////////////////////////////////////////
 /** 
     @fn      void GP_Tmr1_Int_Handler (void)
-    @brief   Interrupt handler for timer 1 already unused
+    @brief   Interrupt handler for period of telemetry
+    @see     setTelemetryTimer()
+    @see     sendTelemetry()
 **/
 void GP_Tmr1_Int_Handler (void)
 {
 
   if (GptSta(pADI_TM1)== TSTA_TMOUT)    // if timout interrupt
   {
-
+    GptClrInt(pADI_TM1,TCLRI_TMOUT);
+  #if TELEMETRY
+    telemetryTick();                    // snapshot of counters, frame is printed in main loop
+  #endif
   }
 }
 
@@ -1175,9 +1495,29 @@ void GP_Tmr0_Int_Handler(void){
 void DMA_UART_TX_Int_Handler (void)
 {
   uint8_t localPingPong;
+  PROFILE_BEGIN(PROF_DMA_TX_ISR);
   UrtDma(0,0);                       // prevents further UART DMA requests
   DmaChanSetup ( UARTTX_C , DISABLE , DISABLE );    // Disable DMA channel
-#if SLOW_FLUSH
+#if TELEMETRY
+  TELEMETRY_ADD(uart, dmaSendLen);  // drained bytes of finished transfer
+  dmaSendLen = 0;
+#endif
+#if STREAM_FLUSH
+  dmaTxReady[dmaTxPingPong] = FALSE;  //chunk is sent
+  localPingPong = dmaTxPingPong;
+  dmaTxPingPong = dmaTxPingPong ? 0 : 1;
+  
+  if (dmaTxReady[dmaTxPingPong] == TRUE){
+    dmaSend(&dmaTxBuffer[dmaTxPingPong][0], dmaChunkLen[dmaTxPingPong]);
+    //decompress next chunk while this one is sent
+    dmaChunkLen[localPingPong] = streamChunk(&dmaTxBuffer[localPingPong][0]);
+    dmaTxReady[localPingPong] = (dmaChunkLen[localPingPong] > 0);
+  }
+  else{                               //all chunks sent or end of dma_printf()
+    dmaTx_flag = FALSE;
+    flush_flag = FALSE;
+  }
+#elif SLOW_FLUSH
   dmaTx_flag = FALSE;
 #else
   #if COMPRESSION  
@@ -1227,6 +1567,7 @@ void DMA_UART_TX_Int_Handler (void)
   }
   #endif
 #endif
+  PROFILE_END(PROF_DMA_TX_ISR);
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -1268,6 +1609,7 @@ void UART_Int_Handler ()
   uint8_t ucCOMIID0; 
   char ch;
  
+  PROFILE_BEGIN(PROF_UART_ISR);
   ucCOMIID0 = UrtIntSta(0);      // Read UART Interrupt ID register
 
   if ((ucCOMIID0 & COMIIR_STA_RXBUFFULL) == COMIIR_STA_RXBUFFULL)    // Receive buffer full interrupt
@@ -1279,6 +1621,7 @@ void UART_Int_Handler ()
       DioCfgPin(pADI_GP1,PIN0,0); // turn off RxD function at pin for a moment
       while(ch--);                //random waiting time
       DioCfgPin(pADI_GP1,PIN0,1); // turn on RxD function at pin
+      PROFILE_END(PROF_UART_ISR);
       return;
     }
   
@@ -1292,6 +1635,14 @@ void UART_Int_Handler ()
         sync_flag = TRUE;
         rxUARTcount[rxPingPong] = 0;
       }else{
+#if PROFILING
+        if (memcmp((char*)(rxPtr - 5),"PROF$",5) == 0)
+          profile_flag = TRUE;    // dump also on master, slaves get it as message
+#endif
+#if RADIO_CAPTURE
+        if (memcmp((char*)(rxPtr - 5),"CAPT$",5) == 0)
+          capture_flag = TRUE;    // dump also on master, slaves get it as message
+#endif
         messageFlag = TRUE;
       }
       // switch ping pong register
@@ -1303,4 +1654,5 @@ void UART_Int_Handler ()
     if (rxUARTcount[rxPingPong] >= UART_BUFFER_DEEP)                      //check not overflow buffer
       rxUARTcount[rxPingPong] = 0;
   }
+  PROFILE_END(PROF_UART_ISR);
 } 
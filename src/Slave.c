@@ -83,13 +83,25 @@ struct PRNGslave slavePRNG;
 char actualRxBuffer=0;
 char actualTxBuffer=1;
 
+#if UART_WORD_COMPRESSION
+uint8_t rxWord[UART_WORD_DEEPTH];                  //word received trought UART, compressed at STRING_TERMINATOR
+const char* volatile rxDropMessage = NULL;         //message of dropped word, printed by storePkt()
+#if ENTROPY_CODING
+uint8_t entropyNext = 0;                           //first closed packet of actualRxBuffer not coded yet
+#endif
+#else
 uint8_t rxPingPong = 0;                            //ping pong pointer in rxUARTbuffer
 uint8_t rxUARTbuffer[2][UART_BUFFER_DEEPTH];    //buffer for TX UART channel
 uint16_t rxUARTbufferLen[2] = {0,0};
+#endif
 uint16_t rxUARTcount = 0;
+#if TEXT_DICTIONARY
+uint16_t textPktChars = 0;                         //decompressed lenght of last packet, up to DECOMPRESSED_DEPTH
+#endif
 
 
 uint8_t* rxPktPtr ;
+volatile int8_t dmaTx_flag = FALSE;    //DMA transfer of dmaSend() is running, cleared in DMA_UART_TX_Int_Handler
 /////////flags/////////////////////
 uint8_t TX_flag = FALSE, RX_flag=FALSE, terminate_flag=FALSE, buffer_change_flag=0, memory_full_flag = 0 ;
 uint8_t my_slot = FALSE, pkt_received_flag = FALSE, close_packet_flag = FALSE;
@@ -100,10 +112,206 @@ uint16_t dma_printf(const char * format /*format*/, ...);
 int i=0,j=0;
 int debugTimer=0;
 
+#if ENTROPY_CODING
+uint8_t entropyBuffer[PACKET_MEMORY_DEPTH];   //coded payload before copy to packet
+
+/** 
+   @fn      void entropyPkt(uint8_t pkt)
+   @brief   code payload of packet in memory by best table, ID of table to
+            first byte of head (0 if payload is not coded)
+   @param   uint8_t pkt : index of packet in actualRxBuffer
+   @note    transmit() is adding SLAVE_ID to first byte of head
+**/
+void entropyPkt(uint8_t pkt){
+  uint8_t *packet = &pktMemory[actualRxBuffer].packet[pkt][0], table;
+  uint16_t len;
+  
+  table = entropyEncode(&packet[HEAD_LENGHT], pktMemory[actualRxBuffer].lenghtOfPkt[pkt], entropyBuffer, &len);
+  if (table){
+    memcpy(&packet[HEAD_LENGHT], entropyBuffer, len);
+    pktMemory[actualRxBuffer].lenghtOfPkt[pkt] = len;
+  }
+  packet[0] = ENTROPY_HEAD(table);
+}
+#endif
+
+#if UART_WORD_COMPRESSION
+/** 
+   @fn      void storeWord(uint16_t wordLen)
+   @brief   compress word of rxWord directly into last packet in memory, next
+            packet is started if compressed word do not fit
+   @param   uint16_t wordLen : lenght of word with STRING_TERMINATOR
+   @note    called from UART_Int_Handler(), messages are printed by storePkt()
+   @note    if free place (room) of last packet is shorter than wordLen + 2 (longest
+            output of hexaToBinaryCompression()), word is compressed into next
+            packet and moved back if it fits, word is dropped when memory has
+            no next packet even if compressed word would fit
+**/
+void storeWord(uint16_t wordLen){
+  uint8_t pktNum = pktMemory[actualRxBuffer].numOfPkt, *dest;
+  uint16_t binaryLen, room = 0;
+  
+  if (pktNum)
+    room = PACKET_MEMORY_DEPTH - HEAD_LENGHT - pktMemory[actualRxBuffer].lenghtOfPkt[pktNum - 1];
+#if TEXT_DICTIONARY
+  if (textPktChars + wordLen > DECOMPRESSED_DEPTH)
+    room = 0;                           //tokens of last packet would not fit to output of master
+#endif
+  if (room >= wordLen + COMPRESSION_OVERHEAD)
+    dest = &pktMemory[actualRxBuffer].packet[pktNum - 1][HEAD_LENGHT + pktMemory[actualRxBuffer].lenghtOfPkt[pktNum - 1]];
+  else if (pktNum < NUM_OF_PACKETS_IN_MEMORY)
+    dest = &pktMemory[actualRxBuffer].packet[pktNum][HEAD_LENGHT];
+  else{
+    TELEMETRY_ADD(dropFull, 1);
+    rxDropMessage = "\npacket memory is full #";
+    pkt_received_flag = TRUE;
+    return;
+  }
+  
+  PROFILE_BEGIN(PROF_COMPRESSION);
+  binaryLen = hexaToBinaryCompression(rxWord, dest, wordLen);
+  PROFILE_END(PROF_COMPRESSION);
+  if (binaryLen == 0)
+    return;                             //word was dropped, no packet is opened
+#if COMPRESSION_V2
+  //word joins block of last packet, its own block head is removed
+  if (pktNum && binaryLen >= COMPRESSION_BLOCK_HEAD 
+      && (room >= wordLen + COMPRESSION_OVERHEAD || binaryLen - COMPRESSION_BLOCK_HEAD <= room)){
+    binaryLen -= COMPRESSION_BLOCK_HEAD;
+    memmove(dest, dest + COMPRESSION_BLOCK_HEAD, binaryLen);
+    pktMemory[actualRxBuffer].packet[pktNum - 1][HEAD_LENGHT + 1] += binaryLen;
+  }
+#elif ADAPTIVE_COMPRESSION
+  if (dest[0] == 0)
+    binaryLen++;                        //not translated word keeps STRING_TERMINATOR (compressedWordLen())
+#endif
+  
+  if (room >= wordLen + COMPRESSION_OVERHEAD)
+    pktMemory[actualRxBuffer].lenghtOfPkt[pktNum - 1] += binaryLen;
+  else if (binaryLen <= room){          //fits to last packet after compression
+    memcpy(&pktMemory[actualRxBuffer].packet[pktNum - 1][HEAD_LENGHT + pktMemory[actualRxBuffer].lenghtOfPkt[pktNum - 1]],
+           dest, binaryLen);
+    pktMemory[actualRxBuffer].lenghtOfPkt[pktNum - 1] += binaryLen;
+  }
+  else{                                 //start next packet, previous is closed
+#if ENTROPY_CODING
+    pktMemory[actualRxBuffer].packet[pktNum][0] = 0;      //not coded
+    pkt_received_flag = TRUE;                             //storePkt() is coding closed packet
+#endif
+    pktMemory[actualRxBuffer].lenghtOfPkt[pktNum] = binaryLen;
+    pktMemory[actualRxBuffer].numOfPkt++;
+#if TEXT_DICTIONARY
+    textPktChars = 0;
+#endif
+  }
+#if TEXT_DICTIONARY
+  textPktChars += wordLen;
+#endif
+}
+#endif
+
+#if UWB_COMPRESSION && !UART_WORD_COMPRESSION
+uint8_t uwbBuffer[UART_BUFFER_DEEPTH + 1];   //compressed UART buffer before packing to packets
+#if COMPRESSION_V2
+#define PACKET_BLOCK_HEAD COMPRESSION_BLOCK_HEAD   //any packet is one block
+#else
+#define PACKET_BLOCK_HEAD 0
+#endif
+
+/** 
+   @fn      void packWords(uint8_t* binary, uint16_t binaryLen)
+   @brief   append compressed words to last packet in memory, next packet is
+            started if word do not fit
+   @param   uint8_t* binary : compressed data (hexaToBinaryCompression())
+   @param   uint16_t binaryLen : lenght of compressed data
+   @note    records of UWB frames of more UART buffers are filling one packet,
+            word is never split between packets
+**/
+void packWords(uint8_t* binary, uint16_t binaryLen){
+  uint8_t pktNum;
+  uint16_t wordLen;
+#if TEXT_DICTIONARY
+  uint16_t chars;
+#endif
+  
+  while (binaryLen > 0){
+#if COMPRESSION_V2
+    if (binary[0] == COMPRESSION_VERSION_2){                  //words of blocks are packed to new blocks
+      binary += COMPRESSION_BLOCK_HEAD;
+      binaryLen -= (binaryLen < COMPRESSION_BLOCK_HEAD) ? binaryLen : COMPRESSION_BLOCK_HEAD;
+      continue;
+    }
+#endif
+    wordLen = compressedWordLen(binary);
+    if (wordLen > binaryLen)
+      wordLen = binaryLen;
+    
+#if TEXT_DICTIONARY
+    //decompressed lenght, other records are not longer as DECOMPRESSED_DEPTH of full packet
+    chars = (binary[0] == TEXT_TOKEN) ? textDecodedMax(binary) : wordLen * (DECOMPRESSED_DEPTH / PACKET_MEMORY_DEPTH);
+#endif
+    
+    if (wordLen > PACKET_MEMORY_DEPTH - HEAD_LENGHT - PACKET_BLOCK_HEAD){
+      TELEMETRY_ADD(dropLong, 1);
+#if TEXT_DICTIONARY
+      textEncoderLost();
+#endif
+      dma_printf("\npkt too Long#");
+    }
+    else{
+      pktNum = pktMemory[actualRxBuffer].numOfPkt;
+      if (pktNum == 0 || 
+#if TEXT_DICTIONARY
+          textPktChars + chars > DECOMPRESSED_DEPTH ||
+#endif
+          pktMemory[actualRxBuffer].lenghtOfPkt[pktNum - 1] + wordLen > PACKET_MEMORY_DEPTH - HEAD_LENGHT){
+        if (pktNum >= NUM_OF_PACKETS_IN_MEMORY){
+          TELEMETRY_ADD(dropFull, 1);
+#if TEXT_DICTIONARY
+          textEncoderLost();
+#endif
+          dma_printf("\npacket memory is full #");
+          return;
+        }
+#if ENTROPY_CODING
+        if (pktNum)
+          entropyPkt(pktNum - 1);                             //previous packet is closed
+        pktMemory[actualRxBuffer].packet[pktNum][0] = 0;      //not coded
+#endif
+        pktMemory[actualRxBuffer].lenghtOfPkt[pktNum] = 0;    //start next packet
+#if COMPRESSION_V2
+        pktMemory[actualRxBuffer].packet[pktNum][HEAD_LENGHT] = COMPRESSION_VERSION_2;
+        pktMemory[actualRxBuffer].packet[pktNum][HEAD_LENGHT + 1] = 0;
+        pktMemory[actualRxBuffer].lenghtOfPkt[pktNum] = COMPRESSION_BLOCK_HEAD;
+#endif
+        pktMemory[actualRxBuffer].numOfPkt++;
+        pktNum++;
+#if TEXT_DICTIONARY
+        textPktChars = 0;
+#endif
+      }
+      memcpy(&pktMemory[actualRxBuffer].packet[pktNum - 1][HEAD_LENGHT + pktMemory[actualRxBuffer].lenghtOfPkt[pktNum - 1]],
+             binary, wordLen);
+      pktMemory[actualRxBuffer].lenghtOfPkt[pktNum - 1] += wordLen;
+#if COMPRESSION_V2
+      pktMemory[actualRxBuffer].packet[pktNum - 1][HEAD_LENGHT + 1] += wordLen;
+#endif
+#if TEXT_DICTIONARY
+      textPktChars += chars;
+#endif
+    }
+    binary += wordLen;
+    binaryLen -= wordLen;
+  }
+}
+#endif
+
 /** 
    @fn      void storePkt(void)
    @brief   store buffered packet via UART to packetMemory
    @note    place this code where is nothing else to do.
+   @note    with UART_WORD_COMPRESSION are words stored by UART_Int_Handler(),
+            only messages of dropped words are printed and closed packets coded
    @code    
       //place this code at place where is MCU waiting for something
       if (pkt_received_flag == TRUE)
@@ -119,6 +327,24 @@ int debugTimer=0;
 //  }
 //}
 void storePkt(void){
+#if UART_WORD_COMPRESSION
+  const char* message;
+  
+  PROFILE_BEGIN(PROF_STORE_PKT);
+  pkt_received_flag = FALSE;
+  NVIC_DisableIRQ(UART_IRQn);         //UART_Int_Handler() is writing rxDropMessage
+    message = rxDropMessage;
+    rxDropMessage = NULL;
+  NVIC_EnableIRQ(UART_IRQn);
+  if (message != NULL)
+    dma_printf(message);
+#if ENTROPY_CODING
+  //last packet is open, UART_Int_Handler() is appending words to it
+  while (entropyNext + 1 < pktMemory[actualRxBuffer].numOfPkt)
+    entropyPkt(entropyNext++);
+#endif
+  PROFILE_END(PROF_STORE_PKT);
+#else
   uint8_t pktNum, *destPtr, *sourcePtr, pingPong;
   uint8_t buf[PACKET_MEMORY_DEPTH];///////////////////////<<<<<<<<<<<<<<<<
   #if COMPRESSION
@@ -127,6 +353,7 @@ void storePkt(void){
   #endif
   uint16_t bufferLen, wordLen = 0;
   
+  PROFILE_BEGIN(PROF_STORE_PKT);
   pingPong = rxPingPong;
   pingPong++;
   if(pingPong >= 2)
@@ -138,11 +365,22 @@ void storePkt(void){
 #else
   if (bufferLen >= UART_BUFFER_DEEPTH - HEAD_LENGHT){//if packet is longer as supported drop packet
 #endif
+  TELEMETRY_ADD(dropLong, 1);
   dma_printf("\npkt too Long#");
+  PROFILE_END(PROF_STORE_PKT);
   return;
   }
   
   sourcePtr = &rxUARTbuffer[pingPong][0];
+#if UWB_COMPRESSION
+  PROFILE_BEGIN(PROF_COMPRESSION);
+  bufferLen = hexaToBinaryCompression( sourcePtr, uwbBuffer, bufferLen);
+  PROFILE_END(PROF_COMPRESSION);
+  packWords(uwbBuffer, bufferLen);
+  pkt_received_flag = FALSE;
+  PROFILE_END(PROF_STORE_PKT);
+  return;
+#endif
   pktNum = pktMemory[actualRxBuffer].numOfPkt;
   
   if (pktNum < NUM_OF_PACKETS_IN_MEMORY){     //copy to memory
@@ -152,7 +390,9 @@ void storePkt(void){
     //bufferLen = hexaToBinaryCompression( sourcePtr, destPtr, bufferLen);
 //    send(sourcePtr, bufferLen);
 //    putchar('\n');
+    PROFILE_BEGIN(PROF_COMPRESSION);
     bufferLen = hexaToBinaryCompression( sourcePtr, destPtr, bufferLen);
+    PROFILE_END(PROF_COMPRESSION);
 //    bufferLen = binaryToHexaDecompression( buf, 
 //                                    destPtr, 
 //                                    bufferLen);
@@ -172,12 +412,18 @@ void storePkt(void){
 #endif
     
     pktMemory[actualRxBuffer].lenghtOfPkt[pktNum] = bufferLen;
+#if ENTROPY_CODING
+    entropyPkt(pktNum);
+#endif
     pktMemory[actualRxBuffer].numOfPkt++;
   }
   else{
+    TELEMETRY_ADD(dropFull, 1);
     dma_printf("\npacket memory is full #");
   }
   pkt_received_flag = FALSE;
+  PROFILE_END(PROF_STORE_PKT);
+#endif
 }
 
 
@@ -193,8 +439,10 @@ void storePkt(void){
             output port P1.0/P1.1
 **/
 void uart_init(void){
+#if !UART_WORD_COMPRESSION
   rxPingPong++;   // ==1
   rxPktPtr = &rxUARTbuffer[rxPingPong][0];
+#endif
   
   UrtLinCfg(0,UART_BAUD_RATE_SLAVE,COMLCR_WLS_8BITS,COMLCR_STOP_DIS);//configure uart
   DioCfg(pADI_GP1,0x9);         // UART functionality on P1.0/P1.1
@@ -203,6 +451,7 @@ void uart_init(void){
   NVIC_EnableIRQ(UART_IRQn);    // setup to receive data using interrupts
   
   DmaInit();                    // initialize dma channel
+  NVIC_EnableIRQ ( DMA_UART_TX_IRQn );    // end of transfer clears dmaTx_flag
 
 }
 
@@ -264,9 +513,13 @@ void changeRadioConf(void){
         dmaSend(dmaTxBuffer,len);
    @endcode
    @note    after end of transmision is called DMA_UART_TX_Int_Handler (void)
+   @note    waits for end of previous transfer, buff must be valid until
+            dmaTx_flag is cleared
    @see DMA_UART_TX_Int_Handler
 **/
 void  dmaSend(void* buff, int len){
+    while(dmaTx_flag);    //wait for dma transfer done
+    dmaTx_flag = TRUE;
     //DMA UART stream
     DmaChanSetup(UARTTX_C,ENABLE,ENABLE);   // Enable DMA channel  
     DmaTransferSetup(UARTTX_C,len,buff);
@@ -328,6 +581,7 @@ int8_t radioSend(void* buff, uint8_t len){
     if (len > 240)
       return -1; //if packet is longer than 240 bytes
     RIE_Response = RadioTxPacketVariableLen(len, (uint8_t*)buff); 
+    TELEMETRY_ADD(radioTx, len);
     RX_flag = FALSE;
   }
   
@@ -408,6 +662,7 @@ uint8_t rf_printf(const char * format /*format*/, ...){
 **/
 uint8_t radioRecieve(void){    //pocka na prijatie jedneho paketu
   uint16_t timeout_timer = 0;
+  PROFILE_BEGIN(PROF_RADIO_RECIEVE);
   //if in radiocontrolller ocuured some problem
   if (RIE_Response != RIE_Success)
     radioInit();
@@ -423,6 +678,7 @@ uint8_t radioRecieve(void){    //pocka na prijatie jedneho paketu
       //turn on led if nothing is received after timeout
       if (timeout_timer > T_TIMEOUT){
         //LED_ON;
+        PROFILE_END(PROF_RADIO_RECIEVE);
         return 0;
       }
 
@@ -435,8 +691,12 @@ uint8_t radioRecieve(void){    //pocka na prijatie jedneho paketu
   
   //LED_ON;
   //citanie paketu z rf kontrolera
+  PROFILE_BEGIN(PROF_RX_PACKET_READ);
   if (RIE_Response == RIE_Success)
     RIE_Response = RadioRxPacketRead(sizeof(Buffer),&PktLen,Buffer,&RSSI);
+  PROFILE_END(PROF_RX_PACKET_READ);
+  if (RIE_Response == RIE_Success)
+    TELEMETRY_ADD(radioRx[0], PktLen);
   //LED_OFF;
   
     //DMA UART stream
@@ -449,6 +709,7 @@ uint8_t radioRecieve(void){    //pocka na prijatie jedneho paketu
     RIE_Response = RadioRxPacketVariableLen();   
     RX_flag = TRUE;
   }
+  PROFILE_END(PROF_RADIO_RECIEVE);
   return 1;
 }
 
@@ -469,6 +730,22 @@ void setTimeToSync(uint16_t time){
   NVIC_EnableIRQ(TIMER0_IRQn);
 }
 
+#if TELEMETRY
+/** 
+   @fn     void setTelemetryTimer(void)
+   @brief  set general purpose timer1 for period of telemetry
+   @see    void GP_Tmr1_Int_Handler ()
+   @note   timer predivider factor = 256, processor clock, periodic mode
+**/
+void setTelemetryTimer(void){
+  GptLd (pADI_TM1, TELEMETRY_INTERVAL);
+  GptCfg(pADI_TM1, TCON_CLK_UCLK, TCON_PRE_DIV256, TCON_ENABLE_EN|TCON_RLD_EN|TCON_MOD_PERIODIC);
+  while (GptSta(pADI_TM1)& TSTA_CON);   // wait for sync of TCON write. required because of use of asynchronous clock
+  GptClrInt(pADI_TM1,TCLRI_TMOUT);
+  while (GptSta(pADI_TM1)& TSTA_CLRI);  // wait for sync of TCLRI write. required because of use of asynchronous clock
+  NVIC_EnableIRQ(TIMER1_IRQn);
+}
+#endif
 
 /** 
    @fn     uint8_t transmit(void)
@@ -494,6 +771,12 @@ uint8_t transmit(void){
       actualTxBuffer = 0;
     
     pktMemory[actualRxBuffer].numOfPkt = 0;
+#if UART_WORD_COMPRESSION && ENTROPY_CODING
+    entropyNext = 0;
+#endif
+#if TEXT_DICTIONARY
+    textEncoderReset();                 //window of words of next superframe
+#endif
   NVIC_EnableIRQ(UART_IRQn);  
   
   while (my_slot == TRUE && (txPkt < pktMemory[actualTxBuffer].numOfPkt) ){     //while interupt ocurs send avaliable packets
@@ -503,7 +786,11 @@ uint8_t transmit(void){
     //build head of packet
     pktMemoryPtr[2] = pktMemory[actualTxBuffer].numOfPkt + CHAR_OFFSET;
     pktMemoryPtr[1] = txPkt + CHAR_OFFSET + 1;
+#if ENTROPY_CODING
+    pktMemoryPtr[0] = (pktMemoryPtr[0] & ENTROPY_HEAD_MASK) | (SLAVE_ID + CHAR_OFFSET);  //keep ID of table
+#else
     pktMemoryPtr[0] = SLAVE_ID + CHAR_OFFSET; 
+#endif
 
     //dma_printf(pktMemoryPtr);
     if (radioSend(pktMemoryPtr,(pktMemory[actualTxBuffer].lenghtOfPkt[txPkt]+HEAD_LENGHT)))//send packet
@@ -532,6 +819,7 @@ uint8_t retransmit(void){
     radioSend(&pktMemory[actualTxBuffer].packet[pkt][0],(pktMemory[actualTxBuffer].lenghtOfPkt[pkt]+3));
     pkt++;
   }
+  TELEMETRY_ADD(retx, pkt-3);
   return (pkt-3);
 }
 /** 
@@ -570,6 +858,9 @@ void fill_memory(void){
   
   for (i = 0; i < NUM_OF_PACKETS_IN_MEMORY; i++){
     pktptr = &pktMemory[actualRxBuffer].packet[i][0];
+#if ENTROPY_CODING
+    pktptr[0] = 0;                        //not coded
+#endif
     len = HEAD_LENGHT;
     while(len < (PACKET_MEMORY_DEPTH-HEAD_LENGHT)-(sizeof(struct PRNGslave)*2) ){
       PRNGnew(&slavePRNG);
@@ -592,30 +883,60 @@ void fill_memory(void){
    @note   programmer CM3WSD is located in "Integrity" folder
    @code   ::code in conv.bat
    @pre    for right generation of .hex file must be call script Integrity.bat located in Integrity folder
+           (FeeSign.bat if FEE_SIGN, expected signature of flash controller instead of CRC)
 */
 void checkIntegrityOfFirmware(void){
+  #ifndef BEGIN_OF_CODE_MEMORY
   #define BEGIN_OF_CODE_MEMORY    (uint8_t *)0x0  // pointer at begining of code memory
+  #endif
   #define LENGHT_OF_CODE_MEMORY   0x20000         // end of code memory
 /*
 512(bytes is one page)*256(pages) = 131072 = 0x20000
 */
 
   crc retval;
+  #if FEE_SIGN
+  int status;
+  #endif
   
-  #if CRC_FAST
-    crcInit();
-  //the reason why use crcSlow is that crcFast is using much more memory
+  PROFILE_BEGIN(PROF_INTEGRITY);
+  #if FEE_SIGN
+    //Sign command of flash controller, it is comparing signature with last 4 bytes of FLASH
+    while (FeeSign(0, LENGHT_OF_CODE_MEMORY - 1) == 0);
+    while ((status = FeeSta()) & FEESTA_CMDBUSY);
+    retval = ((status & FEESTA_CMDRES_MSK) != FEESTA_CMDRES_SUCCESS);
+  #elif CRC_FAST
     retval = crcFast(BEGIN_OF_CODE_MEMORY,LENGHT_OF_CODE_MEMORY);
+  #elif CRC_NIBBLE
+    retval = crcNibble(BEGIN_OF_CODE_MEMORY,LENGHT_OF_CODE_MEMORY);
   #else
     retval = crcSlow(BEGIN_OF_CODE_MEMORY,LENGHT_OF_CODE_MEMORY);
   #endif
+  PROFILE_END(PROF_INTEGRITY);
+  #if PROFILING
+  //CRC functions over one packet
+  PROFILE_BEGIN(PROF_CRC_SLOW);
+  crcSlow(BEGIN_OF_CODE_MEMORY,PACKET_MEMORY_DEPTH);
+  PROFILE_END(PROF_CRC_SLOW);
+  PROFILE_BEGIN(PROF_CRC_NIBBLE);
+  crcNibble(BEGIN_OF_CODE_MEMORY,PACKET_MEMORY_DEPTH);
+  PROFILE_END(PROF_CRC_NIBBLE);
+  PROFILE_BEGIN(PROF_CRC_FAST);
+  crcFast(BEGIN_OF_CODE_MEMORY,PACKET_MEMORY_DEPTH);
+  PROFILE_END(PROF_CRC_FAST);
+  #endif
   
   if (retval == 0){
     dma_printf("\nintegrity check ok#");
     LED_ON;
   }
   else{
-    dma_printf("\nproblem in integrity of firmware #");  
+    #if FEE_SIGN
+    //one transfer, second dma_printf() would reuse buff of first one
+    dma_printf("\nproblem in integrity of firmware #\nsignature of firmware %06X#", FeeSig());
+    #else
+    dma_printf("\nproblem in integrity of firmware #");
+    #endif
     LED_OFF;
     //while(1);
   }
@@ -636,8 +957,17 @@ int main(void)
   //initialize all interfaces
   SetInterruptPriority();
   uart_init();
+  #if PROFILING
+  profileInit();
+  #endif
   checkIntegrityOfFirmware();
   led_init();
+  #if RADIO_CAPTURE
+  radioCaptureInit();
+  #endif
+  #if TELEMETRY
+  setTelemetryTimer();
+  #endif
   
   radioInit();    //inicialize radio conection
   
@@ -648,8 +978,11 @@ int main(void)
       //if this slot identifier belongs to this slave
       if ( 0 == strcmp((char*)Buffer,TIME_SLOT_ID_SLAVE)){
         close_packet_flag = TRUE;
-        if(pktMemory[actualRxBuffer].numOfPkt)    //if is something to send
+        TELEMETRY_ADD(slots, 1);
+        if(pktMemory[actualRxBuffer].numOfPkt){   //if is something to send
+          TELEMETRY_ADD(slotsUsed, 1);
           transmit();
+        }
         else
           radioSend(ZERO_PACKET, 4);    //send zero packet meanin nothing to send
       }
@@ -666,6 +999,22 @@ int main(void)
       if (0 == memcmp(Buffer,"FREQ",4))
         changeRadioConf();
       
+      #if PROFILING
+      //check if request to print table of profiled sections
+      if (0 == memcmp(Buffer,"PROF",4)){
+        profileDump();
+        profileReset();
+      }
+      #endif
+      
+      #if RADIO_CAPTURE
+      //check if request to print captured radio frames
+      if (0 == memcmp(Buffer,"CAPT",4)){
+        radioCaptureDump();
+        radioCaptureReset();
+      }
+      #endif
+      
       //check if message
       if (Buffer[0] == '#')
         dma_printf((char *)Buffer);
@@ -702,7 +1051,13 @@ int main(void)
     if ((PRNG_data == TRUE) && memory_full_flag == FALSE )
       fill_memory();
     #endif
-
+    
+    #if TELEMETRY
+    //status frame of last period
+    if (telemetry_flag == TRUE){
+      dmaSend(telemetryBuffer, telemetryFrame(SLAVE_ID));
+    }
+    #endif
   }
   
 }
@@ -738,11 +1093,16 @@ void GP_Tmr0_Int_Handler(void){
 ///////////////////////////////////////////////////////////////////////////
 /** 
     @fn      void GP_Tmr1_Int_Handler (void)
-    @brief   Interrupt handler for timer1 already unused
+    @brief   Interrupt handler for period of telemetry
+    @see     setTelemetryTimer()
 **/
 void GP_Tmr1_Int_Handler(void){
   if (GptSta(pADI_TM1)== TSTA_TMOUT) // if timout interrupt
   { 
+    GptClrInt(pADI_TM1,TCLRI_TMOUT);
+  #if TELEMETRY
+    telemetryTick();    // snapshot of counters, frame is printed in main loop
+  #endif
   }
 }
 
@@ -757,9 +1117,12 @@ void GP_Tmr1_Int_Handler(void){
 **/
 void DMA_UART_TX_Int_Handler ()
 {
+  PROFILE_BEGIN(PROF_DMA_TX_ISR);
   UrtDma(0,COMIEN_EDMAR);  // prevents further UART DMA requests
   // Disable DMA channel
   DmaChanSetup ( UARTTX_C , DISABLE , DISABLE );
+  dmaTx_flag = FALSE;
+  PROFILE_END(PROF_DMA_TX_ISR);
 }
 ///////////////////////////////////////////////////////////////////////////
 // DMA UART Interrupt handler 
@@ -802,12 +1165,15 @@ void HardFault_Handler(void) {
     @brief   Interrupt handler managing store received data trought UART
               - string mode = appedning chars untill STRING_TERMINATOR is received 
               - binary mode = appending untill buffer is full == 240 == PACKETRAM_LEN chars
+              - UART_WORD_COMPRESSION = word is compressed by storeWord() into
+                packet memory when STRING_TERMINATOR is received
     @see     STRING_TERMINATOR
 **/
 void UART_Int_Handler (void)
 {   
   uint8_t ch; 
 
+  PROFILE_BEGIN(PROF_UART_ISR);
   ch  = UrtRx(0);           //call UrtRd() clears COMIIR_STA_RXBUFFULL
   
   // check if framing error == uart is correctly synchronized
@@ -815,9 +1181,29 @@ void UART_Int_Handler (void)
     DioCfgPin(pADI_GP1,PIN0,0); // turn off RxD function at pin for a moment
     while(ch--);                //random waiting time
     DioCfgPin(pADI_GP1,PIN0,1); // turn on RxD function at pin
+    PROFILE_END(PROF_UART_ISR);
     return;
   }
   
+  TELEMETRY_ADD(uart, 1);
+#if UART_WORD_COMPRESSION
+  if (ch == STRING_TERMINATOR){
+    if (rxUARTcount < UART_WORD_DEEPTH){
+      rxWord[rxUARTcount] = ch;
+      storeWord(rxUARTcount + 1);
+    }
+    else{                               //word is longer as supported, drop word
+      TELEMETRY_ADD(dropLong, 1);
+      rxDropMessage = "\npkt too Long#";
+      pkt_received_flag = TRUE;
+    }
+    rxUARTcount = 0;
+  }
+  else if (rxUARTcount < UART_WORD_DEEPTH)
+    rxWord[rxUARTcount++] = ch;         //rxUARTcount stops at UART_WORD_DEEPTH when word is too long
+  PROFILE_END(PROF_UART_ISR);
+  return;
+#else
   *rxPktPtr = ch;
   rxUARTcount++;
   
@@ -857,6 +1243,8 @@ void UART_Int_Handler (void)
     }
     rxUARTbufferLen[rxPingPong] = rxUARTcount;
   }
+  PROFILE_END(PROF_UART_ISR);
+#endif
 } 
 
 
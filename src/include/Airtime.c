@@ -0,0 +1,71 @@
+#include "radioeng.h"
+#include "Airtime.h"
+
+/**
+   @fn     uint32_t airtimeDataRate(RIE_BaseConfigs BaseConfig)
+   @brief  data rate of base configuration
+   @param  RIE_BaseConfigs BaseConfig : configuration passed to RadioInit()
+   @return uint32_t - bits per second, 0 if configuration is unsupported
+**/
+uint32_t airtimeDataRate(RIE_BaseConfigs BaseConfig)
+{
+  switch (BaseConfig){
+    case DR_1_0kbps_Dev10_0kHz:   return 1000;
+    case DR_38_4kbps_Dev20kHz:    return 38400;
+    case DR_300_0kbps_Dev75_0kHz: return 300000;
+    default:                      return 0;
+  }
+}
+
+/**
+   @fn     static uint32_t bitsToUs(RIE_BaseConfigs BaseConfig, uint32_t bits)
+   @brief  duration of bits at data rate of configuration, rounded up
+   @note   max frame 4240 bits * 1000000 still fits into 32 bits,
+           64 bit division is not needed on Cortex-M3
+**/
+static uint32_t bitsToUs(RIE_BaseConfigs BaseConfig, uint32_t bits)
+{
+  uint32_t rate = airtimeDataRate(BaseConfig);
+
+  if (rate == 0)
+    return 0;
+  return (bits * 1000000UL + rate - 1) / rate;
+}
+
+/**
+   @fn     uint32_t airtimeUs(RIE_BaseConfigs BaseConfig, RIE_BOOL Manchester, uint8_t Len)
+   @brief  duration of variable length packet on air
+   @param  RIE_BaseConfigs BaseConfig : configuration passed to RadioInit()
+   @param  RIE_BOOL Manchester : RadioPayldManchesterEncode() is enabled
+   @param  uint8_t Len : lenght of payload passed to RadioTxPacketVariableLen()
+   @return uint32_t - microseconds from first bit of preamble to last bit of CRC,
+           0 if configuration is unsupported
+**/
+uint32_t airtimeUs(RIE_BaseConfigs BaseConfig, RIE_BOOL Manchester, uint8_t Len)
+{
+  return bitsToUs(BaseConfig, AIRTIME_BITS(Len, Manchester == RIE_TRUE));
+}
+
+/**
+   @fn     uint32_t airtimePreambleUs(RIE_BaseConfigs BaseConfig)
+   @brief  duration of preamble
+   @param  RIE_BaseConfigs BaseConfig : configuration passed to RadioInit()
+   @return uint32_t - microseconds, 0 if configuration is unsupported
+**/
+uint32_t airtimePreambleUs(RIE_BaseConfigs BaseConfig)
+{
+  return bitsToUs(BaseConfig, AIRTIME_PREAMBLE_LEN * 8);
+}
+
+/**
+   @fn     uint32_t airtimeResponseUs(RIE_BaseConfigs BaseConfig, RIE_BOOL Manchester, uint8_t Len)
+   @brief  time from end of request to end of response of other device
+   @param  RIE_BaseConfigs BaseConfig : configuration passed to RadioInit()
+   @param  RIE_BOOL Manchester : RadioPayldManchesterEncode() is enabled
+   @param  uint8_t Len : lenght of payload of response
+   @return uint32_t - microseconds, TX turnaround and airtime of response
+**/
+uint32_t airtimeResponseUs(RIE_BaseConfigs BaseConfig, RIE_BOOL Manchester, uint8_t Len)
+{
+  return AIRTIME_TX_TURNAROUND_US + airtimeUs(BaseConfig, Manchester, Len);
+}
@@ -0,0 +1,91 @@
+/**
+ *****************************************************************************
+   @file     Airtime.h
+   @brief    on air time of variable lenght packet of radio interface engine
+             used to derive timeouts, guard times and slot budgets
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    frame of ADF7023 packet handler (radioeng.c configuration)
+              - preamble 12 bytes (register 0x11D)
+              - sync word 16 bits (SYNC_CONTROL)
+              - length byte of variable length packet
+              - payload
+              - CRC 16 bits
+            Manchester encoding doubles length byte, payload and CRC
+   @note    macros are constant expressions for compile-time settings,
+            functions are for configuration known at run time (radioConf)
+   @note    radioeng.h has no include guard, include it before this file
+**/
+#ifndef __AIRTIME_H
+#define __AIRTIME_H
+
+#include <stdint.h>
+
+/** @brief preamble 12 bytes (register 0x11D) **/
+#define AIRTIME_PREAMBLE_LEN      12
+/** @brief sync word 16 bits (SYNC_CONTROL) **/
+#define AIRTIME_SYNC_WORD_LEN     2
+/** @brief length byte of variable length packet **/
+#define AIRTIME_LENGTH_BYTE_LEN   1
+/** @brief hardware CRC 16 bits **/
+#define AIRTIME_CRC_LEN           2
+/** @brief time from TX command to begining of preamble (synthesizer settling) **/
+#define AIRTIME_TX_TURNAROUND_US  150
+
+/** @brief bits per second of base configuration, the same values as SetRadioConfiguration() **/
+#define AIRTIME_DATA_RATE(BaseConfig) \
+  ((BaseConfig) == DR_1_0kbps_Dev10_0kHz ? 1000UL : \
+   (BaseConfig) == DR_38_4kbps_Dev20kHz  ? 38400UL : 300000UL)
+
+/** @brief bits of frame on air with payload of Len bytes **/
+#define AIRTIME_BITS(Len, Manchester) \
+  ((AIRTIME_PREAMBLE_LEN + AIRTIME_SYNC_WORD_LEN + \
+   (AIRTIME_LENGTH_BYTE_LEN + (uint32_t)(Len) + AIRTIME_CRC_LEN) * ((Manchester) ? 2 : 1)) * 8UL)
+
+/** @brief microseconds of frame on air, rounded up **/
+#define AIRTIME_US(BaseConfig, Manchester, Len) \
+  ((uint32_t)((AIRTIME_BITS(Len, Manchester) * 1000000ULL + AIRTIME_DATA_RATE(BaseConfig) - 1) \
+   / AIRTIME_DATA_RATE(BaseConfig)))
+
+/**
+   @fn     uint32_t airtimeDataRate(RIE_BaseConfigs BaseConfig)
+   @brief  data rate of base configuration
+   @param  RIE_BaseConfigs BaseConfig : configuration passed to RadioInit()
+   @return uint32_t - bits per second, 0 if configuration is unsupported
+**/
+uint32_t airtimeDataRate(RIE_BaseConfigs BaseConfig);
+
+/**
+   @fn     uint32_t airtimeUs(RIE_BaseConfigs BaseConfig, RIE_BOOL Manchester, uint8_t Len)
+   @brief  duration of variable length packet on air
+   @param  RIE_BaseConfigs BaseConfig : configuration passed to RadioInit()
+   @param  RIE_BOOL Manchester : RadioPayldManchesterEncode() is enabled
+   @param  uint8_t Len : lenght of payload passed to RadioTxPacketVariableLen()
+   @return uint32_t - microseconds from first bit of preamble to last bit of CRC,
+           0 if configuration is unsupported
+**/
+uint32_t airtimeUs(RIE_BaseConfigs BaseConfig, RIE_BOOL Manchester, uint8_t Len);
+
+/**
+   @fn     uint32_t airtimePreambleUs(RIE_BaseConfigs BaseConfig)
+   @brief  duration of preamble
+   @param  RIE_BaseConfigs BaseConfig : configuration passed to RadioInit()
+   @return uint32_t - microseconds, 0 if configuration is unsupported
+   @note   receiver switched into RX later than in first half of preamble
+           is missing sync word of packet
+**/
+uint32_t airtimePreambleUs(RIE_BaseConfigs BaseConfig);
+
+/**
+   @fn     uint32_t airtimeResponseUs(RIE_BaseConfigs BaseConfig, RIE_BOOL Manchester, uint8_t Len)
+   @brief  time from end of request to end of response of other device
+   @param  RIE_BaseConfigs BaseConfig : configuration passed to RadioInit()
+   @param  RIE_BOOL Manchester : RadioPayldManchesterEncode() is enabled
+   @param  uint8_t Len : lenght of payload of response
+   @return uint32_t - microseconds, TX turnaround and airtime of response
+**/
+uint32_t airtimeResponseUs(RIE_BaseConfigs BaseConfig, RIE_BOOL Manchester, uint8_t Len);
+
+#endif
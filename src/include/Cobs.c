@@ -0,0 +1,87 @@
+#include <string.h>
+#include "../settings.h"
+#include "../../Integrity/crc.h"
+#include "Cobs.h"
+
+/**
+   @brief  CRC of record by function selected in settings.h (CRC_FAST,
+           CRC_NIBBLE)
+   @note   complemented in record (as FCS of HDLC), with plain CRC the record
+           ending by CRC low byte 0x00 stays valid if last byte of its frame
+           is lost
+**/
+#if CRC_FAST
+#define recordCrc(record, len)  crcFast(record, len)
+#elif CRC_NIBBLE
+#define recordCrc(record, len)  crcNibble(record, len)
+#else
+#define recordCrc(record, len)  crcSlow(record, len)
+#endif
+
+uint16_t cobsEncode(const uint8_t* input, uint16_t len, uint8_t* output)
+{
+  uint8_t *code = output, *out = output + 1;
+  const uint8_t *end = input + len;
+
+  *code = 1;
+  while (input < end){
+    if (*input == COBS_DELIMITER){
+      code = out++;                     // delimiter is replaced by code of next block
+      *code = 1;
+    }
+    else{
+      *out++ = *input;
+      if (++*code == 0xFF && input + 1 < end){
+        code = out++;                   // block of 254 bytes without delimiter
+        *code = 1;
+      }
+    }
+    input++;
+  }
+  return out - output;
+}
+
+uint16_t cobsDecode(const uint8_t* input, uint16_t len, uint8_t* output)
+{
+  const uint8_t *end = input + len;
+  uint8_t *out = output;
+  uint8_t code, i;
+
+  while (input < end){
+    code = *input++;
+    if (code == COBS_DELIMITER || code - 1 > end - input)
+      return 0;
+    for (i = 1; i < code; i++){
+      if (*input == COBS_DELIMITER)
+        return 0;
+      *out++ = *input++;
+    }
+    if (code != 0xFF && input < end)
+      *out++ = COBS_DELIMITER;          // end of block was delimiter
+  }
+  return out - output;
+}
+
+uint16_t recordEncode(uint8_t* record, uint16_t payloadLen, uint8_t* frame)
+{
+  uint16_t len = RECORD_HEAD + payloadLen;
+  crc sum = (crc)~recordCrc(record, len);
+
+  record[len] = sum >> 8;
+  record[len + 1] = sum & 0xFF;
+  frame[0] = COBS_DELIMITER;
+  len = cobsEncode(record, len + RECORD_CRC, &frame[1]) + 1;
+  frame[len] = COBS_DELIMITER;
+  return len + 1;
+}
+
+uint16_t recordDecode(const uint8_t* frame, uint16_t len, uint8_t* record)
+{
+  len = cobsDecode(frame, len, record);
+  if (len < RECORD_HEAD + RECORD_CRC)
+    return 0;
+  len -= RECORD_CRC;
+  if ((crc)~recordCrc(record, len) != (crc)((record[len] << 8) | record[len + 1]))
+    return 0;
+  return len;
+}
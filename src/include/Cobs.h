@@ -0,0 +1,92 @@
+/**
+ *****************************************************************************
+   @file     Cobs.h
+   @brief    binary records of master UART output framed by COBS
+             (consistent overhead byte stuffing)
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    enabled by BINARY_OUTPUT in settings.h, master is sending
+            payloads of packets without decompression to hexadecimal words,
+            PktReader -binary is decompressing them
+   @note    record is [slave ID][packet number][payload][CRC high][CRC low],
+            complemented CRC-CCITT (Integrity/crc.c) of slave ID, packet number
+            and payload,
+            missing packet is record without payload
+   @note    frame is COBS_DELIMITER, COBS of record and COBS_DELIMITER, record
+            do not contain delimiter, text messages of master (dma_printf())
+            are between frames
+   @code
+        // master
+        record[0] = slaveId;
+        record[1] = packetNumber;
+        memcpy(&record[RECORD_HEAD], payload, len);
+        dmaSend(frame, recordEncode(record, len, frame));
+        // PktReader, bytes between delimiters
+        if ((len = recordDecode(frame, frameLen, record)) != 0)
+          binaryToHexaDecompression(&record[RECORD_HEAD], hexa, len - RECORD_HEAD);
+   @endcode
+**/
+#ifndef __COBS_H
+#define __COBS_H
+
+#include <stdint.h>
+#include "../settings.h"
+
+/** @brief byte separating frames, it is not in COBS output **/
+#define COBS_DELIMITER      0x00
+/** @brief longest COBS output of len bytes **/
+#define COBS_MAX_LEN(len)   ((len) + (len) / 254 + 1)
+
+/** @brief slave ID and packet number **/
+#define RECORD_HEAD         2
+/** @brief complemented CRC-CCITT behind payload **/
+#define RECORD_CRC          2
+/** @brief longest frame of packet with delimiters **/
+#define RECORD_MAX_FRAME    (COBS_MAX_LEN(RECORD_HEAD + PACKET_MEMORY_DEPTH + RECORD_CRC) + 2)
+
+/**
+   @fn     uint16_t cobsEncode(const uint8_t* input, uint16_t len, uint8_t* output)
+   @brief  COBS of data, without delimiter
+   @param  const uint8_t* input : data
+   @param  uint16_t len : lenght of data
+   @param  uint8_t* output : destination of COBS_MAX_LEN(len) bytes (not overlapping input)
+   @return uint16_t - lenght of output
+**/
+uint16_t cobsEncode(const uint8_t* input, uint16_t len, uint8_t* output);
+
+/**
+   @fn     uint16_t cobsDecode(const uint8_t* input, uint16_t len, uint8_t* output)
+   @brief  data of COBS output
+   @param  const uint8_t* input : bytes between delimiters
+   @param  uint16_t len : number of bytes
+   @param  uint8_t* output : destination of len - 1 bytes
+   @return uint16_t - lenght of data, 0 if input is broken (delimiter, code
+           behind end of input)
+**/
+uint16_t cobsDecode(const uint8_t* input, uint16_t len, uint8_t* output);
+
+/**
+   @fn     uint16_t recordEncode(uint8_t* record, uint16_t payloadLen, uint8_t* frame)
+   @brief  CRC to record and frame of record with delimiters
+   @param  uint8_t* record : slave ID, packet number and payload, RECORD_CRC
+           bytes behind payload are written
+   @param  uint16_t payloadLen : lenght of payload, 0 is missing packet
+   @param  uint8_t* frame : destination of RECORD_MAX_FRAME bytes
+   @return uint16_t - lenght of frame
+**/
+uint16_t recordEncode(uint8_t* record, uint16_t payloadLen, uint8_t* frame);
+
+/**
+   @fn     uint16_t recordDecode(const uint8_t* frame, uint16_t len, uint8_t* record)
+   @brief  record of frame, CRC is checked
+   @param  const uint8_t* frame : bytes between delimiters
+   @param  uint16_t len : number of bytes
+   @param  uint8_t* record : destination of len - 1 bytes
+   @return uint16_t - lenght of record without CRC (RECORD_HEAD for missing
+           packet), 0 if frame is broken
+**/
+uint16_t recordDecode(const uint8_t* frame, uint16_t len, uint8_t* record);
+
+#endif
@@ -51,6 +51,14 @@ to ensure that the resulting application performs as required and is safe.
 #include "crc.h"
 #include "PRNG.h"
 #include "Compression.h"
+#include "Airtime.h"
+#include "Profile.h"
+#include "RadioCapture.h"
+#include "Telemetry.h"
+#include "UwbCodec.h"
+#include "Entropy.h"
+#include "TextDict.h"
+#include "Cobs.h"
 
 
 
@@ -828,6 +828,8 @@ RIE_Responses RadioTxPacketVariableLen(RIE_U8 Len, RIE_U8 *pData)
       Response = RadioToOnMode();
    if (Response == RIE_Success)
       Response = RadioSendCommandWait(CMD_PHY_TX);
+   if (Response == RIE_Success)
+      RADIO_CAPTURE_FRAME(RADIO_CAPTURE_TX, pData, Len-1, 0);
 
    return Response;
 }
@@ -1151,6 +1153,8 @@ RIE_Responses RadioRxPacketRead(RIE_U8 BufferLen,RIE_U8 *pPktLen,RIE_U8 *pData,R
 
          *pRSSIdBm -= 107; // Convert to dBm
          }
+      if (Response == RIE_Success)
+         RADIO_CAPTURE_FRAME(RADIO_CAPTURE_RX, pData, RdLen, pRSSIdBm ? *pRSSIdBm : 0);
 
       }
    else
@@ -33,7 +33,9 @@ Functions and examples still work in progress. Check for updates regularly.
 
 **/
 
+#ifndef RIE_U32          // host build (LP64) redefine it to 32 bit type
 #define RIE_U32 unsigned long
+#endif
 #define RIE_U16 unsigned short int
 #define RIE_U8  unsigned char
 #define RIE_S8  signed char
@@ -1,10 +1,79 @@
 
-#include "..\settings.h"
+#include "../settings.h"
 #include "Compression.h"
+#if UWB_COMPRESSION
+#include "UwbCodec.h"
+#endif
+#if TEXT_DICTIONARY
+#include "TextDict.h"
+#endif
 #include "stdio.h"
 #include <string.h>
 
 
+/** @brief mark of char which is not hexadecimal in hexaTable (also STRING_TERMINATOR) **/
+#define NOT_HEXA  0x10
+/** @brief mark of lowercase hexadecimal char, not hexadecimal for format v1 **/
+#define LOWER_HEXA 0x20
+#define NOT_HEXA_V1 (NOT_HEXA | LOWER_HEXA)
+#define NH        NOT_HEXA
+#define LH        LOWER_HEXA
+
+/**
+   @brief  value of hexadecimal chars '0'-'9' and 'A'-'F', 'a'-'f' with LOWER_HEXA,
+           NOT_HEXA for other chars
+   @note   one load is classifying and converting char (table is in flash)
+**/
+static const uint8_t hexaTable[256] = {
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x00 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x10 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x20 */
+   0, 1, 2, 3, 4, 5, 6, 7, 8, 9,NH,NH,NH,NH,NH,NH,  /* 0x30 */
+  NH,10,11,12,13,14,15,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x40 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x50 */
+  NH,LH|10,LH|11,LH|12,LH|13,LH|14,LH|15,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x60 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x70 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x80 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0x90 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0xA0 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0xB0 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0xC0 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0xD0 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,  /* 0xE0 */
+  NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH,NH   /* 0xF0 */
+};
+#undef NH
+#undef LH
+
+#if ADAPTIVE_COMPRESSION && !COMPRESSION_V2
+/**
+   @fn     static uint16_t copyWords(uint8_t * hexaInput, uint8_t * binaryOutput, uint8_t * end)
+   @brief  copy rest of words without translation, flag 0 before each word
+   @param  uint8_t * hexaInput : first char of first not hexadecimal word
+   @param  uint8_t * binaryOutput : place of flag of first word
+   @param  uint8_t * end : end of hexadecimal string
+   @return uint16_t - lenght of output
+   @note   STRING_TERMINATOR of word is overwritten by flag of next word
+**/
+static uint16_t copyWords(uint8_t * hexaInput, uint8_t * binaryOutput, uint8_t * end)
+{
+  uint8_t *output = binaryOutput, *word;
+  uint16_t wordLen;
+
+  do{
+    word = hexaInput;
+    while (hexaInput < end && *hexaInput != STRING_TERMINATOR)
+      hexaInput++;
+    wordLen = hexaInput - word;
+    memcpy(&output[1], word, wordLen + 1);
+    *output = 0;          // 0 is flag for non translated packet
+    output += wordLen + 1;
+    hexaInput++;          // move over STRING_TERMINATOR
+  }while (hexaInput < end);
+  return output - binaryOutput;
+}
+#endif
+
 /**
    @fn     hexaToBinaryCompression
    @brief  converting ASCII hexadecimal words system to binary compressed system
@@ -13,69 +82,234 @@
    @param  uint16_t hexaLen : lenght of hexadecimal string
    @return returning binarz lenght of compressed binary output
    @note   input lenght in source memory place is double lenght as destination lenght
+   @note   one pass, pairs of chars are classified and translated by hexaTable
+           directly behind place of lenght of word, word with odd lenght is
+           dropped, with ADAPTIVE_COMPRESSION is first not hexadecimal word and
+           all following words copied without translation (copyWords())
+   @note   with UWB_COMPRESSION is hexadecimal word of UWB frame coded by
+           uwbEncode() (record UWB_KEY or UWB_DELTA)
 **/
 uint16_t hexaToBinaryCompression( uint8_t * hexaInput, 
                                  uint8_t * binaryOutput, 
                                  uint16_t hexaLen)
 {
-  int16_t binaryLen = 0, processed = 0, wordLen;
-  uint8_t *procesPtr = hexaInput;
-#if ADAPTIVE_COMPRESSION
-  uint8_t hexa = TRUE;
+#if COMPRESSION_V2
+  return hexaToBinaryCompressionV2(hexaInput, binaryOutput, hexaLen);
+#else
+  uint8_t *end = hexaInput + hexaLen;
+  uint8_t *output = binaryOutput, *word, *dest;
+  uint8_t high, low;
+  uint16_t wordLen;
+#if UWB_COMPRESSION
+  uint16_t uwbLen;
 #endif
-  while(1){
-    
-    // get lenght of packet
-    wordLen = 0;
-    while(*procesPtr != STRING_TERMINATOR && processed < hexaLen){
-#if ADAPTIVE_COMPRESSION
-      //check if hexadecimal number (char)
-      if ((*procesPtr < '0' || *procesPtr > '9'))
-        if (*procesPtr < 'A' || *procesPtr > 'F' )
-          hexa = FALSE;
-#endif
-      procesPtr++;
-      wordLen ++;
-      processed ++;
-    }
-    processed ++;
-    procesPtr++;  // move over STRING_TERMINATOR
-    //printf("wordLen %d \n",wordLen);
-#if ADAPTIVE_COMPRESSION   
-    if (hexa){  //if hexadecimal word
-#endif
-      // translate data if lenght number is even
-      if (wordLen % 2){
-        // word is not even number
-        // drop word
-      }
-      else{
-        
-        //translate  from HEXADECIMAL chars to binary data
-        hexaToBin(hexaInput, &binaryOutput[1], wordLen/2);
-        
-        binaryLen += wordLen/2 + 1;
-        
-        *binaryOutput = wordLen/2; // store word lenght
-        binaryOutput += wordLen/2 +1 ;
-      }
+
+  do{
+    word = hexaInput;
+    dest = output + 1;
+
+    // translate pairs of chars until STRING_TERMINATOR or not hexadecimal char
+    while (hexaInput + 1 < end){
+      high = hexaTable[hexaInput[0]];
+      low = hexaTable[hexaInput[1]];
+      if ((high | low) & NOT_HEXA_V1)
+        break;
+      *dest++ = (uint8_t)((high << 4) | low);
+      hexaInput += 2;
+    }
+    if (hexaInput < end && !(hexaTable[*hexaInput] & NOT_HEXA_V1))
+      hexaInput++;          // last char of odd word
+
+    if (hexaInput < end && *hexaInput != STRING_TERMINATOR){
 #if ADAPTIVE_COMPRESSION
-    }else{
-      memcpy(&binaryOutput[1], hexaInput, wordLen+1);
-      
-      binaryLen += wordLen + 1;
+      return (output - binaryOutput) + copyWords(word, output, end);
+#else
+      // translate also not hexadecimal chars like hexaToBin()
+      while (hexaInput < end && *hexaInput != STRING_TERMINATOR)
+        hexaInput++;
+      if ((hexaInput - word) % 2 == 0)
+        hexaToBin(word, output + 1, (hexaInput - word) / 2);
+#endif
+    }
+#if UWB_COMPRESSION
+    else if ((uwbLen = uwbEncode(word, hexaInput - word, output)) != 0){
+      output += uwbLen;
+      hexaInput++;          // move over STRING_TERMINATOR
+      continue;
+    }
+#endif
 
-      *binaryOutput = 0; // 0 is flag for non translated packet
-      binaryOutput += wordLen +1 ;
+    wordLen = hexaInput - word;
+    if (wordLen % 2 == 0){  // word with odd lenght is dropped
+      *output = wordLen / 2; // store word lenght
+      output += wordLen / 2 + 1;
     }
+    hexaInput++;            // move over STRING_TERMINATOR
+  }while (hexaInput < end);
+  return output - binaryOutput;
 #endif
-    hexaInput += wordLen + 1;
-    
-    //break if last word processed
-    if (processed >= hexaLen){
-      return binaryLen;
+}
+
+/**
+   @fn     hexaToBinaryCompressionV2
+   @brief  compress words to blocks of format v2
+   @param  uint8_t * hexaInput : pointer at hexadecimal chars in memory
+   @param  uint8_t * binaryOutput : destination, not overlapping hexaInput
+   @param  uint16_t hexaLen : lenght of hexadecimal string
+   @return lenght of blocks
+   @note   one pass like hexaToBinaryCompression(), lowercase chars are
+           folded by hexaTable, odd word is padded by nibble 0, block is
+           closed and next started when lenght of words exceeds 255
+   @note   not hexadecimal word is replaced by token of textEncode() with
+           TEXT_DICTIONARY
+**/
+uint16_t hexaToBinaryCompressionV2( uint8_t * hexaInput, 
+                                   uint8_t * binaryOutput, 
+                                   uint16_t hexaLen)
+{
+  uint8_t *end = hexaInput + hexaLen;
+  uint8_t *block = binaryOutput, *output, *word, *dest, *record;
+  uint8_t high, low, flags;
+  uint16_t wordLen;
+#if UWB_COMPRESSION
+  uint16_t uwbLen;
+#endif
+#if TEXT_DICTIONARY
+  uint16_t textLen;
+#endif
+
+  if (hexaLen == 0)
+    return 0;
+  output = block + COMPRESSION_BLOCK_HEAD;
+  do{
+    word = hexaInput;
+    dest = output + 1;
+    flags = 0;
+
+    // translate pairs of chars until STRING_TERMINATOR or not hexadecimal char
+    while (hexaInput + 1 < end){
+      high = hexaTable[hexaInput[0]];
+      low = hexaTable[hexaInput[1]];
+      if ((high | low) & NOT_HEXA)
+        break;
+      *dest++ = (uint8_t)((high << 4) | (low & 0x0F));
+      flags |= high | low;
+      hexaInput += 2;
+    }
+    if (hexaInput < end && !(hexaTable[*hexaInput] & NOT_HEXA)){
+      *dest = (uint8_t)(hexaTable[*hexaInput] << 4);     // last nibble of odd word
+      flags |= hexaTable[*hexaInput];
+      hexaInput++;
+    }
+    if (hexaInput < end && *hexaInput != STRING_TERMINATOR){
+      flags = NOT_HEXA;
+      while (hexaInput < end && *hexaInput != STRING_TERMINATOR)
+        hexaInput++;
+    }
+    wordLen = hexaInput - word;
+    hexaInput++;            // move over STRING_TERMINATOR
+    record = output;
+
+#if UWB_COMPRESSION
+    if (!(flags & NOT_HEXA_V1) && (uwbLen = uwbEncode(word, wordLen, output)) != 0)
+      output += uwbLen;
+    else
+#endif
+    if (!(flags & NOT_HEXA) && wordLen > 0 && wordLen <= COMPRESSION_MAX_NIBBLES){
+      *output = (uint8_t)wordLen;
+      output += (wordLen + 1) / 2 + 1;
+    }
+#if TEXT_DICTIONARY
+    else if ((textLen = textEncode(word, wordLen, output)) != 0)
+      output += textLen;
+#endif
+    else if (wordLen <= 255 - 2){
+      output[0] = 0;
+      output[1] = (uint8_t)wordLen;
+      memcpy(&output[2], word, wordLen);
+      output += wordLen + 2;
+    }
+    else
+      continue;             // word is dropped
+
+    if (output - block - COMPRESSION_BLOCK_HEAD > 255){
+      // block is full, last word is first word of next block
+      memmove(record + COMPRESSION_BLOCK_HEAD, record, output - record);
+      block[0] = COMPRESSION_VERSION_2;
+      block[1] = (uint8_t)(record - block - COMPRESSION_BLOCK_HEAD);
+      block = record;
+      output += COMPRESSION_BLOCK_HEAD;
+    }
+  }while (hexaInput < end);
+  block[0] = COMPRESSION_VERSION_2;
+  block[1] = (uint8_t)(output - block - COMPRESSION_BLOCK_HEAD);
+  return output - binaryOutput;
+}
+
+/**
+   @fn     static uint16_t decompressBlockV2(uint8_t * input, uint8_t * end, uint8_t * hexaOutput, uint8_t * outEnd)
+   @brief  decompress words of one block v2
+   @param  uint8_t * input : first word of block
+   @param  uint8_t * end : end of block
+   @param  uint8_t * hexaOutput : destination
+   @param  uint8_t * outEnd : end of destination
+   @return lenght of output, words behind broken word are dropped
+   @note   lenght of word is checked before it is read, binToHexa() is
+           writing odd word with padding nibble overwritten by STRING_TERMINATOR
+   @note   with TEXT_DICTIONARY is raw word stored to window of decoder,
+           word of unknown token is dropped, window is lost behind broken word
+**/
+static uint16_t decompressBlockV2(uint8_t * input, uint8_t * end, uint8_t * hexaOutput, uint8_t * outEnd)
+{
+  uint8_t *output = hexaOutput;
+  uint16_t len;
+
+  while (end - input >= 2){
+    if (input[0] == 0){                 // not hexadecimal word
+      len = input[1];
+      if (len > end - input - 2 || len + 1 > outEnd - output)
+        break;
+      memcpy(output, &input[2], len);
+#if TEXT_DICTIONARY
+      textDecoded(output, len);
+#endif
+      input += len + 2;
+    }
+#if TEXT_DICTIONARY
+    else if (input[0] == TEXT_TOKEN){
+      output += textDecode(input, output, outEnd - output);
+      input += TEXT_TOKEN_LEN;
+      continue;
     }
+#endif
+#if UWB_COMPRESSION
+    else if (input[0] >= UWB_DELTA){
+      if (input[1] < 3 || input[1] > end - input - 2
+          || (input[0] == UWB_KEY && input[1] * 2 + 1 > UWB_MAX_CHARS)
+          || outEnd - output < UWB_MAX_CHARS)
+        break;
+      output += uwbDecode(input, output);
+      input += input[1] + 2;
+      continue;
+    }
+#endif
+    else if (input[0] <= COMPRESSION_MAX_NIBBLES){
+      len = input[0];
+      if ((len + 1) / 2 > end - input - 1 || len + 1 > outEnd - output)
+        break;
+      binToHexa(&input[1], output, (len + 1) / 2);
+      input += (len + 1) / 2 + 1;
+    }
+    else
+      break;
+    output[len] = STRING_TERMINATOR;
+    output += len + 1;
   }
+#if TEXT_DICTIONARY
+  if (input != end)
+    textDecoderLost();
+#endif
+  return output - hexaOutput;
 }
 
 /**
@@ -84,7 +318,11 @@ uint16_t hexaToBinaryCompression( uint8_t * hexaInput,
    @param  uint8_t* binaryInput : pointer at compressed binary data in memory
    @param  uint8_t* hexaOutput : pointer at destination place in memory for hexadecimal ASCII chars
    @param  uint16_t binaryLen : source (binary) lenght of data
-   @note   output lenght in destination memory is double lenght as source lenght
+   @note   output lenght in destination memory is double lenght as source lenght,
+           with UWB_COMPRESSION up to triple (DECOMPRESSED_DEPTH)
+   @note   format v2 (hexaToBinaryCompressionV2()) is recognized by
+           COMPRESSION_VERSION_2, data of both formats are read only up to
+           binaryLen, broken word is ending decompression
 **/
 uint16_t binaryToHexaDecompression( uint8_t * binaryInput, 
                                     uint8_t * hexaOutput, 
@@ -94,17 +332,54 @@ uint16_t binaryToHexaDecompression( uint8_t * binaryInput,
 #if ADAPTIVE_COMPRESSION
   uint16_t len = 0;
 #endif
+#if UWB_COMPRESSION
+  uint16_t uwbLen;
+  uint8_t *outEnd = hexaOutput + DECOMPRESSED_DEPTH;
+#endif
 
+  // format v2, blocks of words
+  if (binaryLen >= COMPRESSION_BLOCK_HEAD && *binaryInput == COMPRESSION_VERSION_2){
+    while (binaryLen >= COMPRESSION_BLOCK_HEAD && *binaryInput == COMPRESSION_VERSION_2 
+           && binaryInput[1] <= binaryLen - COMPRESSION_BLOCK_HEAD){
+      hexaLen += decompressBlockV2(binaryInput + COMPRESSION_BLOCK_HEAD, 
+                                   binaryInput + COMPRESSION_BLOCK_HEAD + binaryInput[1], 
+                                   hexaOutput + hexaLen, hexaOutput + DECOMPRESSED_DEPTH);
+      binaryLen -= binaryInput[1] + COMPRESSION_BLOCK_HEAD;
+      binaryInput += binaryInput[1] + COMPRESSION_BLOCK_HEAD;
+    }
+#if TEXT_DICTIONARY
+    if (binaryLen != 0)
+      textDecoderLost();
+#endif
+    return hexaLen;
+  }
+
+    // format v1, lenght of word is checked against rest of data
     while(binaryLen > 0){
-      binToHexa(binaryInput +1 , hexaOutput, *binaryInput);
+#if UWB_COMPRESSION
+      if (*binaryInput >= UWB_DELTA){
+        if (binaryLen < 2 || binaryInput[1] + 2 > binaryLen
+            || (binaryInput[0] == UWB_KEY && binaryInput[1] * 2 + 1 > UWB_MAX_CHARS)
+            || outEnd - hexaOutput < UWB_MAX_CHARS)
+          break;
+        uwbLen = uwbDecode(binaryInput, hexaOutput);
+        hexaOutput += uwbLen;
+        hexaLen += uwbLen;
+        binaryLen -= binaryInput[1] + 2;
+        binaryInput += binaryInput[1] + 2;
+        continue;
+      }
+#endif
 #if ADAPTIVE_COMPRESSION
       if (*binaryInput == 0){
         binaryInput++;
-        while(binaryInput[len] != STRING_TERMINATOR){
-          len++;
-        }
-        len++;
+        binaryLen--;
+        // end of data is end of last word
+        for (len = 0; len < binaryLen && binaryInput[len] != STRING_TERMINATOR; len++)
+          ;
         memcpy(hexaOutput, binaryInput, len);
+        hexaOutput[len] = STRING_TERMINATOR;
+        len++;
         hexaLen += len;
         binaryInput += len;
         hexaOutput += len; 
@@ -112,6 +387,9 @@ uint16_t binaryToHexaDecompression( uint8_t * binaryInput,
       }
       else{
 #endif
+        if (*binaryInput + 1 > binaryLen)
+          break;
+        binToHexa(binaryInput +1 , hexaOutput, *binaryInput);
         hexaOutput += (*binaryInput*2);
         
         *hexaOutput = STRING_TERMINATOR;
@@ -128,3 +406,225 @@ uint16_t binaryToHexaDecompression( uint8_t * binaryInput,
     return hexaLen;
 }
 
+static const uint8_t streamHexa[] = "0123456789ABCDEF";
+
+/**
+   @fn     static void streamChars(uint8_t * data, uint16_t from, uint16_t count, uint8_t hexa, uint8_t * output)
+   @brief  chars from..from + count - 1 of word, nibbles of packed hexadecimal
+           word (hexa) or chars of not hexadecimal word
+**/
+static void streamChars(uint8_t * data, uint16_t from, uint16_t count, uint8_t hexa, uint8_t * output)
+{
+  if (!hexa){
+    memcpy(output, data + from, count);
+    return;
+  }
+  if (from % 2 && count){               // low nibble of byte started in previous chunk
+    *output++ = streamHexa[data[from / 2] & 0x0F];
+    from++;
+    count--;
+  }
+  if (count / 2)
+    binToHexa(data + from / 2, output, count / 2);
+  if (count % 2)                        // high nibble, rest is in next chunk
+    output[count - 1] = streamHexa[data[(from + count - 1) / 2] >> 4];
+}
+
+void decompressStreamInit(struct decompressStream * stream, 
+                          uint8_t * binaryInput, 
+                          int16_t binaryLen)
+{
+  if (binaryLen < 0)
+    binaryLen = 0;
+  stream->input = binaryInput;
+  stream->end = binaryInput + binaryLen;
+  stream->offset = 0;
+  // format v2 starts by head of first block
+  if (binaryLen >= COMPRESSION_BLOCK_HEAD && *binaryInput == COMPRESSION_VERSION_2)
+    stream->blockEnd = binaryInput;
+  else
+    stream->blockEnd = NULL;
+}
+
+/**
+   @fn     decompressStream
+   @brief  next chunk of output of binaryToHexaDecompression()
+   @note   word is parsed again in each chunk, only offset of its chars is
+           kept, checks of lenghts are same as in binaryToHexaDecompression()
+           (broken block v2 is skipped, format v1 is ending)
+**/
+uint16_t decompressStream(struct decompressStream * stream, 
+                          uint8_t * hexaOutput, 
+                          uint16_t room)
+{
+  uint8_t *output = hexaOutput, *outEnd = hexaOutput + room;
+  uint8_t *input, *end, *data = NULL;
+  uint16_t len = 0, size, count, chars;
+  uint8_t hexa;
+
+  while (stream->input < stream->end){
+    input = stream->input;
+    end = stream->end;
+    size = 0;                           // lenght of word, 0 if broken
+    hexa = 0;
+
+    if (stream->blockEnd != NULL){
+      // format v2, head of next block
+      if (input == stream->blockEnd){
+        if (end - input < COMPRESSION_BLOCK_HEAD || input[0] != COMPRESSION_VERSION_2 
+            || input[1] > end - input - COMPRESSION_BLOCK_HEAD){
+#if TEXT_DICTIONARY
+          textDecoderLost();
+#endif
+          stream->input = end;
+          break;
+        }
+        stream->blockEnd = input + COMPRESSION_BLOCK_HEAD + input[1];
+        stream->input = input + COMPRESSION_BLOCK_HEAD;
+        continue;
+      }
+      end = stream->blockEnd;
+      if (end - input < 2)
+        ;                               // broken
+      else if (input[0] == 0){          // not hexadecimal word
+        len = input[1];
+        data = input + 2;
+        if (len <= end - input - 2)
+          size = len + 2;
+      }
+#if TEXT_DICTIONARY
+      else if (input[0] == TEXT_TOKEN){
+        if (outEnd - output < textDecodedMax(input))
+          break;                        // word of token is not split
+        output += textDecode(input, output, outEnd - output);
+        stream->input += TEXT_TOKEN_LEN;
+        continue;
+      }
+#endif
+#if UWB_COMPRESSION
+      else if (input[0] >= UWB_DELTA){
+        if (input[1] >= 3 && input[1] <= end - input - 2 
+            && (input[0] == UWB_DELTA || input[1] * 2 + 1 <= UWB_MAX_CHARS)){
+          if (outEnd - output < UWB_MAX_CHARS)
+            break;                      // frame is not split
+          output += uwbDecode(input, output);
+          stream->input += input[1] + 2;
+          continue;
+        }
+      }
+#endif
+      else if (input[0] <= COMPRESSION_MAX_NIBBLES){
+        len = input[0];
+        data = input + 1;
+        hexa = 1;
+        if ((len + 1) / 2 <= end - input - 1)
+          size = (len + 1) / 2 + 1;
+      }
+      if (size == 0){
+        // rest of block is dropped like by decompressBlockV2()
+#if TEXT_DICTIONARY
+        textDecoderLost();
+#endif
+        stream->input = stream->blockEnd;
+        stream->offset = 0;
+        continue;
+      }
+    }
+    else{
+      // format v1, decompression ends at broken word
+#if UWB_COMPRESSION
+      if (*input >= UWB_DELTA){
+        if (end - input < 2 || input[1] + 2 > end - input 
+            || (input[0] == UWB_KEY && input[1] * 2 + 1 > UWB_MAX_CHARS)){
+          stream->input = end;
+          break;
+        }
+        if (outEnd - output < UWB_MAX_CHARS)
+          break;
+        output += uwbDecode(input, output);
+        stream->input += input[1] + 2;
+        continue;
+      }
+#endif
+#if ADAPTIVE_COMPRESSION
+      if (*input == 0){
+        // not translated word, end of data is end of word
+        data = input + 1;
+        for (len = 0; data + len < end && data[len] != STRING_TERMINATOR; len++)
+          ;
+        size = (data + len < end) ? len + 2 : len + 1;
+      }
+      else
+#endif
+      if (*input + 1 <= end - input){
+        len = *input * 2;
+        data = input + 1;
+        hexa = 1;
+        size = *input + 1;
+      }
+      else{
+        stream->input = end;
+        break;
+      }
+    }
+
+    // chars of word and STRING_TERMINATOR behind offset, as many as fit
+    count = len + 1 - stream->offset;
+    if (count > outEnd - output)
+      count = outEnd - output;
+    if (count == 0)
+      break;
+    chars = (stream->offset + count > len) ? len - stream->offset : count;
+    streamChars(data, stream->offset, chars, hexa, output);
+    if (chars < count)
+      output[chars] = STRING_TERMINATOR;
+    output += count;
+    stream->offset += count;
+    if (stream->offset <= len)
+      break;                            // chunk is full
+#if TEXT_DICTIONARY
+    if (stream->blockEnd != NULL && !hexa)
+      textDecoded(data, len);
+#endif
+    stream->offset = 0;
+    stream->input += size;
+  }
+  return output - hexaOutput;
+}
+
+/**
+   @fn     compressedWordLen
+   @brief  lenght of one compressed word (record) including its header
+   @param  uint8_t* binaryInput : pointer at header of word
+   @return lenght of word in compressed data
+   @note   compressed data can be split into packets only behind word
+**/
+uint16_t compressedWordLen(uint8_t * binaryInput)
+{
+#if ADAPTIVE_COMPRESSION && !COMPRESSION_V2
+  uint16_t len = 1;
+#endif
+
+#if UWB_COMPRESSION
+  if (*binaryInput >= UWB_DELTA)
+    return binaryInput[1] + 2;
+#endif
+#if COMPRESSION_V2
+  if (*binaryInput == 0)
+    return binaryInput[1] + 2;
+#if TEXT_DICTIONARY
+  if (*binaryInput == TEXT_TOKEN)
+    return TEXT_TOKEN_LEN;
+#endif
+  return (*binaryInput + 1) / 2 + 1;
+#else
+#if ADAPTIVE_COMPRESSION
+  if (*binaryInput == 0){
+    while(binaryInput[len] != STRING_TERMINATOR)
+      len++;
+    return len + 1;
+  }
+#endif
+  return *binaryInput + 1;
+#endif
+}
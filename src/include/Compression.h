@@ -3,8 +3,34 @@
 #define __COMPRESSION_H
 
 #include <stdint.h>
+#include "../settings.h"
 #include "../../tests/PktTester/PRNG.h"
 
+/** @brief first byte of block of compressed words v2 (v1 word header is at most 120, 0xFD/0xFE UWB) **/
+#define COMPRESSION_VERSION_2   0xF2
+/** @brief version and lenght of block v2 **/
+#define COMPRESSION_BLOCK_HEAD  2
+/** @brief longest hexadecimal word of v2 in nibbles, header 0xFC is token of TextDict.h, 0xFD.. are UWB records **/
+#define COMPRESSION_MAX_NIBBLES 251
+
+/** @brief smallest room of decompressStream(), UWB frame (UWB_MAX_CHARS) and
+           word of token (TEXT_MAX_WORD + 1) are never split **/
+#if UWB_COMPRESSION && (!TEXT_DICTIONARY || 3 * UWB_MAX_VALUES + 11 > TEXT_MAX_WORD + 1)
+#define COMPRESSION_STREAM_MIN  (3 * UWB_MAX_VALUES + 11)
+#elif TEXT_DICTIONARY
+#define COMPRESSION_STREAM_MIN  (TEXT_MAX_WORD + 1)
+#else
+#define COMPRESSION_STREAM_MIN  1
+#endif
+
+/** @brief state of decompressStream() **/
+struct decompressStream {
+  uint8_t * input;                      // actual word (record)
+  uint8_t * end;                        // end of compressed data
+  uint8_t * blockEnd;                   // end of actual block of format v2, NULL for format v1
+  uint16_t offset;                      // chars of actual word already written
+};
+
 /**
    @fn     hexaToBinaryCompression
    @brief  converting ASCII hexadecimal words system to binary compressed system
@@ -17,6 +43,28 @@
 uint16_t hexaToBinaryCompression( uint8_t * hexaInput, 
                                  uint8_t * binaryOutput, 
                                  uint16_t hexaLen);
+
+/**
+   @fn     hexaToBinaryCompressionV2
+   @brief  compress words to blocks of format v2
+   @param  uint8_t * hexaInput : pointer at hexadecimal chars in memory
+   @param  uint8_t * binaryOutput : destination, not overlapping hexaInput
+   @param  uint16_t hexaLen : lenght of hexadecimal string
+   @return lenght of blocks
+   @note   block is [COMPRESSION_VERSION_2][lenght of words] and words
+            - [nibbles 1..COMPRESSION_MAX_NIBBLES][nibbles packed, odd word padded by 0]
+            - [0][lenght][chars] not hexadecimal, empty or too long word
+            - UWB record of uwbEncode() with UWB_COMPRESSION
+            - [TEXT_TOKEN][index] of textEncode() with TEXT_DICTIONARY
+   @note   lowercase hexadecimal chars are compressed too, decompressed
+           word is uppercase, not hexadecimal word longer than 253 chars is
+           dropped
+   @note   output is longer than input by up to 1 byte per word and
+           COMPRESSION_BLOCK_HEAD per block (block of words is up to 255 bytes)
+**/
+uint16_t hexaToBinaryCompressionV2( uint8_t * hexaInput, 
+                                   uint8_t * binaryOutput, 
+                                   uint16_t hexaLen);
                                  
 /**
    @fn     binaryToHexaDecompression
@@ -25,9 +73,57 @@ uint16_t hexaToBinaryCompression( uint8_t * hexaInput,
    @param  uint8_t* hexaOutput : pointer at destination place in memory for hexadecimal ASCII chars
    @param  uint16_t binaryLen : source (binary) lenght of data
    @note   output lenght in destination memory is double lenght as source lenght
+   @note   format v2 is recognized by COMPRESSION_VERSION_2, any lenght is
+           checked and nothing behind binaryLen is read, decoding stops at
+           first broken word, output of v2 and UWB records of v1 is at most
+           DECOMPRESSED_DEPTH
 **/
 uint16_t binaryToHexaDecompression( uint8_t * binaryInput, 
                                     uint8_t * hexaOutput, 
                                     int16_t binaryLen);
 
+/**
+   @fn     compressedWordLen
+   @brief  lenght of one compressed word (record) including its header
+   @param  uint8_t* binaryInput : pointer at header of word
+   @return lenght of word in compressed data
+   @note   compressed data can be split into packets only behind word
+**/
+uint16_t compressedWordLen(uint8_t * binaryInput);
+
+/**
+   @fn     decompressStreamInit
+   @brief  start decompression of data in chunks by decompressStream()
+   @param  struct decompressStream* stream : state
+   @param  uint8_t* binaryInput : compressed data, must not change until end of stream
+   @param  int16_t binaryLen : lenght of data
+**/
+void decompressStreamInit(struct decompressStream * stream, 
+                          uint8_t * binaryInput, 
+                          int16_t binaryLen);
+
+/**
+   @fn     decompressStream
+   @brief  next chunk of output of binaryToHexaDecompression()
+   @param  struct decompressStream* stream : state of decompressStreamInit()
+   @param  uint8_t* hexaOutput : destination of chunk
+   @param  uint16_t room : size of destination, at least COMPRESSION_STREAM_MIN
+   @return lenght of chunk, stream is finished when decompressStreamDone()
+   @note   hexadecimal and not hexadecimal words are split between chunks,
+           UWB frame and word of token are written whole (chunk is shorter)
+   @note   output is same as of binaryToHexaDecompression() which is limiting
+           format v2 to DECOMPRESSED_DEPTH, stream is not limited
+   @code
+        decompressStreamInit(&stream, payload, len);
+        while (!decompressStreamDone(&stream))
+          send(chunk, decompressStream(&stream, chunk, sizeof(chunk)));
+   @endcode
+**/
+uint16_t decompressStream(struct decompressStream * stream, 
+                          uint8_t * hexaOutput, 
+                          uint16_t room);
+
+/** @brief all data of stream are decompressed **/
+#define decompressStreamDone(stream)  ((stream)->input >= (stream)->end)
+
 #endif
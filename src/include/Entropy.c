@@ -0,0 +1,98 @@
+#include "../settings.h"
+#include "Entropy.h"
+
+/**
+   @fn     uint8_t entropyEncode(const uint8_t* payload, uint16_t len, uint8_t* coded, uint16_t* codedLen)
+   @brief  code payload by table with shortest output
+   @param  const uint8_t* payload : data of packet behind head
+   @param  uint16_t len : lenght of payload {1-255}
+   @param  uint8_t* coded : destination of len - 1 bytes (not overlapping payload)
+   @param  uint16_t* codedLen : lenght of coded payload
+   @return uint8_t - ID of table, 0 if coded payload is not shorter (coded is not written)
+   @note   size of output of each table is summed from length[] first,
+           only best table is coding
+**/
+uint8_t entropyEncode(const uint8_t* payload, uint16_t len, uint8_t* coded, uint16_t* codedLen)
+{
+  const struct entropyTable* t;
+  uint8_t *output = coded;
+  uint32_t bits, best, acc = 0;
+  uint8_t table = 0, accBits = 0, i;
+  uint16_t j;
+
+  if (len < 2 || len > 255)
+    return 0;
+  best = (uint32_t)(len - 2) * 8 + 1;     // bits < best is 1 + ceil(bits / 8) < len
+  for (i = 0; i < entropyTableCount && i < ENTROPY_MAX_TABLES; i++){
+    t = &entropyTables[i];
+    for (bits = 0, j = 0; j < len; j++)
+      bits += t->length[payload[j]];
+    if (bits < best){
+      best = bits;
+      table = i + 1;
+    }
+  }
+  if (table == 0)
+    return 0;
+
+  t = &entropyTables[table - 1];
+  *output++ = (uint8_t)len;
+  for (j = 0; j < len; j++){
+    acc = (acc << t->length[payload[j]]) | t->code[payload[j]];
+    accBits += t->length[payload[j]];
+    while (accBits >= 8){
+      accBits -= 8;
+      *output++ = (uint8_t)(acc >> accBits);
+    }
+  }
+  if (accBits)
+    *output++ = (uint8_t)(acc << (8 - accBits));    // padded by 0
+  *codedLen = output - coded;
+  return table;
+}
+
+/**
+   @fn     uint16_t entropyDecode(uint8_t table, const uint8_t* coded, uint16_t codedLen, uint8_t* payload)
+   @brief  decode payload coded by entropyEncode()
+   @param  uint8_t table : ID of table from packet head
+   @param  const uint8_t* coded : coded payload
+   @param  uint16_t codedLen : lenght of coded payload
+   @param  uint8_t* payload : destination of up to 255 bytes
+   @return uint16_t - lenght of payload, 0 if table is unknown or data are broken
+   @note   canonical code, first code of length is (first + count of
+           previous length) << 1, bit by bit without RAM tables
+**/
+uint16_t entropyDecode(uint8_t table, const uint8_t* coded, uint16_t codedLen, uint8_t* payload)
+{
+  const struct entropyTable* t;
+  const uint8_t *end = coded + codedLen;
+  uint16_t len, n, code, first, index;
+  uint8_t byte = 0, bit = 0, l;
+
+  if (table == 0 || table > entropyTableCount || codedLen < 1)
+    return 0;
+  t = &entropyTables[table - 1];
+  len = *coded++;
+
+  for (n = 0; n < len; n++){
+    code = first = index = 0;
+    for (l = 1; ; l++){
+      if (bit == 0){
+        if (coded == end)
+          return 0;
+        byte = *coded++;
+        bit = 8;
+      }
+      code |= (byte >> --bit) & 1;
+      if (code < first + t->count[l])
+        break;
+      if (l == ENTROPY_MAX_BITS)
+        return 0;
+      index += t->count[l];
+      first = (first + t->count[l]) << 1;
+      code <<= 1;
+    }
+    payload[n] = t->symbol[index + code - first];
+  }
+  return len;
+}
@@ -0,0 +1,81 @@
+/**
+ *****************************************************************************
+   @file     Entropy.h
+   @brief    static Huffman coding of radio payloads by tables trained offline
+             (tests/PktTester/EntropyTrain) and compiled into flash
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    enabled by ENTROPY_CODING in settings.h, slave is coding payload
+            of packet by table with shortest output, ID of table is in bits
+            7-6 of first byte of packet head (0 = payload is not coded),
+            master is decoding payload before binaryToHexaDecompression()
+   @note    tables are const (flash), EntropyTables.c is generated by
+            EntropyTrain from captured radio frames or UART logs, master and
+            slaves must be build with same EntropyTables.c
+   @note    coded payload is lenght of decoded payload (1 byte) and canonical
+            Huffman codes from MSB, any byte has code in any table
+   @code
+        // slave, payload behind packet head
+        table = entropyEncode(payload, len, coded, &codedLen);
+        packet[0] = ENTROPY_HEAD(table);     // | SLAVE_ID + CHAR_OFFSET
+        ...
+        // master
+        table = ENTROPY_TABLE(packet[0]);
+        if (table)
+          len = entropyDecode(table, payload, len, decoded);
+   @endcode
+**/
+#ifndef __ENTROPY_H
+#define __ENTROPY_H
+
+#include <stdint.h>
+#include "../settings.h"
+
+/** @brief longest code in bits **/
+#define ENTROPY_MAX_BITS    12
+/** @brief table ID in first byte of packet head, bits 7-6 (slave ID + CHAR_OFFSET is below 0x40) **/
+#define ENTROPY_HEAD_SHIFT  6
+#define ENTROPY_HEAD_MASK   0xC0
+#define ENTROPY_HEAD(table)       ((uint8_t)((table) << ENTROPY_HEAD_SHIFT))
+#define ENTROPY_TABLE(head)       ((uint8_t)((head) >> ENTROPY_HEAD_SHIFT))
+/** @brief tables 1..3 can be signalled in head **/
+#define ENTROPY_MAX_TABLES  3
+
+/** @brief canonical Huffman table of bytes **/
+struct entropyTable {
+  const char* name;                         /*!< @brief source of training */
+  uint16_t code[256];                       /*!< @brief code of byte, lowest length[] bits */
+  uint8_t  length[256];                     /*!< @brief bits of code of byte 1..ENTROPY_MAX_BITS */
+  uint16_t count[ENTROPY_MAX_BITS + 1];     /*!< @brief number of codes of length */
+  uint8_t  symbol[256];                     /*!< @brief bytes ordered by code */
+};
+
+/** @brief tables of EntropyTables.c, ID of table is index + 1 **/
+extern const struct entropyTable entropyTables[];
+extern const uint8_t entropyTableCount;
+
+/**
+   @fn     uint8_t entropyEncode(const uint8_t* payload, uint16_t len, uint8_t* coded, uint16_t* codedLen)
+   @brief  code payload by table with shortest output
+   @param  const uint8_t* payload : data of packet behind head
+   @param  uint16_t len : lenght of payload {1-255}
+   @param  uint8_t* coded : destination of len - 1 bytes (not overlapping payload)
+   @param  uint16_t* codedLen : lenght of coded payload
+   @return uint8_t - ID of table, 0 if coded payload is not shorter (coded is not written)
+**/
+uint8_t entropyEncode(const uint8_t* payload, uint16_t len, uint8_t* coded, uint16_t* codedLen);
+
+/**
+   @fn     uint16_t entropyDecode(uint8_t table, const uint8_t* coded, uint16_t codedLen, uint8_t* payload)
+   @brief  decode payload coded by entropyEncode()
+   @param  uint8_t table : ID of table from packet head
+   @param  const uint8_t* coded : coded payload
+   @param  uint16_t codedLen : lenght of coded payload
+   @param  uint8_t* payload : destination of up to 255 bytes
+   @return uint16_t - lenght of payload, 0 if table is unknown or data are broken
+**/
+uint16_t entropyDecode(uint8_t table, const uint8_t* coded, uint16_t codedLen, uint8_t* payload);
+
+#endif
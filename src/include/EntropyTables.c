@@ -0,0 +1,135 @@
+/**
+ *****************************************************************************
+   @file     EntropyTables.c
+   @brief    static Huffman tables of Entropy.c
+
+   @note    generated by tests/PktTester/EntropyTrain, do not edit
+   @note    table 1 "uwb-hexa" : 532 payloads, 57456 B -> 55814 B
+   @note    table 2 "uwb-delta" : 200 payloads, 44200 B -> 28137 B
+**/
+#include "Entropy.h"
+
+const uint8_t entropyTableCount = 2;
+
+const struct entropyTable entropyTables[] = {
+  {
+    "uwb-hexa",
+    { /* code */
+      0x000, 0x00E, 0x00F, 0x010, 0x006, 0x054, 0x055, 0x056, 0x057, 0x058, 0x059, 0x05A, 0x011, 0x05B, 0x05C, 0x05D,
+      0x1A6, 0x1A7, 0x05E, 0x1A8, 0x05F, 0x1A9, 0x1AA, 0x060, 0x061, 0x1AB, 0x1AC, 0x1AD, 0x062, 0x1AE, 0x3F0, 0x3F1,
+      0x1AF, 0x1B0, 0x1B1, 0x002, 0x063, 0x064, 0x065, 0x066, 0x012, 0x013, 0x067, 0x068, 0x069, 0x06A, 0x3F2, 0x1B2,
+      0x1B3, 0x1B4, 0x06B, 0x06C, 0x06D, 0x06E, 0x1B5, 0x06F, 0x014, 0x070, 0x071, 0x1B6, 0x072, 0x073, 0x1B7, 0x1B8,
+      0x074, 0x075, 0x015, 0x076, 0x016, 0x017, 0x077, 0x018, 0x019, 0x078, 0x079, 0x07A, 0x07B, 0x1B9, 0x1BA, 0x1BB,
+      0x1BC, 0x07C, 0x07D, 0x07E, 0x07F, 0x080, 0x1BD, 0x081, 0x082, 0x1BE, 0x1BF, 0x083, 0x01A, 0x084, 0x085, 0x1C0,
+      0x086, 0x1C1, 0x087, 0x1C2, 0x088, 0x1C3, 0x1C4, 0x089, 0x08A, 0x08B, 0x08C, 0x08D, 0x01B, 0x08E, 0x08F, 0x1C5,
+      0x1C6, 0x090, 0x091, 0x092, 0x093, 0x094, 0x095, 0x096, 0x097, 0x098, 0x099, 0x09A, 0x01C, 0x09B, 0x1C7, 0x1C8,
+      0x1C9, 0x09C, 0x09D, 0x09E, 0x01D, 0x09F, 0x0A0, 0x01E, 0x01F, 0x0A1, 0x0A2, 0x1CA, 0x0A3, 0x1CB, 0x1CC, 0x1CD,
+      0x1CE, 0x0A4, 0x0A5, 0x0A6, 0x020, 0x0A7, 0x0A8, 0x0A9, 0x021, 0x0AA, 0x0AB, 0x0AC, 0x0AD, 0x0AE, 0x0AF, 0x0B0,
+      0x1CF, 0x1D0, 0x0B1, 0x1D1, 0x0B2, 0x1D2, 0x1D3, 0x0B3, 0x0B4, 0x1D4, 0x1D5, 0x1D6, 0x0B5, 0x1D7, 0x1D8, 0x1D9,
+      0x3F3, 0x1DA, 0x0B6, 0x0B7, 0x022, 0x0B8, 0x0B9, 0x0BA, 0x0BB, 0x0BC, 0x023, 0x0BD, 0x024, 0x025, 0x0BE, 0x0BF,
+      0x0C0, 0x1DB, 0x1DC, 0x1DD, 0x0C1, 0x0C2, 0x0C3, 0x0C4, 0x0C5, 0x1DE, 0x1DF, 0x1E0, 0x0C6, 0x1E1, 0x3F4, 0x1E2,
+      0x1E3, 0x1E4, 0x0C7, 0x026, 0x027, 0x028, 0x029, 0x0C8, 0x0C9, 0x1E5, 0x1E6, 0x1E7, 0x0CA, 0x1E8, 0x3F5, 0x3F6,
+      0x3F7, 0x3F8, 0x1E9, 0x1EA, 0x0CB, 0x1EB, 0x1EC, 0x0CC, 0x0CD, 0x3F9, 0x1ED, 0x1EE, 0x0CE, 0x1EF, 0x3FA, 0x3FB,
+      0x3FC, 0x3FD, 0x1F0, 0x1F1, 0x0CF, 0x1F2, 0x1F3, 0x0D0, 0x0D1, 0x1F4, 0x1F5, 0x1F6, 0x0D2, 0x1F7, 0x3FE, 0x3FF
+    },
+    { /* length */
+        4,   7,   7,   7,   6,   8,   8,   8,   8,   8,   8,   8,   7,   8,   8,   8,
+        9,   9,   8,   9,   8,   9,   9,   8,   8,   9,   9,   9,   8,   9,  10,  10,
+        9,   9,   9,   5,   8,   8,   8,   8,   7,   7,   8,   8,   8,   8,  10,   9,
+        9,   9,   8,   8,   8,   8,   9,   8,   7,   8,   8,   9,   8,   8,   9,   9,
+        8,   8,   7,   8,   7,   7,   8,   7,   7,   8,   8,   8,   8,   9,   9,   9,
+        9,   8,   8,   8,   8,   8,   9,   8,   8,   9,   9,   8,   7,   8,   8,   9,
+        8,   9,   8,   9,   8,   9,   9,   8,   8,   8,   8,   8,   7,   8,   8,   9,
+        9,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   7,   8,   9,   9,
+        9,   8,   8,   8,   7,   8,   8,   7,   7,   8,   8,   9,   8,   9,   9,   9,
+        9,   8,   8,   8,   7,   8,   8,   8,   7,   8,   8,   8,   8,   8,   8,   8,
+        9,   9,   8,   9,   8,   9,   9,   8,   8,   9,   9,   9,   8,   9,   9,   9,
+       10,   9,   8,   8,   7,   8,   8,   8,   8,   8,   7,   8,   7,   7,   8,   8,
+        8,   9,   9,   9,   8,   8,   8,   8,   8,   9,   9,   9,   8,   9,  10,   9,
+        9,   9,   8,   7,   7,   7,   7,   8,   8,   9,   9,   9,   8,   9,  10,  10,
+       10,  10,   9,   9,   8,   9,   9,   8,   8,  10,   9,   9,   8,   9,  10,  10,
+       10,  10,   9,   9,   8,   9,   9,   8,   8,   9,   9,   9,   8,   9,  10,  10
+    },
+    { /* count */
+      0x000, 0x000, 0x000, 0x000, 0x001, 0x001, 0x001, 0x01C, 0x07F, 0x052, 0x010, 0x000, 0x000
+    },
+    { /* symbol */
+        0,  35,   4,   1,   2,   3,  12,  40,  41,  56,  66,  68,  69,  71,  72,  92,
+      108, 124, 132, 135, 136, 148, 152, 180, 186, 188, 189, 211, 212, 213, 214,   5,
+        6,   7,   8,   9,  10,  11,  13,  14,  15,  18,  20,  23,  24,  28,  36,  37,
+       38,  39,  42,  43,  44,  45,  50,  51,  52,  53,  55,  57,  58,  60,  61,  64,
+       65,  67,  70,  73,  74,  75,  76,  81,  82,  83,  84,  85,  87,  88,  91,  93,
+       94,  96,  98, 100, 103, 104, 105, 106, 107, 109, 110, 113, 114, 115, 116, 117,
+      118, 119, 120, 121, 122, 123, 125, 129, 130, 131, 133, 134, 137, 138, 140, 145,
+      146, 147, 149, 150, 151, 153, 154, 155, 156, 157, 158, 159, 162, 164, 167, 168,
+      172, 178, 179, 181, 182, 183, 184, 185, 187, 190, 191, 192, 196, 197, 198, 199,
+      200, 204, 210, 215, 216, 220, 228, 231, 232, 236, 244, 247, 248, 252,  16,  17,
+       19,  21,  22,  25,  26,  27,  29,  32,  33,  34,  47,  48,  49,  54,  59,  62,
+       63,  77,  78,  79,  80,  86,  89,  90,  95,  97,  99, 101, 102, 111, 112, 126,
+      127, 128, 139, 141, 142, 143, 144, 160, 161, 163, 165, 166, 169, 170, 171, 173,
+      174, 175, 177, 193, 194, 195, 201, 202, 203, 205, 207, 208, 209, 217, 218, 219,
+      221, 226, 227, 229, 230, 234, 235, 237, 242, 243, 245, 246, 249, 250, 251, 253,
+       30,  31,  46, 176, 206, 222, 223, 224, 225, 233, 238, 239, 240, 241, 254, 255
+    }
+  },
+  {
+    "uwb-delta",
+    { /* code */
+      0x000, 0x002, 0x003, 0x004, 0x005, 0x006, 0x007, 0x010, 0x011, 0x012, 0x013, 0x014, 0x015, 0x030, 0x031, 0x032,
+      0x033, 0x068, 0x069, 0x06A, 0x06B, 0x0D8, 0x0D9, 0x0DA, 0x0DB, 0x016, 0x1BA, 0x37A, 0x1BB, 0x37B, 0x37C, 0x75C,
+      0x37D, 0x75D, 0x37E, 0x0DC, 0x37F, 0x75E, 0x380, 0x75F, 0x381, 0x382, 0x760, 0x761, 0x383, 0x762, 0x763, 0x764,
+      0x765, 0x766, 0x767, 0x768, 0x769, 0x76A, 0x76B, 0x76C, 0x76D, 0x76E, 0x76F, 0x770, 0x771, 0x772, 0x773, 0x774,
+      0x775, 0x384, 0x385, 0x386, 0x387, 0x388, 0x389, 0x38A, 0x38B, 0x776, 0x777, 0x778, 0x38C, 0x779, 0x77A, 0x77B,
+      0x77C, 0x77D, 0x38D, 0x77E, 0x38E, 0x77F, 0x780, 0x781, 0x782, 0x783, 0x784, 0x785, 0x38F, 0x390, 0x786, 0x787,
+      0x788, 0x789, 0x78A, 0x78B, 0x78C, 0xFEE, 0x78D, 0x391, 0x392, 0x78E, 0x393, 0x394, 0x395, 0x78F, 0x790, 0x791,
+      0x792, 0x793, 0x794, 0x795, 0x796, 0x797, 0x798, 0x396, 0x397, 0x799, 0x398, 0x79A, 0x399, 0x79B, 0x79C, 0x79D,
+      0x79E, 0x79F, 0x39A, 0x39B, 0x39C, 0x7A0, 0x7A1, 0x39D, 0x39E, 0x7A2, 0x7A3, 0x7A4, 0x7A5, 0x7A6, 0x7A7, 0x7A8,
+      0x7A9, 0x7AA, 0x7AB, 0x7AC, 0x39F, 0x7AD, 0x7AE, 0x7AF, 0x3A0, 0x7B0, 0x7B1, 0x7B2, 0x7B3, 0x7B4, 0x7B5, 0x7B6,
+      0x7B7, 0x7B8, 0x7B9, 0x7BA, 0x7BB, 0x7BC, 0x7BD, 0x7BE, 0x7BF, 0x7C0, 0xFEF, 0x7C1, 0x7C2, 0xFF0, 0x7C3, 0xFF1,
+      0xFF2, 0x7C4, 0x7C5, 0x7C6, 0x3A1, 0x7C7, 0x7C8, 0x3A2, 0x7C9, 0x7CA, 0x3A3, 0x7CB, 0x3A4, 0x3A5, 0x7CC, 0x7CD,
+      0x7CE, 0x7CF, 0x7D0, 0x7D1, 0x7D2, 0x7D3, 0x7D4, 0x3A6, 0x3A7, 0x7D5, 0x7D6, 0x7D7, 0x7D8, 0xFF3, 0x7D9, 0x7DA,
+      0x7DB, 0x7DC, 0x7DD, 0x3A8, 0x3A9, 0x3AA, 0x3AB, 0x3AC, 0x3AD, 0x7DE, 0x7DF, 0xFF4, 0x7E0, 0x7E1, 0x7E2, 0xFF5,
+      0xFF6, 0xFF7, 0xFF8, 0xFF9, 0x7E3, 0x7E4, 0xFFA, 0x7E5, 0x7E6, 0xFFB, 0x7E7, 0x7E8, 0x7E9, 0x7EA, 0xFFC, 0xFFD,
+      0x7EB, 0xFFE, 0x7EC, 0x7ED, 0x7EE, 0x7EF, 0xFFF, 0x7F0, 0x7F1, 0x7F2, 0x7F3, 0x7F4, 0x7F5, 0x017, 0x1BC, 0x7F6
+    },
+    { /* length */
+        3,   4,   4,   4,   4,   4,   4,   5,   5,   5,   5,   5,   5,   6,   6,   6,
+        6,   7,   7,   7,   7,   8,   8,   8,   8,   5,   9,  10,   9,  10,  10,  11,
+       10,  11,  10,   8,  10,  11,  10,  11,  10,  10,  11,  11,  10,  11,  11,  11,
+       11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,
+       11,  10,  10,  10,  10,  10,  10,  10,  10,  11,  11,  11,  10,  11,  11,  11,
+       11,  11,  10,  11,  10,  11,  11,  11,  11,  11,  11,  11,  10,  10,  11,  11,
+       11,  11,  11,  11,  11,  12,  11,  10,  10,  11,  10,  10,  10,  11,  11,  11,
+       11,  11,  11,  11,  11,  11,  11,  10,  10,  11,  10,  11,  10,  11,  11,  11,
+       11,  11,  10,  10,  10,  11,  11,  10,  10,  11,  11,  11,  11,  11,  11,  11,
+       11,  11,  11,  11,  10,  11,  11,  11,  10,  11,  11,  11,  11,  11,  11,  11,
+       11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  12,  11,  11,  12,  11,  12,
+       12,  11,  11,  11,  10,  11,  11,  10,  11,  11,  10,  11,  10,  10,  11,  11,
+       11,  11,  11,  11,  11,  11,  11,  10,  10,  11,  11,  11,  11,  12,  11,  11,
+       11,  11,  11,  10,  10,  10,  10,  10,  10,  11,  11,  12,  11,  11,  11,  12,
+       12,  12,  12,  12,  11,  11,  12,  11,  11,  12,  11,  11,  11,  11,  12,  12,
+       11,  12,  11,  11,  11,  11,  12,  11,  11,  11,  11,  11,  11,   5,   9,  11
+    },
+    { /* count */
+      0x000, 0x000, 0x000, 0x001, 0x006, 0x008, 0x004, 0x004, 0x005, 0x003, 0x034, 0x09B, 0x012
+    },
+    { /* symbol */
+        0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  25, 253,  13,
+       14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  35,  26,  28, 254,  27,
+       29,  30,  32,  34,  36,  38,  40,  41,  44,  65,  66,  67,  68,  69,  70,  71,
+       72,  76,  82,  84,  92,  93, 103, 104, 106, 107, 108, 119, 120, 122, 124, 130,
+      131, 132, 135, 136, 148, 152, 180, 183, 186, 188, 189, 199, 200, 211, 212, 213,
+      214, 215, 216,  31,  33,  37,  39,  42,  43,  45,  46,  47,  48,  49,  50,  51,
+       52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  73,  74,  75,
+       77,  78,  79,  80,  81,  83,  85,  86,  87,  88,  89,  90,  91,  94,  95,  96,
+       97,  98,  99, 100, 102, 105, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+      121, 123, 125, 126, 127, 128, 129, 133, 134, 137, 138, 139, 140, 141, 142, 143,
+      144, 145, 146, 147, 149, 150, 151, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+      162, 163, 164, 165, 166, 167, 168, 169, 171, 172, 174, 177, 178, 179, 181, 182,
+      184, 185, 187, 190, 191, 192, 193, 194, 195, 196, 197, 198, 201, 202, 203, 204,
+      206, 207, 208, 209, 210, 217, 218, 220, 221, 222, 228, 229, 231, 232, 234, 235,
+      236, 237, 240, 242, 243, 244, 245, 247, 248, 249, 250, 251, 252, 255, 101, 170,
+      173, 175, 176, 205, 219, 223, 224, 225, 226, 227, 230, 233, 238, 239, 241, 246
+    }
+  }
+};
@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <string.h>
+#include "ADUCRF101.h"
+#include "../settings.h"
+#include "Profile.h"
+
+struct profileSection profileTable[PROF_SECTIONS];
+uint32_t profileStart[PROF_SECTIONS];
+static uint32_t profileResetCycles;
+
+static const char * const profileNames[PROF_SECTIONS] = {
+  "radioRecieve",
+  "RadioRxPacketRead",
+  "copyBufferToMemory",
+  "storePkt",
+  "hexaToBinaryCompression",
+  "slowFlush",
+  "UART_Int_Handler",
+  "DMA_UART_TX_Int_Handler",
+  "checkIntegrityOfFirmware",
+  "crcSlow",
+  "crcNibble",
+  "crcFast"
+};
+
+/**
+   @fn     void profileInit(void)
+   @brief  start cycle counter and clear statistic
+**/
+void profileInit(void)
+{
+  PROFILE_CYCLES_INIT();
+  profileReset();
+}
+
+/**
+   @fn     void profileReset(void)
+   @brief  clear statistic of all sections
+**/
+void profileReset(void)
+{
+  uint8_t i;
+
+  memset(profileTable, 0, sizeof(profileTable));
+  for (i = 0; i < PROF_SECTIONS; i++)
+    profileTable[i].min = 0xffffffff;
+  profileResetCycles = PROFILE_CYCLES();
+}
+
+/**
+   @fn     void profileAdd(uint8_t section, uint32_t cycles)
+   @brief  add one measurement of section
+   @param  uint8_t section : profileSections
+   @param  uint32_t cycles : duration of section
+**/
+void profileAdd(uint8_t section, uint32_t cycles)
+{
+  struct profileSection *s = &profileTable[section];
+
+  s->count++;
+  s->sum += cycles;
+  if (cycles < s->min)
+    s->min = cycles;
+  if (cycles > s->max)
+    s->max = cycles;
+}
+
+/**
+   @fn     void profileDump(void)
+   @brief  print table of sections on UART with printf (blocking)
+   @note   total cycles are overflowing after 2^32 cycles (268 s at 16 MHz)
+**/
+void profileDump(void)
+{
+  uint8_t i;
+  struct profileSection *s;
+
+  for (i = 0; i < PROF_SECTIONS; i++){
+    s = &profileTable[i];
+    if (s->count == 0)
+      continue;
+    printf("\nPROF %s %lu %lu %lu %lu#", profileNames[i], (unsigned long)s->count,
+           (unsigned long)s->min, (unsigned long)(s->sum / s->count), (unsigned long)s->max);
+  }
+  printf("\nPROF total %lu#", (unsigned long)(PROFILE_CYCLES() - profileResetCycles));
+}
@@ -0,0 +1,99 @@
+/**
+ *****************************************************************************
+   @file     Profile.h
+   @brief    cycle count profiling of hot sections with Cortex-M3 DWT counter
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    enabled by PROFILING in settings.h, otherwise macros are empty
+   @note    section is measured from PROFILE_BEGIN to PROFILE_END including
+            interrupts which preempted it, the same section can not be nested
+   @code
+        PROFILE_BEGIN(PROF_STORE_PKT);
+        storePkt();
+        PROFILE_END(PROF_STORE_PKT);
+        ...
+        profileDump();    // table of min/avg/max cycles on UART
+   @endcode
+**/
+#ifndef __PROFILE_H
+#define __PROFILE_H
+
+#include <stdint.h>
+
+/** @brief profiled sections of Master.c and Slave.c **/
+enum profileSections {
+  PROF_RADIO_RECIEVE = 0,     /*!< @brief radioRecieve() including waiting for packet */
+  PROF_RX_PACKET_READ,        /*!< @brief RadioRxPacketRead() */
+  PROF_COPY_BUFFER,           /*!< @brief copyBufferToMemory() of master */
+  PROF_STORE_PKT,             /*!< @brief storePkt() of slave */
+  PROF_COMPRESSION,           /*!< @brief hexaToBinaryCompression() */
+  PROF_SLOW_FLUSH,            /*!< @brief slowFlush() of master */
+  PROF_UART_ISR,              /*!< @brief UART_Int_Handler() */
+  PROF_DMA_TX_ISR,            /*!< @brief DMA_UART_TX_Int_Handler() */
+  PROF_INTEGRITY,             /*!< @brief checkIntegrityOfFirmware() at start */
+  PROF_CRC_SLOW,              /*!< @brief crcSlow() of one packet at start */
+  PROF_CRC_NIBBLE,            /*!< @brief crcNibble() of one packet at start */
+  PROF_CRC_FAST,              /*!< @brief crcFast() of one packet at start */
+  PROF_SECTIONS
+};
+
+/** @brief statistic of one section in cycles of core clock **/
+struct profileSection {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+};
+
+/** @brief read of cycle counter, host build (tests/FirmwareSim) redefine it **/
+#ifndef PROFILE_CYCLES
+#define PROFILE_CYCLES()        (DWT->CYCCNT)
+#endif
+
+/** @brief enable trace and cycle counter of DWT unit **/
+#ifndef PROFILE_CYCLES_INIT
+#define PROFILE_CYCLES_INIT()   do{ CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+                                    DWT->CYCCNT = 0; \
+                                    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; }while(0)
+#endif
+
+#if PROFILING
+extern uint32_t profileStart[PROF_SECTIONS];
+#define PROFILE_BEGIN(section)  (profileStart[section] = PROFILE_CYCLES())
+#define PROFILE_END(section)    profileAdd(section, PROFILE_CYCLES() - profileStart[section])
+#else
+#define PROFILE_BEGIN(section)
+#define PROFILE_END(section)
+#endif
+
+/**
+   @fn     void profileInit(void)
+   @brief  start cycle counter and clear statistic
+**/
+void profileInit(void);
+
+/**
+   @fn     void profileReset(void)
+   @brief  clear statistic of all sections
+**/
+void profileReset(void);
+
+/**
+   @fn     void profileAdd(uint8_t section, uint32_t cycles)
+   @brief  add one measurement of section
+   @param  uint8_t section : profileSections
+   @param  uint32_t cycles : duration of section
+**/
+void profileAdd(uint8_t section, uint32_t cycles);
+
+/**
+   @fn     void profileDump(void)
+   @brief  print table of sections on UART with printf (blocking)
+   @note   format of line "\nPROF name count min avg max#",
+           last line "\nPROF total cycles#" since profileReset()
+**/
+void profileDump(void);
+
+#endif
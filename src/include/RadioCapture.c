@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <string.h>
+#include "ADUCRF101.h"
+#include "../settings.h"
+#include "RadioCapture.h"
+
+uint8_t captureRing[RADIO_CAPTURE_SIZE];
+static uint16_t captureHead;        // next free byte
+static uint16_t captureTail;        // oldest record
+static uint16_t captureUsed;        // bytes of records in ring
+static uint16_t captureRecords;
+static uint32_t captureOverwritten;
+
+/**
+   @fn     static uint8_t captureAt(uint16_t offset)
+   @brief  byte of ring at offset from oldest record
+**/
+static uint8_t captureAt(uint16_t offset)
+{
+  return captureRing[(captureTail + offset) % RADIO_CAPTURE_SIZE];
+}
+
+/**
+   @fn     static void capturePut(uint8_t byte)
+   @brief  append byte at head of ring
+**/
+static void capturePut(uint8_t byte)
+{
+  captureRing[captureHead] = byte;
+  captureHead = (captureHead + 1) % RADIO_CAPTURE_SIZE;
+  captureUsed++;
+}
+
+/**
+   @fn     void radioCaptureInit(void)
+   @brief  start cycle counter and clear ring
+**/
+void radioCaptureInit(void)
+{
+  PROFILE_CYCLES_INIT();
+  radioCaptureReset();
+}
+
+/**
+   @fn     void radioCaptureReset(void)
+   @brief  clear ring and counter of overwritten records
+**/
+void radioCaptureReset(void)
+{
+  captureHead = 0;
+  captureTail = 0;
+  captureUsed = 0;
+  captureRecords = 0;
+  captureOverwritten = 0;
+}
+
+/**
+   @fn     void radioCapture(uint8_t dir, const uint8_t * data, uint8_t len, int8_t rssi)
+   @brief  store one frame into ring, oldest records are overwritten
+   @param  uint8_t dir : RADIO_CAPTURE_TX or RADIO_CAPTURE_RX
+   @param  const uint8_t * data : payload of frame
+   @param  uint8_t len : lenght of payload
+   @param  int8_t rssi : RSSI of received frame in dBm, 0 for transmitted
+**/
+void radioCapture(uint8_t dir, const uint8_t * data, uint8_t len, int8_t rssi)
+{
+  uint32_t tick = PROFILE_CYCLES();
+  uint16_t size = RADIO_CAPTURE_HEAD + len;
+  uint16_t old;
+
+  if (size > RADIO_CAPTURE_SIZE)
+    return;
+  // release oldest records
+  while (RADIO_CAPTURE_SIZE - captureUsed < size){
+    old = RADIO_CAPTURE_HEAD + captureAt(RADIO_CAPTURE_HEAD - 1);
+    captureTail = (captureTail + old) % RADIO_CAPTURE_SIZE;
+    captureUsed -= old;
+    captureRecords--;
+    captureOverwritten++;
+  }
+  capturePut((uint8_t)tick);
+  capturePut((uint8_t)(tick >> 8));
+  capturePut((uint8_t)(tick >> 16));
+  capturePut((uint8_t)(tick >> 24));
+  capturePut(dir);
+  capturePut((uint8_t)rssi);
+  capturePut(len);
+  while (len--)
+    capturePut(*data++);
+  captureRecords++;
+}
+
+/**
+   @fn     void radioCaptureDump(void)
+   @brief  print records from oldest on UART with printf (blocking)
+   @note   tick is PROFILE_CYCLES() (core clock), overflowing after 2^32 cycles
+**/
+void radioCaptureDump(void)
+{
+  uint16_t offset = 0, i;
+  uint32_t tick;
+  uint8_t len;
+
+  while (offset < captureUsed){
+    tick = (uint32_t)captureAt(offset) | ((uint32_t)captureAt(offset + 1) << 8)
+         | ((uint32_t)captureAt(offset + 2) << 16) | ((uint32_t)captureAt(offset + 3) << 24);
+    len = captureAt(offset + 6);
+    printf("\ncapture %lu %c %d %u ", (unsigned long)tick, captureAt(offset + 4),
+           (int)(int8_t)captureAt(offset + 5), (unsigned)len);
+    offset += RADIO_CAPTURE_HEAD;
+    for (i = 0; i < len; i++)
+      printf("%02X", captureAt(offset + i));
+    printf("#");
+    offset += len;
+  }
+  printf("\ncapture end records %u overwritten %lu#", (unsigned)captureRecords,
+         (unsigned long)captureOverwritten);
+}
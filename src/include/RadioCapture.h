@@ -0,0 +1,74 @@
+/**
+ *****************************************************************************
+   @file     RadioCapture.h
+   @brief    capture of transmitted and received radio frames into RAM ring
+             for record and replay of radio traffic
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    enabled by RADIO_CAPTURE in settings.h, otherwise macros are empty
+   @note    record is tick of PROFILE_CYCLES(), direction, RSSI, lenght and
+            data of frame, oldest records are overwritten when ring is full
+   @note    radioeng.c (and host stand-in tests/FirmwareSim/HostRadio.c) is
+            calling RADIO_CAPTURE_FRAME() in RadioTxPacketVariableLen() and
+            RadioRxPacketRead()
+   @code
+        radioCaptureInit();
+        ...
+        radioCaptureDump();    // records on UART, input of SimRun -R
+        radioCaptureReset();
+   @endcode
+**/
+#ifndef __RADIO_CAPTURE_H
+#define __RADIO_CAPTURE_H
+
+#include <stdint.h>
+#include "../settings.h"
+#include "Profile.h"
+
+/** @brief direction of captured frame **/
+#define RADIO_CAPTURE_TX        'T'
+#define RADIO_CAPTURE_RX        'R'
+
+/** @brief tick(4), direction(1), RSSI(1) and lenght(1) before data **/
+#define RADIO_CAPTURE_HEAD      7
+
+#if RADIO_CAPTURE
+#define RADIO_CAPTURE_FRAME(dir, data, len, rssi)   radioCapture(dir, data, len, rssi)
+#else
+#define RADIO_CAPTURE_FRAME(dir, data, len, rssi)
+#endif
+
+/**
+   @fn     void radioCaptureInit(void)
+   @brief  start cycle counter and clear ring
+**/
+void radioCaptureInit(void);
+
+/**
+   @fn     void radioCaptureReset(void)
+   @brief  clear ring and counter of overwritten records
+**/
+void radioCaptureReset(void);
+
+/**
+   @fn     void radioCapture(uint8_t dir, const uint8_t * data, uint8_t len, int8_t rssi)
+   @brief  store one frame into ring
+   @param  uint8_t dir : RADIO_CAPTURE_TX or RADIO_CAPTURE_RX
+   @param  const uint8_t * data : payload of frame
+   @param  uint8_t len : lenght of payload
+   @param  int8_t rssi : RSSI of received frame in dBm, 0 for transmitted
+   @note   called only from main loop (radio functions are not reentrant)
+**/
+void radioCapture(uint8_t dir, const uint8_t * data, uint8_t len, int8_t rssi);
+
+/**
+   @fn     void radioCaptureDump(void)
+   @brief  print records from oldest on UART with printf (blocking)
+   @note   format of line "\ncapture tick dir rssi len hexadata#",
+           last line "\ncapture end records N overwritten N#"
+**/
+void radioCaptureDump(void);
+
+#endif
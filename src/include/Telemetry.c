@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <string.h>
+#include "ADUCRF101.h"
+#include "../settings.h"
+#include "Telemetry.h"
+
+struct telemetryCounters telemetry;
+char telemetryBuffer[TELEMETRY_FRAME_LEN];
+volatile uint8_t telemetry_flag;
+static struct telemetryCounters telemetrySnapshot;    // totals at last tick
+static struct telemetryCounters telemetryPrevious;    // totals at last frame
+static uint16_t telemetrySeq;                         // ticks since start
+static uint16_t telemetrySeqPrevious;
+
+/**
+   @fn     void telemetryTick(void)
+   @brief  end of period, copy counters to snapshot and set telemetry_flag
+**/
+void telemetryTick(void)
+{
+  memcpy(&telemetrySnapshot, &telemetry, sizeof(telemetrySnapshot));
+  telemetrySeq++;
+  telemetry_flag = 1;
+}
+
+/**
+   @fn     uint16_t telemetryFrame(uint8_t node)
+   @brief  format status frame of last period(s) to telemetryBuffer
+   @param  uint8_t node : 0 == master, otherwise SLAVE_ID
+   @return uint16_t - lenght of frame
+**/
+uint16_t telemetryFrame(uint8_t node)
+{
+  struct telemetryCounters now;
+  uint16_t seq, len;
+  uint8_t i;
+
+  NVIC_DisableIRQ(TIMER1_IRQn);           // snapshot is written in interrupt
+  memcpy(&now, &telemetrySnapshot, sizeof(now));
+  seq = telemetrySeq;
+  telemetry_flag = 0;
+  NVIC_EnableIRQ(TIMER1_IRQn);
+
+  len = sprintf(telemetryBuffer, "\ntlm %u %u %u rx", (unsigned)node, (unsigned)seq,
+                (unsigned)(uint16_t)(seq - telemetrySeqPrevious));
+  if (node == 0){
+    for (i = 1; i <= NUMBER_OF_SLAVES; i++)
+      len += sprintf(&telemetryBuffer[len], " %lu",
+                     (unsigned long)(now.radioRx[i] - telemetryPrevious.radioRx[i]));
+  }
+  else
+    len += sprintf(&telemetryBuffer[len], " %lu",
+                   (unsigned long)(now.radioRx[0] - telemetryPrevious.radioRx[0]));
+  len += sprintf(&telemetryBuffer[len], " tx %lu uart %lu retx %lu",
+                 (unsigned long)(now.radioTx - telemetryPrevious.radioTx),
+                 (unsigned long)(now.uart - telemetryPrevious.uart),
+                 (unsigned long)(now.retx - telemetryPrevious.retx));
+  if (node != 0)
+    len += sprintf(&telemetryBuffer[len], " drop %lu %lu",
+                   (unsigned long)(now.dropLong - telemetryPrevious.dropLong),
+                   (unsigned long)(now.dropFull - telemetryPrevious.dropFull));
+  len += sprintf(&telemetryBuffer[len], " slot %lu of %lu#",
+                 (unsigned long)(now.slotsUsed - telemetryPrevious.slotsUsed),
+                 (unsigned long)(now.slots - telemetryPrevious.slots));
+
+  memcpy(&telemetryPrevious, &now, sizeof(telemetryPrevious));
+  telemetrySeqPrevious = seq;
+  return len;
+}
@@ -0,0 +1,79 @@
+/**
+ *****************************************************************************
+   @file     Telemetry.h
+   @brief    throughput counters of master and slave published any second
+             as status frame on UART
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    enabled by TELEMETRY in settings.h, otherwise macros are empty
+   @note    counters are running totals written by main loop or by one
+            interrupt, GP_Tmr1_Int_Handler() is only copying them to snapshot
+            (telemetryTick()), main loop is printing difference of two
+            snapshots, so no count is lost if frame is printed late
+   @code
+        setTelemetryTimer();            // TM1 periodic, TELEMETRY_INTERVAL
+        TELEMETRY_ADD(radioTx, len);
+        ...
+        // GP_Tmr1_Int_Handler()
+        telemetryTick();
+        ...
+        // main loop
+        if (telemetry_flag == TRUE){
+          len = telemetryFrame(0);      // 0 = master, SLAVE_ID on slave
+          ...send telemetryBuffer
+        }
+   @endcode
+**/
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#include <stdint.h>
+#include "../settings.h"
+
+/** @brief running totals since reset **/
+struct telemetryCounters {
+  uint32_t radioRx[NUMBER_OF_SLAVES + 1]; /*!< @brief received radio bytes, master: [slave] in slot of slave, slave: [0] all heard frames */
+  uint32_t radioTx;     /*!< @brief transmitted radio bytes */
+  uint32_t uart;        /*!< @brief master: bytes drained on UART by DMA, slave: bytes received on UART */
+  uint32_t retx;        /*!< @brief master: requested retransmissions, slave: retransmitted packets */
+  uint32_t dropLong;    /*!< @brief slave: dropped UART packets "pkt too Long" */
+  uint32_t dropFull;    /*!< @brief slave: dropped UART packets "packet memory is full" */
+  uint32_t slots;       /*!< @brief master: polled slots, slave: own slots */
+  uint32_t slotsUsed;   /*!< @brief slots with data packets */
+};
+
+/** @brief longest frame, master with per slave list of received bytes **/
+#define TELEMETRY_FRAME_LEN   (128 + 11 * NUMBER_OF_SLAVES)
+
+#if TELEMETRY
+extern struct telemetryCounters telemetry;
+#define TELEMETRY_ADD(counter, n)   (telemetry.counter += (n))
+#else
+#define TELEMETRY_ADD(counter, n)
+#endif
+
+extern char telemetryBuffer[TELEMETRY_FRAME_LEN];
+extern volatile uint8_t telemetry_flag;
+
+/**
+   @fn     void telemetryTick(void)
+   @brief  end of period, copy counters to snapshot and set telemetry_flag
+   @note   called from GP_Tmr1_Int_Handler()
+**/
+void telemetryTick(void);
+
+/**
+   @fn     uint16_t telemetryFrame(uint8_t node)
+   @brief  format status frame of last period(s) to telemetryBuffer
+   @param  uint8_t node : 0 == master, otherwise SLAVE_ID
+   @return uint16_t - lenght of frame
+   @note   clears telemetry_flag, format of frame
+           master "\ntlm 0 seq periods rx b1 .. bN tx b uart b retx n slot used of all#"
+           slave  "\ntlm id seq periods rx b tx b uart b retx n drop long full slot used of all#"
+           periods is number of seconds covered by frame (more than 1 if late)
+**/
+uint16_t telemetryFrame(uint8_t node);
+
+#endif
@@ -0,0 +1,145 @@
+#include <string.h>
+#include "../settings.h"
+#include "TextDict.h"
+
+/**
+   @brief  static dictionary, status strings of radars and messages
+   @note   index of word is in token, new words are appended at end
+**/
+const char* const textDictionary[] = {
+  "OK",
+  "ERROR",
+  "READY",
+  "BUSY",
+  "IDLE",
+  "START",
+  "STOP",
+  "RESET",
+  "SYNC",
+  "TIMEOUT",
+  "NO_TARGET",
+  "CALIBRATION",
+  "CALIBRATION_OK",
+  "LOW_BATTERY",
+  "TEMPERATURE_HIGH",
+  "STATUS",
+  "#OK",
+  "#ERROR",
+  "#READY",
+  "#BUSY",
+  "#NO_TARGET",
+  "integrity check ok",
+  "integrity check error",
+};
+const uint8_t textDictionarySize = sizeof(textDictionary) / sizeof(textDictionary[0]);
+
+/** @brief last text words of superframe, FIFO **/
+struct textWindow {
+  uint8_t valid;                        // no word is lost since reset
+  uint8_t next;                         // slot of next word
+  uint8_t len[TEXT_WINDOW];             // 0 = empty slot
+  uint8_t word[TEXT_WINDOW][TEXT_MAX_WORD];
+};
+
+static struct textWindow textEncoder;   // slave
+static struct textWindow textDecoder;   // master
+
+/**
+   @fn     static void textStore(struct textWindow* window, uint8_t* word, uint16_t wordLen)
+   @brief  word to next slot of window, oldest word is replaced
+**/
+static void textStore(struct textWindow* window, uint8_t* word, uint16_t wordLen)
+{
+  if (wordLen == 0 || wordLen > TEXT_MAX_WORD)
+    return;
+  memcpy(window->word[window->next], word, wordLen);
+  window->len[window->next] = (uint8_t)wordLen;
+  window->next = (window->next + 1) % TEXT_WINDOW;
+}
+
+uint16_t textEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput)
+{
+  uint8_t i;
+
+  if (wordLen == 0 || wordLen > 255)
+    return 0;
+  for (i = 0; i < textDictionarySize; i++)
+    if (textDictionary[i][0] == word[0] && strlen(textDictionary[i]) == wordLen
+        && memcmp(textDictionary[i], word, wordLen) == 0)
+      break;
+  if (i == textDictionarySize){
+    if (!textEncoder.valid){
+      textStore(&textEncoder, word, wordLen);
+      return 0;
+    }
+    for (i = 0; i < TEXT_WINDOW; i++)
+      if (textEncoder.len[i] == wordLen && memcmp(textEncoder.word[i], word, wordLen) == 0)
+        break;
+    if (i == TEXT_WINDOW){
+      textStore(&textEncoder, word, wordLen);
+      return 0;
+    }
+    i += textDictionarySize;
+  }
+  binaryOutput[0] = TEXT_TOKEN;
+  binaryOutput[1] = i;
+  return TEXT_TOKEN_LEN;
+}
+
+uint16_t textDecode(uint8_t* binaryInput, uint8_t* hexaOutput, uint16_t room)
+{
+  uint8_t index = binaryInput[1];
+  const uint8_t* word;
+  uint16_t len;
+
+  if (index < textDictionarySize){
+    word = (const uint8_t*)textDictionary[index];
+    len = strlen(textDictionary[index]);
+  }
+  else{
+    index -= textDictionarySize;
+    if (index >= TEXT_WINDOW || !textDecoder.valid || textDecoder.len[index] == 0)
+      return 0;
+    word = textDecoder.word[index];
+    len = textDecoder.len[index];
+  }
+  if (len + 1 > room)
+    return 0;
+  memcpy(hexaOutput, word, len);
+  hexaOutput[len] = STRING_TERMINATOR;
+  return len + 1;
+}
+
+uint16_t textDecodedMax(uint8_t* binaryInput)
+{
+  if (binaryInput[1] < textDictionarySize)
+    return strlen(textDictionary[binaryInput[1]]) + 1;
+  return TEXT_MAX_WORD + 1;
+}
+
+void textDecoded(uint8_t* word, uint16_t wordLen)
+{
+  textStore(&textDecoder, word, wordLen);
+}
+
+void textEncoderReset(void)
+{
+  memset(&textEncoder, 0, sizeof(textEncoder));
+  textEncoder.valid = 1;
+}
+
+void textEncoderLost(void)
+{
+  textEncoder.valid = 0;
+}
+
+void textDecoderReset(void)
+{
+  memset(&textDecoder, 0, sizeof(textDecoder));
+  textDecoder.valid = 1;
+}
+
+void textDecoderLost(void)
+{
+  textDecoder.valid = 0;
+}
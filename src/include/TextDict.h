@@ -0,0 +1,108 @@
+/**
+ *****************************************************************************
+   @file     TextDict.h
+   @brief    tokens of recurring text words (status strings of radars,
+             '#' messages) by static dictionary and window of last words
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    enabled by TEXT_DICTIONARY in settings.h (needs COMPRESSION_V2),
+            word which is not hexadecimal is searched in textDictionary[]
+            and in window of last TEXT_WINDOW text words, found word is
+            sent as token [TEXT_TOKEN][index]
+   @note    window is superframe of slave: encoder is reset by transmit()
+            of slave, decoder by flush of master, words of missing packet
+            are unknown and tokens of window are dropped until next reset,
+            slave is not using window behind dropped word
+   @note    textDictionary[] is const (flash), master and slaves must be
+            build with same TextDict.c
+   @code
+        // slave, not hexadecimal word
+        if ((len = textEncode(word, wordLen, output)) == 0)
+          ... raw word
+        // master
+        if (*input == TEXT_TOKEN)
+          output += textDecode(input, output, outEnd - output);
+        else
+          textDecoded(word, wordLen);     // raw word to window
+   @endcode
+**/
+#ifndef __TEXTDICT_H
+#define __TEXTDICT_H
+
+#include <stdint.h>
+#include "../settings.h"
+
+/** @brief header of token, hexadecimal words of format v2 are at most COMPRESSION_MAX_NIBBLES **/
+#define TEXT_TOKEN          0xFC
+/** @brief lenght of token **/
+#define TEXT_TOKEN_LEN      2
+
+/** @brief words of static dictionary, index of token is index of word **/
+extern const char* const textDictionary[];
+extern const uint8_t textDictionarySize;
+
+/**
+   @fn     uint16_t textEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput)
+   @brief  token of word found in dictionary or window
+   @param  uint8_t* word : first char of word
+   @param  uint16_t wordLen : lenght of word without STRING_TERMINATOR
+   @param  uint8_t* binaryOutput : destination of token
+   @return uint16_t - TEXT_TOKEN_LEN, 0 if word is not found (word is stored
+           to window if it is not longer as TEXT_MAX_WORD)
+**/
+uint16_t textEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput);
+
+/**
+   @fn     uint16_t textDecode(uint8_t* binaryInput, uint8_t* hexaOutput, uint16_t room)
+   @brief  word of token with STRING_TERMINATOR
+   @param  uint8_t* binaryInput : token (TEXT_TOKEN)
+   @param  uint8_t* hexaOutput : destination
+   @param  uint16_t room : size of destination
+   @return uint16_t - lenght of output, 0 if index is unknown, window is lost
+           or word do not fit
+**/
+uint16_t textDecode(uint8_t* binaryInput, uint8_t* hexaOutput, uint16_t room);
+
+/**
+   @fn     uint16_t textDecodedMax(uint8_t* binaryInput)
+   @brief  longest output of textDecode() for token
+   @note   slave is limiting decompressed lenght of packet (DECOMPRESSED_DEPTH),
+           word of window can be replaced until packet is built
+**/
+uint16_t textDecodedMax(uint8_t* binaryInput);
+
+/**
+   @fn     void textDecoded(uint8_t* word, uint16_t wordLen)
+   @brief  raw word decoded by master is stored to window like in textEncode()
+**/
+void textDecoded(uint8_t* word, uint16_t wordLen);
+
+/**
+   @fn     void textEncoderReset(void)
+   @brief  empty window of encoder, start of superframe of slave
+**/
+void textEncoderReset(void);
+
+/**
+   @fn     void textDecoderReset(void)
+   @brief  empty window of decoder, start of flush of master
+**/
+void textDecoderReset(void);
+
+/**
+   @fn     void textEncoderLost(void)
+   @brief  compressed word is dropped by slave, window is not used until
+           textEncoderReset(), master do not know the word
+**/
+void textEncoderLost(void);
+
+/**
+   @fn     void textDecoderLost(void)
+   @brief  packet is missing or broken, tokens of window are dropped until
+           textDecoderReset()
+**/
+void textDecoderLost(void);
+
+#endif
@@ -0,0 +1,264 @@
+#include <string.h>
+#include "../settings.h"
+#include "UwbCodec.h"
+#include "../../tests/PktTester/PRNG.h"
+
+/** @brief last frame of radar, reference of next delta frame **/
+struct uwbRadar {
+  uint8_t  used;                    // reference is valid
+  uint8_t  source;                  // slave of radar (decoder), 0 on encoder
+  uint8_t  radarID;
+  uint8_t  packetCount;             // of last frame
+  uint8_t  frames;                  // frames since keyframe
+  uint8_t  values;                  // number of values
+  uint16_t value[UWB_MAX_VALUES];
+};
+
+#if UWB_ENCODER
+static struct uwbRadar uwbEncoder[UWB_MAX_RADARS];    // slave
+static uint8_t uwbEncoderNext;                        // round robin replacement
+#endif
+#if UWB_DECODER
+static struct uwbRadar uwbDecoder[UWB_DECODER_RADARS];    // master, radars of all slaves
+static uint8_t uwbDecoderNext;
+#endif
+static uint8_t uwbSource;                             // slave of decoded records
+
+// UWB_RADAR_BYTES of budget in UwbCodec.h is size of reference
+typedef char uwbRadarBytesCheck[(sizeof(struct uwbRadar) == UWB_RADAR_BYTES) ? 1 : -1];
+#if UWB_COMPRESSION && UWB_DECODER && UWB_DECODER_RADARS * UWB_RADAR_BYTES > UWB_DECODER_BUDGET
+#error "uwbDecoder[] is not fitting into IRAM of master, decrease UWB_MAX_RADARS or UWB_MAX_VALUES"
+#endif
+
+#if UWB_DECODER
+static const uint8_t uwbHexa[] = "0123456789ABCDEF";
+#endif
+
+/**
+   @fn     static uint16_t uwbChars(uint8_t* hexa, uint8_t count)
+   @brief  value of count hexadecimal chars ('0'-'9', 'A'-'F')
+**/
+static uint16_t uwbChars(uint8_t* hexa, uint8_t count)
+{
+  uint16_t value = 0;
+
+  while (count--){
+    value = (value << 4) | (uint16_t)((*hexa <= '9') ? *hexa - '0' : *hexa - 'A' + 10);
+    hexa++;
+  }
+  return value;
+}
+
+/**
+   @fn     static struct uwbRadar* uwbRadarFind(struct uwbRadar* table, uint8_t size, uint8_t* next, uint8_t source, uint8_t radarID, uint8_t create)
+   @brief  reference of radarID of source, with create is free or oldest place taken
+   @return struct uwbRadar* - reference, NULL if not found and not create
+**/
+static struct uwbRadar* uwbRadarFind(struct uwbRadar* table, uint8_t size, uint8_t* next, 
+                                     uint8_t source, uint8_t radarID, uint8_t create)
+{
+  uint8_t i;
+
+  for (i = 0; i < size; i++)
+    if (table[i].used && table[i].radarID == radarID && table[i].source == source)
+      return &table[i];
+  if (!create)
+    return NULL;
+  for (i = 0; i < size; i++)
+    if (!table[i].used)
+      break;
+  if (i == size){
+    i = *next;
+    *next = (i + 1) % size;
+  }
+  table[i].used = 0;
+  table[i].source = source;
+  table[i].radarID = radarID;
+  return &table[i];
+}
+
+#if UWB_ENCODER
+/**
+   @fn     uint16_t uwbEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput)
+   @brief  code hexadecimal word as keyframe or delta frame record
+   @param  uint8_t* word : first char of word, only chars '0'-'9' and 'A'-'F'
+   @param  uint16_t wordLen : lenght of word without STRING_TERMINATOR
+   @param  uint8_t* binaryOutput : destination of record (not overlapping word)
+   @return uint16_t - lenght of record, 0 if word is not UWB frame
+**/
+uint16_t uwbEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput)
+{
+  struct uwbRadar* radar;
+  uint8_t *output = binaryOutput + 2, *hexa;
+  uint8_t values, count, delta, i;
+  uint16_t value, zigzag;
+  int16_t diff;
+
+  if (wordLen < UWB_HEAD_CHARS + 3 + UWB_CRC_CHARS
+      || (wordLen - UWB_HEAD_CHARS - UWB_CRC_CHARS) % 3 != 0
+      || (wordLen - UWB_HEAD_CHARS - UWB_CRC_CHARS) / 3 > UWB_MAX_VALUES)
+    return 0;
+  values = (wordLen - UWB_HEAD_CHARS - UWB_CRC_CHARS) / 3;
+  count = (uint8_t)uwbChars(&word[4], 2);
+
+  radar = uwbRadarFind(uwbEncoder, UWB_MAX_RADARS, &uwbEncoderNext, 0, (uint8_t)uwbChars(word, 2), 1);
+  delta = radar->used && radar->values == values && radar->frames < UWB_KEYFRAME_INTERVAL
+          && (uint8_t)(radar->packetCount + 1) == count;
+
+  hexa = &word[UWB_HEAD_CHARS];
+  if (delta){
+    *output++ = (uint8_t)uwbChars(word, 2);
+    *output++ = (uint8_t)uwbChars(&word[2], 2);
+    *output++ = count;
+    for (i = 0; i < values; i++, hexa += 3){
+      value = uwbChars(hexa, 3);
+      // difference in 12 bit ring -2048..2047, zig-zag 0, -1, 1, -2 ... to 0..4095
+      diff = (int16_t)((value - radar->value[i] + 2048) & 0x0FFF) - 2048;
+      zigzag = (uint16_t)((diff << 1) ^ (diff >> 15)) & 0x0FFF;
+      if (zigzag < 0x80)
+        *output++ = (uint8_t)zigzag;
+      else{
+        *output++ = (uint8_t)(0x80 | (zigzag & 0x7F));
+        *output++ = (uint8_t)(zigzag >> 7);
+      }
+      radar->value[i] = value;
+    }
+    hexaToBin(hexa, output, UWB_CRC_CHARS / 2);
+    output += UWB_CRC_CHARS / 2;
+    radar->frames++;
+  }
+  else{
+    hexaToBin(word, output, wordLen / 2);
+    output += wordLen / 2;
+    if (wordLen % 2)
+      *output++ = (uint8_t)(uwbChars(&word[wordLen - 1], 1) << 4);   // padded by '0'
+    for (i = 0; i < values; i++, hexa += 3)
+      radar->value[i] = uwbChars(hexa, 3);
+    radar->values = values;
+    radar->frames = 1;
+    radar->used = 1;
+  }
+  radar->packetCount = count;
+
+  binaryOutput[0] = delta ? UWB_DELTA : UWB_KEY;
+  binaryOutput[1] = (uint8_t)(output - binaryOutput - 2);
+  return output - binaryOutput;
+}
+#else
+/**
+   @fn     uint16_t uwbEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput)
+   @brief  without UWB_ENCODER (master) word is not coded, 0
+**/
+uint16_t uwbEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput)
+{
+  (void)word;
+  (void)wordLen;
+  (void)binaryOutput;
+  return 0;                           // master is not coding words
+}
+#endif
+
+#if UWB_DECODER
+/**
+   @fn     uint16_t uwbDecode(uint8_t* binaryInput, uint8_t* hexaOutput)
+   @brief  decode record to hexadecimal word with STRING_TERMINATOR
+   @param  uint8_t* binaryInput : header of record (UWB_KEY or UWB_DELTA)
+   @param  uint8_t* hexaOutput : destination, up to 3 chars per byte of record
+   @return uint16_t - lenght of output, 0 if delta frame without reference is dropped
+**/
+uint16_t uwbDecode(uint8_t* binaryInput, uint8_t* hexaOutput)
+{
+  struct uwbRadar* radar;
+  uint8_t *input = binaryInput + 2, *end = input + binaryInput[1], *hexa = hexaOutput;
+  uint16_t chars, value, zigzag;
+  uint8_t i;
+
+  if (binaryInput[0] == UWB_KEY){
+    chars = binaryInput[1] * 2;
+    binToHexa(input, hexaOutput, binaryInput[1]);
+    if ((chars - UWB_HEAD_CHARS - UWB_CRC_CHARS) % 3 != 0)
+      chars--;                        // padding of odd word
+    hexaOutput[chars] = STRING_TERMINATOR;
+
+    radar = uwbRadarFind(uwbDecoder, UWB_DECODER_RADARS, &uwbDecoderNext, uwbSource, input[0], 1);
+    if (chars >= UWB_HEAD_CHARS + 3 + UWB_CRC_CHARS
+        && (chars - UWB_HEAD_CHARS - UWB_CRC_CHARS) / 3 <= UWB_MAX_VALUES){
+      radar->values = (chars - UWB_HEAD_CHARS - UWB_CRC_CHARS) / 3;
+      radar->packetCount = input[2];
+      for (i = 0, hexa += UWB_HEAD_CHARS; i < radar->values; i++, hexa += 3)
+        radar->value[i] = uwbChars(hexa, 3);
+      radar->used = 1;
+    }
+    return chars + 1;
+  }
+
+  // delta frame, reference must be previous packetCount (no frame lost)
+  radar = uwbRadarFind(uwbDecoder, UWB_DECODER_RADARS, &uwbDecoderNext, uwbSource, input[0], 0);
+  if (radar == NULL)
+    return 0;
+  if ((uint8_t)(radar->packetCount + 1) != input[2]){
+    radar->used = 0;
+    return 0;
+  }
+  radar->packetCount = input[2];
+  binToHexa(input, hexa, 3);          // radarID, radarTime, packetCount
+  hexa += UWB_HEAD_CHARS;
+  input += 3;
+  for (i = 0; i < radar->values && input < end; i++){
+    zigzag = *input++;
+    if ((zigzag & 0x80) && input < end)
+      zigzag = (zigzag & 0x7F) | ((uint16_t)*input++ << 7);
+    value = (radar->value[i] + ((zigzag >> 1) ^ (uint16_t)-(int16_t)(zigzag & 1))) & 0x0FFF;
+    radar->value[i] = value;
+    *hexa++ = uwbHexa[value >> 8];
+    *hexa++ = uwbHexa[(value >> 4) & 0x0F];
+    *hexa++ = uwbHexa[value & 0x0F];
+  }
+  if (i != radar->values || input + UWB_CRC_CHARS / 2 != end){
+    radar->used = 0;                  // broken record, wait for keyframe
+    return 0;
+  }
+  binToHexa(input, hexa, UWB_CRC_CHARS / 2);
+  hexa += UWB_CRC_CHARS;
+  *hexa++ = STRING_TERMINATOR;
+  return hexa - hexaOutput;
+}
+#else
+/**
+   @fn     uint16_t uwbDecode(uint8_t* binaryInput, uint8_t* hexaOutput)
+   @brief  without UWB_DECODER (slave) record is dropped, 0
+**/
+uint16_t uwbDecode(uint8_t* binaryInput, uint8_t* hexaOutput)
+{
+  (void)binaryInput;
+  (void)hexaOutput;
+  return 0;                           // slave is not decoding records
+}
+#endif
+
+/**
+   @fn     void uwbDecoderSource(uint8_t source)
+   @brief  select slave of next records of uwbDecode()
+   @param  uint8_t source : slave ID, radarID of two slaves are different radars
+**/
+void uwbDecoderSource(uint8_t source)
+{
+  uwbSource = source;
+}
+
+/**
+   @fn     void uwbReset(void)
+   @brief  forget all radars, next frames of encoder are keyframes
+**/
+void uwbReset(void)
+{
+#if UWB_ENCODER
+  memset(uwbEncoder, 0, sizeof(uwbEncoder));
+  uwbEncoderNext = 0;
+#endif
+#if UWB_DECODER
+  memset(uwbDecoder, 0, sizeof(uwbDecoder));
+  uwbDecoderNext = 0;
+#endif
+  uwbSource = 0;
+}
@@ -0,0 +1,119 @@
+/**
+ *****************************************************************************
+   @file     UwbCodec.h
+   @brief    delta coding of UWB frames of uwbPacketTx::generatePacket(),
+             12 bit coordinates are coded against previous frame of same
+             radarID as zig-zag varints, keyframe is periodic for resync
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    enabled in hexaToBinaryCompression() / binaryToHexaDecompression()
+            by UWB_COMPRESSION in settings.h, uwbEncode() is used on slave,
+            uwbDecode() on master
+   @note    UWB frame is hexadecimal word "IITTCC" + 3 chars per value + 4 chars
+            of CRC (radarID, radarTime, packetCount), record of frame is
+              - keyframe : UWB_KEY, lenght, word packed like hexaToBin()
+                           (odd word is padded by '0')
+              - delta    : UWB_DELTA, lenght, radarID, radarTime, packetCount,
+                           varint of each value, 2 bytes of CRC chars
+            lenght is number of bytes behind lenght
+   @note    delta frame is coded only if previous frame of radarID is
+            packetCount - 1 and has same number of values, decoder is dropping
+            delta frames after lost frame (gap of packetCount) until next keyframe
+   @note    references of decoder are kept per slave (uwbDecoderSource()),
+            slaves are sending the same radarID for different radars
+   @note    tables of references are allocated only on role using them,
+            uwbEncoder[] on slave (UWB_DECODER 0), uwbDecoder[] on master
+            (UWB_ENCODER 0), with both (host tools) are both allocated
+   @note    IRAM budget of master (16 KB) : pktMemory 9642 B, dmaTxBuffer
+            1440 B (272 B with STREAM_FLUSH), entropyBuffer 240 B with
+            ENTROPY_CODING, 1.5 KB of stack and heap of startup and 1 KB of
+            other globals, uwbDecoder[] of UWB_DECODER_RADARS * UWB_RADAR_BYTES
+            must fit into rest (UWB_DECODER_BUDGET), UwbCodec.c is checking
+            it, 4 slaves with UWB_MAX_RADARS 6 are taking 2064 B of 2502 B
+   @note    gain is limited by byte aligned records, 12 bit value is 1.5 B of
+            keyframe and at least 1 B of delta, head and CRC (5 B) are not coded,
+            frame of 20 values is at best 36 B -> 25 B (MicroBench: 27.6 B at
+            random walk of 5 units per frame), more needs ENTROPY_CODING
+   @code
+        // slave, word is checked hexadecimal word without STRING_TERMINATOR
+        len = uwbEncode(word, wordLen, binaryOutput);   // 0 if not UWB frame
+        ...
+        // master, record with header >= UWB_DELTA
+        hexaLen = uwbDecode(binaryInput, hexaOutput);   // 0 if dropped
+        binaryInput += binaryInput[1] + 2;
+   @endcode
+**/
+#ifndef __UWB_CODEC_H
+#define __UWB_CODEC_H
+
+#include <stdint.h>
+#include "../settings.h"
+
+/** @brief headers of records, hexadecimal word header (wordLen/2) is always smaller **/
+#define UWB_KEY     0xFE
+#define UWB_DELTA   0xFD
+
+/** @brief chars of radarID, radarTime, packetCount and CRC in frame **/
+#define UWB_HEAD_CHARS  6
+#define UWB_CRC_CHARS   4
+/** @brief longest output of uwbDecode() with STRING_TERMINATOR **/
+#define UWB_MAX_CHARS   (UWB_HEAD_CHARS + 3 * UWB_MAX_VALUES + UWB_CRC_CHARS + 1)
+
+/** @brief bytes of one reference (struct uwbRadar) **/
+#define UWB_RADAR_BYTES (6 + 2 * UWB_MAX_VALUES)
+
+/** @brief IRAM of ADuCRF101 and Stack_Size + Heap_Size of startup_ADuCRF101.s **/
+#define UWB_IRAM_SIZE       0x4000
+#define UWB_STACK_HEAP      0x600
+/** @brief globals of master besides buffers below (slaves, Buffer, rxBuffer, libraries) **/
+#define UWB_OTHER_GLOBALS   1024
+#define UWB_PKT_MEMORY      (2 * (NUM_OF_PACKETS_IN_MEMORY * (PACKET_MEMORY_DEPTH + 1) + 1))
+#if STREAM_FLUSH
+#define UWB_DMA_TX          (2 * DMA_CHUNK_DEPTH)
+#else
+#define UWB_DMA_TX          (2 * DECOMPRESSED_DEPTH)
+#endif
+#if ENTROPY_CODING
+#define UWB_ENTROPY_BUFFER  PACKET_MEMORY_DEPTH
+#else
+#define UWB_ENTROPY_BUFFER  0
+#endif
+/** @brief IRAM of master left for uwbDecoder[] **/
+#define UWB_DECODER_BUDGET  (UWB_IRAM_SIZE - UWB_STACK_HEAP - UWB_OTHER_GLOBALS - UWB_PKT_MEMORY \
+                             - UWB_DMA_TX - UWB_ENTROPY_BUFFER)
+
+/**
+   @fn     uint16_t uwbEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput)
+   @brief  code hexadecimal word as keyframe or delta frame record
+   @param  uint8_t* word : first char of word, only chars '0'-'9' and 'A'-'F'
+   @param  uint16_t wordLen : lenght of word without STRING_TERMINATOR
+   @param  uint8_t* binaryOutput : destination of record (not overlapping word)
+   @return uint16_t - lenght of record, 0 if word is not UWB frame
+**/
+uint16_t uwbEncode(uint8_t* word, uint16_t wordLen, uint8_t* binaryOutput);
+
+/**
+   @fn     uint16_t uwbDecode(uint8_t* binaryInput, uint8_t* hexaOutput)
+   @brief  decode record to hexadecimal word with STRING_TERMINATOR
+   @param  uint8_t* binaryInput : header of record (UWB_KEY or UWB_DELTA)
+   @param  uint8_t* hexaOutput : destination, up to 3 chars per byte of record
+   @return uint16_t - lenght of output, 0 if delta frame without reference is dropped
+**/
+uint16_t uwbDecode(uint8_t* binaryInput, uint8_t* hexaOutput);
+
+/**
+   @fn     void uwbDecoderSource(uint8_t source)
+   @brief  select slave of next records of uwbDecode()
+   @param  uint8_t source : slave ID, radarID of two slaves are different radars
+**/
+void uwbDecoderSource(uint8_t source);
+
+/**
+   @fn     void uwbReset(void)
+   @brief  forget all radars, next frames of encoder are keyframes
+**/
+void uwbReset(void);
+
+#endif
@@ -43,6 +43,13 @@
 /** @brief size of RAM memory for packet in radio interface **/
 #define PACKETRAM_LEN          240
 
+/** @brief address in FLASH memory where is stored radio configuration
+    @note  host build (tests/FirmwareSim) redirect this address into simulated FLASH
+**/
+#ifndef RADIO_CONF_ADDRESS
+#define RADIO_CONF_ADDRESS     0x1f000
+#endif
+
 
 /*******************************************************************************
 * Radio configuration macros
@@ -139,19 +146,84 @@
 */
  /**
     @brief  set function to calculate CRC sum
-    @note   the reason why use crcSlow is that crcFast is using much more memory       
+    @note   table of crcFast is computed by compiler and it is constant in
+            flash (512 bytes), it is not using RAM
     @param  bool :{1 , 0}
          - 1 if crcFast
+         - 0 if crcSlow (or crcNibble)
+ **/
+#ifndef CRC_FAST
+#define CRC_FAST 1
+#endif
+ /**
+    @brief  crcNibble instead of crcSlow if not CRC_FAST
+    @note   crcNibble is using 16 entry table in flash (32 bytes), it is
+            several times faster than crcSlow
+    @param  bool :{1 , 0}
+         - 1 if crcNibble
          - 0 if crcSlow
  **/
-#define CRC_FAST 0
+#ifndef CRC_NIBBLE
+#define CRC_NIBBLE 1
+#endif
+ /**
+    @brief  integrity of firmware by Sign command of flash controller (FeeSign())
+            instead of CRC, boot is not waiting for CRC of whole FLASH
+    @note   .hex file must be signed by Integrity/FeeSign.bat (signature in
+            last 4 bytes of FLASH instead of CRC of Integrity.bat)
+    @param  bool :{1 , 0}
+         - 1 if signature of flash controller
+         - 0 if CRC (CRC_FAST, CRC_NIBBLE)
+ **/
+#ifndef FEE_SIGN
+#define FEE_SIGN 0
+#endif
 
 #define COMPRESSION 1          /*!< @brief sending packets via UART in hexadecimal ASCII chars and binary compressed trought air*/
 #define ADAPTIVE_COMPRESSION 1 /*!< @brief if received data do not contain ascii chars do not drop packet but send without compression*/
+/*! @brief slave is compressing to format v2 (hexaToBinaryCompressionV2()), blocks
+           with version and lenght, odd and lowercase hexadecimal words
+    @note  master is decompressing both formats
+*/
+#ifndef COMPRESSION_V2
+#define COMPRESSION_V2 0
+#endif
+/*! @brief compressed word is longer by up to COMPRESSION_OVERHEAD bytes than word with STRING_TERMINATOR */
+#if COMPRESSION_V2
+#define COMPRESSION_OVERHEAD 3
+#else
+#define COMPRESSION_OVERHEAD 2
+#endif
+/*! @brief not hexadecimal words (status strings, '#' messages) are sent as
+           token of static dictionary or window of last words (TextDict.h)
+    @note  needs COMPRESSION_V2, master and slaves must be build with same
+           setting and TextDict.c
+*/
+#ifndef TEXT_DICTIONARY
+#define TEXT_DICTIONARY 0
+#endif
+#define TEXT_WINDOW 8             /*!< @brief last text words of superframe in window {1-200} */
+#define TEXT_MAX_WORD 32          /*!< @brief longest word stored to window (RAM 2*TEXT_WINDOW*TEXT_MAX_WORD) */
 /*! @brief start sending data trought UART in main loop
     @note  fast fulsh is not reliable if COMPRESSION is turned on
 */
 #define SLOW_FLUSH 1
+/*! @brief master is decompressing packets in chunks of DMA_CHUNK_DEPTH chars
+           (decompressStream()), next chunk is decompressed in
+           DMA_UART_TX_Int_Handler() while previous chunk is sent
+    @note  replaces SLOW_FLUSH, dmaTxBuffer is 2*DMA_CHUNK_DEPTH instead of
+           2*DECOMPRESSED_DEPTH bytes, needs COMPRESSION
+*/
+#ifndef STREAM_FLUSH
+#define STREAM_FLUSH 0
+#endif
+/*! @brief master is sending payloads of packets as COBS framed binary records
+           (Cobs.h) instead of hexadecimal words, about half of UART bytes
+    @note  read by PktReader -binary, needs COMPRESSION, not with STREAM_FLUSH
+*/
+#ifndef BINARY_OUTPUT
+#define BINARY_OUTPUT 0
+#endif
  /**
     @brief  char witch terminate all received packets     
     @param  char :{'$'}
@@ -171,6 +243,65 @@
 #define UART_BUFFER_DEEPTH PACKET_MEMORY_DEPTH*2
 #else 
 #define UART_BUFFER_DEEPTH PACKET_MEMORY_DEPTH
+#endif
+
+/*! @brief delta coding of UWB frames of uwbPacketTx (UwbCodec.h)
+    @note  coordinates are coded against previous frame of same radarID as
+           zig-zag varints, slave is packing records of more UART buffers
+           into one packet, needs COMPRESSION, master and slaves must be
+           build with same setting
+*/
+#ifndef UWB_COMPRESSION
+#define UWB_COMPRESSION 0
+#endif
+#ifndef UWB_ENCODER
+#define UWB_ENCODER 1             /*!< @brief references of uwbEncode(), 0 in Define of Master target */
+#endif
+#ifndef UWB_DECODER
+#define UWB_DECODER 1             /*!< @brief references of uwbDecode(), 0 in Define of Slave target */
+#endif
+#define UWB_KEYFRAME_INTERVAL 16  /*!< @brief frames of radar between keyframes {1-255} */
+#define UWB_MAX_RADARS 6          /*!< @brief radars with reference of slave, 6 B + 2 B per value each, IRAM budget in UwbCodec.h */
+#define UWB_DECODER_RADARS (UWB_MAX_RADARS * NUMBER_OF_SLAVES)  /*!< @brief references of master, radars of all slaves {1-255} */
+#define UWB_MAX_VALUES 40         /*!< @brief values (x, y) of one frame {1-80} */
+
+/*! @brief static Huffman coding of packet payloads (Entropy.h)
+    @note  tables are trained offline by tests/PktTester/EntropyTrain into
+           EntropyTables.c, slave is choosing table per packet (ID in head),
+           needs COMPRESSION, master and slaves must be build with same tables
+*/
+#ifndef ENTROPY_CODING
+#define ENTROPY_CODING 0
+#endif
+
+/*! @brief slave is compressing any word in UART_Int_Handler() when
+           STRING_TERMINATOR is received, directly into last packet of memory
+    @note  only one word is buffered (UART_WORD_DEEPTH) instead of two UART
+           buffers, storePkt() is only printing messages and coding closed
+           packets by ENTROPY_CODING, needs COMPRESSION
+*/
+#ifndef UART_WORD_COMPRESSION
+#define UART_WORD_COMPRESSION 0
+#endif
+/*! @brief longest word with STRING_TERMINATOR, compressed word can take COMPRESSION_OVERHEAD bytes more */
+#define UART_WORD_DEEPTH (PACKET_MEMORY_DEPTH - HEAD_LENGHT - COMPRESSION_OVERHEAD)
+
+/*! @brief longest output of binaryToHexaDecompression() for one packet
+    @note  delta frame of UWB is less than 3 chars per byte
+*/
+#if UWB_COMPRESSION
+#define DECOMPRESSED_DEPTH (PACKET_MEMORY_DEPTH*3)
+#else
+#define DECOMPRESSED_DEPTH (PACKET_MEMORY_DEPTH*2)
+#endif
+
+/*! @brief chars of one DMA transfer of master with STREAM_FLUSH
+    @note  at least COMPRESSION_STREAM_MIN, UWB frame is not split
+*/
+#if UWB_COMPRESSION
+#define DMA_CHUNK_DEPTH (3*UWB_MAX_VALUES + 16)
+#else
+#define DMA_CHUNK_DEPTH 64
 #endif
 
  /**
@@ -189,7 +320,9 @@
             macro set size of packet memory
     @param  number of slave devices :{1 , 10} 4
  **/
+#ifndef NUMBER_OF_SLAVES
 #define NUMBER_OF_SLAVES 4  //number of slave devices
+#endif
 
  /**
     @brief  lenght of received packets from UART
@@ -208,13 +341,46 @@
  **/
 #define SYNC_INTERVAL 200 
 
+ /**
+    @brief  duration of one loop of radioRecieve() waiting for packet in ns
+    @note   measured 5500 loops at max lenght packet at 300 kbps (6827 us)
+    @see    T_TIMEOUT
+ **/
+#define RX_LOOP_NS 1241
+
+ /**
+    @brief  timeout of radioRecieve() against response time in permille
+    @param  margin :{1250 = 25 % margin}
+ **/
+#define RX_TIMEOUT_MARGIN_PERMILLE 1250ULL
+
+ /**
+    @brief  number of radioRecieve() loops of TX turnaround and airtime of
+            response with max lenght, with RX_TIMEOUT_MARGIN_PERMILLE
+    @note   us * 1000 (ns) * permille / 1000 is us * permille
+    @see    Airtime.h
+ **/
+#define RX_RESPONSE_LOOPS(BaseConfig, Manchester) \
+  ((AIRTIME_TX_TURNAROUND_US + AIRTIME_US(BaseConfig, Manchester, PACKETRAM_LEN - 1)) \
+   * RX_TIMEOUT_MARGIN_PERMILLE / RX_LOOP_NS)
+
+ /**
+    @brief  number of radioRecieve() loops to receive response with max lenght
+    @note   RX_RESPONSE_LOOPS limited by uint16_t counter of radioRecieve()
+    @see    tests/AirtimeTest
+ **/
+#define RX_TIMEOUT_LOOPS(BaseConfig, Manchester) \
+  ((uint16_t)(RX_RESPONSE_LOOPS(BaseConfig, Manchester) < 0xfffe ? \
+              RX_RESPONSE_LOOPS(BaseConfig, Manchester) : 0xfffe))
+
  /**
     @brief  max time(number of increments) to response of requested device
-    @note   interval witch is counted until packet is received (empiric 5500 at max lenght packet)
+    @note   interval witch is counted until packet is received,
+            derived from RADIO_CFG and RADIO_MANCHASTER
     @see    radioRecieve()
-    @param  time :{7000 ~ 0.8ms}
+    @param  time :{RX_TIMEOUT_LOOPS(RADIO_CFG, RADIO_MANCHASTER)}
  **/
-#define T_TIMEOUT 7000     //max time(number of increments) to response of slave 
+#define T_TIMEOUT RX_TIMEOUT_LOOPS(RADIO_CFG, RADIO_MANCHASTER)     //max time(number of increments) to response of slave 
 
 /**
     @brief  max time(number of increments) to flush all buffered packets
@@ -282,7 +448,9 @@
      @param slave number{1 - NUMBER_OF_SLAVES}
  **/
  //Slave == 1..4 number
+#ifndef SLAVE_ID
 #define SLAVE_ID 4
+#endif
 
 //slave identificating macros
  /** @brief  format of slot identificator  
@@ -321,6 +489,35 @@
 #define TX_STREAM 0       /*!< @brief stream of transmited data to UART**/
 #define SEND_HEAD 0       /*!< @brief send also heads of packets on UART**/   
 
+/*! @brief DWT cycle counter profiling of hot sections (Profile.h)
+    @note  table is printed on UART after "PROF$" directive at master UART,
+           master is forwarding directive also to slaves
+*/
+#ifndef PROFILING
+#define PROFILING 0
+#endif
+
+/*! @brief capture of radio frames into RAM ring (RadioCapture.h)
+    @note  records are printed on UART after "CAPT$" directive at master UART,
+           master is forwarding directive also to slaves, output of master is
+           input of replay in tests/FirmwareSim (SimRun -R)
+*/
+#ifndef RADIO_CAPTURE
+#define RADIO_CAPTURE 0
+#endif
+#ifndef RADIO_CAPTURE_SIZE
+#define RADIO_CAPTURE_SIZE 2048   /*!< @brief bytes of ring {256-65535}, record is 7 B + payload */
+#endif
+
+/*! @brief throughput telemetry any second (Telemetry.h)
+    @note  status frame "\ntlm ...#" is printed on UART of master and slaves,
+           period is measured by timer1 (GP_Tmr1_Int_Handler)
+*/
+#ifndef TELEMETRY
+#define TELEMETRY 0
+#endif
+#define TELEMETRY_INTERVAL 62500  /*!< @brief 1 s = 16 000 000 / 256 / 62500 [s] */
+
 /*! @brief start checking PRNG packets local (on master} 
     @note  packets are not streamed on UART only messages
 */
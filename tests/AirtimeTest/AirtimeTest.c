@@ -0,0 +1,108 @@
+/**
+ *****************************************************************************
+   @file     AirtimeTest.c
+   @brief    host test of src/include/Airtime.c, airtime of frames is compared
+             with values computed by hand from frame of ADF7023 packet handler
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    frame is preamble 12 B, sync word 2 B, length byte, payload and
+            CRC 2 B, Manchester doubles length byte, payload and CRC,
+            exit code 0 if all checks passed
+   @note    macros AIRTIME_US() and RX_TIMEOUT_LOOPS() of settings.h are
+            compared with functions for each configuration and lenght
+   @see     read_me.txt
+**/
+#include <stdio.h>
+#include <stdint.h>
+#include "radioeng.h"
+#include "settings.h"
+#include "Airtime.h"
+
+/** @brief airtime of frame computed by hand **/
+struct airtimeCase {
+  RIE_BaseConfigs config;
+  RIE_BOOL        manchester;
+  uint8_t         len;
+  uint32_t        us;
+};
+
+static const struct airtimeCase cases[] = {
+  // (12 + 2 + 1 + 239 + 2) * 8 = 2048 bits, 6826.7 us
+  { DR_300_0kbps_Dev75_0kHz, RIE_FALSE, 239,   6827 },
+  // (12 + 2 + 1 + 2) * 8 = 136 bits
+  { DR_300_0kbps_Dev75_0kHz, RIE_FALSE,   0,    454 },
+  { DR_38_4kbps_Dev20kHz,    RIE_FALSE,   0,   3542 },
+  { DR_38_4kbps_Dev20kHz,    RIE_FALSE, 239,  53334 },
+  // (12 + 2 + (1 + 239 + 2) * 2) * 8 = 3984 bits
+  { DR_38_4kbps_Dev20kHz,    RIE_TRUE,  239, 103750 },
+  // (12 + 2 + (1 + 10 + 2) * 2) * 8 = 320 bits
+  { DR_1_0kbps_Dev10_0kHz,   RIE_TRUE,   10, 320000 },
+  { DR_1_0kbps_Dev10_0kHz,   RIE_FALSE,  10, 216000 },
+};
+
+static const RIE_BaseConfigs configs[] = {
+  DR_1_0kbps_Dev10_0kHz, DR_38_4kbps_Dev20kHz, DR_300_0kbps_Dev75_0kHz
+};
+
+int main(void)
+{
+  int errors = 0, i, len, m;
+  uint32_t us;
+
+  for (i = 0; i < (int)(sizeof(cases) / sizeof(cases[0])); i++){
+    us = airtimeUs(cases[i].config, cases[i].manchester, cases[i].len);
+    if (us != cases[i].us && errors++ < 10)
+      printf("airtimeUs(%d, %d, %d) = %lu, expected %lu\n", cases[i].config, cases[i].manchester,
+             cases[i].len, (unsigned long)us, (unsigned long)cases[i].us);
+    us = airtimeResponseUs(cases[i].config, cases[i].manchester, cases[i].len);
+    if (us != cases[i].us + AIRTIME_TX_TURNAROUND_US && errors++ < 10)
+      printf("airtimeResponseUs(%d, %d, %d) = %lu, expected %lu\n", cases[i].config, cases[i].manchester,
+             cases[i].len, (unsigned long)us, (unsigned long)(cases[i].us + AIRTIME_TX_TURNAROUND_US));
+  }
+
+  // preamble 96 bits
+  if (airtimePreambleUs(DR_38_4kbps_Dev20kHz) != 2500 || airtimePreambleUs(DR_300_0kbps_Dev75_0kHz) != 320
+      || airtimePreambleUs(DR_1_0kbps_Dev10_0kHz) != 96000){
+    printf("airtimePreambleUs differs from 96 bits of preamble\n");
+    errors++;
+  }
+
+  // unsupported configuration
+  if (airtimeDataRate((RIE_BaseConfigs)7) != 0 || airtimeUs((RIE_BaseConfigs)7, RIE_FALSE, 10) != 0){
+    printf("unsupported configuration is not 0\n");
+    errors++;
+  }
+
+  // macro of compile-time settings against function
+  for (i = 0; i < 3; i++)
+    for (m = 0; m < 2; m++)
+      for (len = 0; len < PACKETRAM_LEN; len++){
+        us = airtimeUs(configs[i], m ? RIE_TRUE : RIE_FALSE, (uint8_t)len);
+        if (AIRTIME_US(configs[i], m, len) != us && errors++ < 10)
+          printf("AIRTIME_US(%d, %d, %d) = %lu, airtimeUs %lu\n", configs[i], m, len,
+                 (unsigned long)AIRTIME_US(configs[i], m, len), (unsigned long)us);
+      }
+
+  // timeout of radioRecieve(), (150 + 6827) * 1250 / 1241 loops at 300 kbps
+  if (RX_TIMEOUT_LOOPS(DR_300_0kbps_Dev75_0kHz, RIE_FALSE) != 7027){
+    printf("RX_TIMEOUT_LOOPS at 300 kbps = %u, expected 7027\n",
+           (unsigned)RX_TIMEOUT_LOOPS(DR_300_0kbps_Dev75_0kHz, RIE_FALSE));
+    errors++;
+  }
+  // (150 + 53334) * 1250 / 1241 loops at 38.4 kbps
+  if (RX_TIMEOUT_LOOPS(DR_38_4kbps_Dev20kHz, RIE_FALSE) != 53871){
+    printf("RX_TIMEOUT_LOOPS at 38.4 kbps = %u, expected 53871\n",
+           (unsigned)RX_TIMEOUT_LOOPS(DR_38_4kbps_Dev20kHz, RIE_FALSE));
+    errors++;
+  }
+  // 2 s at 1 kbps is over uint16_t counter
+  if (RX_TIMEOUT_LOOPS(DR_1_0kbps_Dev10_0kHz, RIE_FALSE) != 0xfffe){
+    printf("RX_TIMEOUT_LOOPS at 1 kbps is not limited to 0xfffe\n");
+    errors++;
+  }
+
+  printf("Airtime %s, T_TIMEOUT %u loops, %d errors\n", errors ? "FAIL" : "ok", (unsigned)T_TIMEOUT, errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,72 @@
+/**
+ *****************************************************************************
+   @file     CobsTest.cpp
+   @brief    host test of src/include/Cobs.c, COBS records of master (BINARY_OUTPUT)
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    records of PRNG payloads and of random payloads are decoded
+            and compared, changed byte and truncated frame must be refused,
+            exit code 0 if all checks passed
+   @see     read_me.txt
+**/
+#include <algorithm>
+#include <random>
+#include <stdio.h>
+#include <string.h>
+#include "settings.h"
+#include "Corpus.hpp"
+#include "Cobs.h"
+
+
+/**
+   @brief  recordDecode() of frame of recordEncode() must give the same payload,
+           frame contains delimiter only at ends, changed byte and truncated
+           frame are refused
+   @return number of wrong outputs
+**/
+static int checkRecords(const std::vector<Buffer>& payloads)
+{
+  uint8_t record[RECORD_HEAD + PACKET_MEMORY_DEPTH + RECORD_CRC], frame[RECORD_MAX_FRAME], decoded[RECORD_MAX_FRAME];
+  std::mt19937 rng(SEED + 2);
+  uint16_t len, pos;
+  uint8_t flip;
+  int errors = 0;
+
+  for (const Buffer& p : payloads){
+    record[0] = 1 + rng() % CORPUS_SLAVES;
+    record[1] = 1 + rng() % NUM_OF_PACKETS_IN_MEMORY;
+    memcpy(&record[RECORD_HEAD], p.data(), p.size());
+    len = recordEncode(record, p.size(), frame);
+    if (len > RECORD_MAX_FRAME || frame[0] != COBS_DELIMITER || frame[len - 1] != COBS_DELIMITER
+        || std::find(frame + 1, frame + len - 1, COBS_DELIMITER) != frame + len - 1
+        || recordDecode(frame + 1, len - 2, decoded) != RECORD_HEAD + p.size()
+        || memcmp(decoded, record, RECORD_HEAD + p.size()) != 0){
+      if (errors++ == 0)
+        fprintf(stderr, "recordDecode differs, payload %u B, frame %u B\n", (unsigned)p.size(), len);
+      continue;
+    }
+    pos = 1 + rng() % (len - 2);
+    flip = 1 + rng() % 255;
+    frame[pos] ^= flip;
+    if (recordDecode(frame + 1, len - 2, decoded) != 0 && errors++ == 0)
+      fprintf(stderr, "recordDecode is not refusing changed byte %u of %u B frame\n", pos, len);
+    frame[pos] ^= flip;
+    if (recordDecode(frame + 1, pos - 1, decoded) != 0 && errors++ == 0)
+      fprintf(stderr, "recordDecode is not refusing frame truncated to %u B\n", pos - 1);
+  }
+  return errors;
+}
+
+int main(void)
+{
+  std::vector<Buffer> prng = packetPayloads(prngWords(NULL), false);
+  std::vector<Buffer> random = randomPayloads();
+  int errors;
+
+  errors = checkRecords(prng) + checkRecords(random);
+  printf("CobsTest %s, %u records, %d errors\n", errors ? "FAIL" : "ok",
+         (unsigned)(prng.size() + random.size()), errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,274 @@
+/**
+ *****************************************************************************
+   @file     CompressionTest.cpp
+   @brief    host test of src/include/Compression.c and TextDict.c, formats v1
+             and v2 of PRNG, UWB, text corpora and of random buffers
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    hexaToBinaryCompression() is compared with two pass reference
+            kernel, decompressed words of format v2 and of decompressStream()
+            chunks are compared with input, exit code 0 if all checks passed
+   @note    corrupted data of both formats must not be decompressed out of
+            bounds, make SANITIZE=-fsanitize=address checks reading
+   @see     read_me.txt
+**/
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <stdio.h>
+#include <string.h>
+#include "settings.h"
+#include "Corpus.hpp"
+#include "Compression.h"
+#include "TextDict.h"
+
+
+/** @brief corrupted compressed buffers of each fuzz buffer **/
+#define FUZZ_MUTATIONS          4
+
+/**
+   @brief  compare output of kernel and reference kernel
+   @return number of different outputs
+**/
+static int checkCompression(const std::vector<Buffer>& buffers)
+{
+  uint8_t dest[UART_BUFFER_DEEPTH * 2], ref[UART_BUFFER_DEEPTH * 2];
+  int errors = 0;
+
+  for (const Buffer& b : buffers){
+    // kernels are reading STRING_TERMINATOR behind last word without it
+    Buffer in(b);
+    in.push_back(STRING_TERMINATOR);
+    uint16_t len = hexaToBinaryCompression(in.data(), dest, b.size());
+    uint16_t refLen = hexaToBinaryCompressionRef(in.data(), ref, b.size());
+    if (len != refLen || memcmp(dest, ref, len) != 0){
+      if (errors++ == 0)
+        fprintf(stderr, "hexaToBinaryCompression differs from reference, input %u B \"%.*s\"\n",
+                (unsigned)b.size(), (int)b.size(), (const char*)b.data());
+    }
+  }
+  return errors;
+}
+
+/**
+   @brief  expected output of binaryToHexaDecompression() for format v2,
+           words of hexadecimal chars in uppercase, other words unchanged,
+           each word with STRING_TERMINATOR
+**/
+static Buffer expectedV2(const Buffer& b)
+{
+  Buffer out;
+  size_t begin = 0, end;
+
+  while (begin < b.size()){
+    for (end = begin; end < b.size() && b[end] != STRING_TERMINATOR; end++)
+      ;
+    Buffer w(b.begin() + begin, b.begin() + end);
+    bool hexa = !w.empty() && w.size() <= COMPRESSION_MAX_NIBBLES;
+    for (uint8_t ch : w)
+      hexa = hexa && isxdigit(ch);
+    if (hexa)
+      for (uint8_t& ch : w)
+        ch = toupper(ch);
+    if (hexa || w.size() <= 255 - 2){
+      out.insert(out.end(), w.begin(), w.end());
+      out.push_back(STRING_TERMINATOR);
+    }
+    begin = end + 1;
+  }
+  return out;
+}
+
+/**
+   @brief  hexaToBinaryCompressionV2() and binaryToHexaDecompression() must
+           give words of buffer (expectedV2())
+   @return number of different outputs
+**/
+static int checkCompressionV2(const std::vector<Buffer>& buffers)
+{
+  uint8_t dest[UART_BUFFER_DEEPTH * 2 + 16], hexa[UART_BUFFER_DEEPTH * 4];
+  int errors = 0;
+  uint16_t len;
+
+  for (const Buffer& b : buffers){
+    Buffer in(b), expected = expectedV2(b);
+    textEncoderReset();                 // buffer is superframe of slave
+    textDecoderReset();
+    len = hexaToBinaryCompressionV2(in.data(), dest, in.size());
+    len = binaryToHexaDecompression(dest, hexa, len);
+    if (len != expected.size() || memcmp(hexa, expected.data(), len) != 0){
+      if (errors++ == 0)
+        fprintf(stderr, "format v2 differs, input %u B \"%.*s\" output \"%.*s\"\n",
+                (unsigned)b.size(), (int)b.size(), (const char*)b.data(), (int)len, (const char*)hexa);
+    }
+  }
+  return errors;
+}
+
+/**
+   @brief  binaryToHexaDecompression() of corrupted data of both formats (changed
+           bytes, truncation, random bytes) must not write more than double of
+           input (tokens of text words up to DECOMPRESSED_DEPTH), decompressStream()
+           not more than COMPRESSION_STREAM_MIN per chunk, input is copied
+           to buffer of exact size (SANITIZE=-fsanitize=address)
+   @return number of outputs out of bounds
+**/
+static int fuzzDecompression(const std::vector<Buffer>& buffers)
+{
+  static const size_t guard = 64;
+  uint8_t dest[UART_BUFFER_DEEPTH * 2 + 16];
+  std::mt19937 rng(SEED + 1);
+  struct decompressStream stream;
+  int errors = 0, m;
+  uint16_t len, outLen;
+  size_t i, limit, chunks;
+
+  textEncoderReset();
+  for (const Buffer& b : buffers){
+    Buffer in(b);
+    in.push_back(STRING_TERMINATOR);    // hexaToBinaryCompression() is reading it behind last word
+    len = (rng() % 2) ? hexaToBinaryCompressionV2(in.data(), dest, b.size())
+                      : hexaToBinaryCompression(in.data(), dest, b.size());
+    for (m = 0; m < FUZZ_MUTATIONS; m++){
+      Buffer data(dest, dest + len);
+      switch (m){
+        case 0:                         // changed bytes
+          for (i = 0; i < 1 + rng() % 4 && !data.empty(); i++)
+            data[rng() % data.size()] = rng();
+          break;
+        case 1:                         // truncated
+          data.resize(data.empty() ? 0 : rng() % data.size());
+          break;
+        case 2:                         // changed lenght of block
+          if (data.size() >= COMPRESSION_BLOCK_HEAD)
+            data[1] = rng();
+          break;
+        default:                        // random block
+          for (uint8_t& ch : data)
+            ch = rng();
+          if (!data.empty())
+            data[0] = COMPRESSION_VERSION_2;
+      }
+      limit = std::max(data.size() * 2, (size_t)DECOMPRESSED_DEPTH);
+      Buffer exact(data), out(limit + guard, 0xA5);
+      textDecoderReset();
+      outLen = binaryToHexaDecompression(exact.data(), out.data(), exact.size());
+      for (i = limit; i < out.size() && out[i] == 0xA5; i++)
+        ;
+      if ((outLen > limit || i != out.size()) && errors++ == 0)
+        fprintf(stderr, "binaryToHexaDecompression out of bounds, mutation %d, %u B input, %u B output\n",
+                m, (unsigned)data.size(), outLen);
+      // stream is not writing behind chunk and is ending
+      textDecoderReset();
+      decompressStreamInit(&stream, exact.data(), exact.size());
+      for (chunks = 0; !decompressStreamDone(&stream) && chunks <= exact.size() * 2 + 1; chunks++){
+        std::fill(out.begin(), out.end(), 0xA5);
+        outLen = decompressStream(&stream, out.data(), COMPRESSION_STREAM_MIN);
+        for (i = COMPRESSION_STREAM_MIN; i < out.size() && out[i] == 0xA5; i++)
+          ;
+        if ((outLen > COMPRESSION_STREAM_MIN || i != out.size()) && errors++ == 0)
+          fprintf(stderr, "decompressStream out of bounds, mutation %d, %u B input, %u B chunk\n",
+                  m, (unsigned)data.size(), outLen);
+      }
+      if (!decompressStreamDone(&stream) && errors++ == 0)
+        fprintf(stderr, "decompressStream is not ending, mutation %d, %u B input\n", m, (unsigned)data.size());
+    }
+  }
+  return errors;
+}
+
+/**
+   @brief  words of window are not known by master after missing packet
+           (textDecoderLost()), decompressed words must be words of buffer in
+           same order, only words of window are dropped
+   @return number of wrong outputs
+**/
+static int checkTextLost(const std::vector<Buffer>& buffers)
+{
+  uint8_t dest[UART_BUFFER_DEEPTH * 2 + 16], hexa[UART_BUFFER_DEEPTH * 4];
+  int errors = 0;
+  uint16_t len;
+
+  for (const Buffer& b : buffers){
+    Buffer in(b), expected = expectedV2(b);
+    textEncoderReset();
+    textDecoderReset();
+    textDecoderLost();
+    len = hexaToBinaryCompressionV2(in.data(), dest, in.size());
+    len = binaryToHexaDecompression(dest, hexa, len);
+    // any output word is found in rest of expected words
+    uint8_t *word = hexa, *end = hexa + len;
+    Buffer::iterator next = expected.begin();
+    while (word < end && next != expected.end()){
+      uint8_t* wordEnd = std::find(word, end, STRING_TERMINATOR) + 1;
+      Buffer::iterator nextEnd = std::find(next, expected.end(), STRING_TERMINATOR) + 1;
+      if ((size_t)(wordEnd - word) == (size_t)(nextEnd - next) && std::equal(word, wordEnd, next))
+        word = wordEnd;
+      next = nextEnd;
+    }
+    if (word < end && errors++ == 0)
+      fprintf(stderr, "lost window of text words, wrong output \"%.*s\"\n", (int)len, (const char*)hexa);
+  }
+  return errors;
+}
+
+/**
+   @brief  output of all chunks of decompressStream() must be output of
+           binaryToHexaDecompression() (which is limiting format v2 to
+           DECOMPRESSED_DEPTH), any chunk size from COMPRESSION_STREAM_MIN
+   @return number of different outputs
+**/
+static int checkStream(const std::vector<Buffer>& buffers)
+{
+  static const uint16_t rooms[] = {COMPRESSION_STREAM_MIN, COMPRESSION_STREAM_MIN + 1, DMA_CHUNK_DEPTH, 251};
+  uint8_t dest[UART_BUFFER_DEEPTH * 2 + 16], hexa[UART_BUFFER_DEEPTH * 4];
+  struct decompressStream stream;
+  int errors = 0, v2;
+  uint16_t len, refLen;
+  size_t r;
+
+  for (const Buffer& b : buffers){
+    for (v2 = 0; v2 < 2; v2++){
+      Buffer in(b);
+      in.push_back(STRING_TERMINATOR);  // hexaToBinaryCompression() is reading it behind last word
+      textEncoderReset();
+      textDecoderReset();
+      len = v2 ? hexaToBinaryCompressionV2(in.data(), dest, b.size())
+               : hexaToBinaryCompression(in.data(), dest, b.size());
+      refLen = binaryToHexaDecompression(dest, hexa, len);
+      for (r = 0; r < sizeof(rooms) / sizeof(rooms[0]); r++){
+        Buffer out, chunk(rooms[r]);
+        textDecoderReset();
+        decompressStreamInit(&stream, dest, len);
+        while (!decompressStreamDone(&stream)){
+          uint16_t chunkLen = decompressStream(&stream, chunk.data(), chunk.size());
+          out.insert(out.end(), chunk.begin(), chunk.begin() + chunkLen);
+        }
+        if ((out.size() < refLen || memcmp(out.data(), hexa, refLen) != 0
+             || (out.size() != refLen && out.size() <= DECOMPRESSED_DEPTH)) && errors++ == 0)
+          fprintf(stderr, "decompressStream differs, format v%d, chunk %u B, output \"%.*s\"\n",
+                  v2 + 1, rooms[r], (int)out.size(), (const char*)out.data());
+      }
+    }
+  }
+  return errors;
+}
+
+int main(void)
+{
+  std::vector<Buffer> prng = uartBuffers(prngWords(NULL));
+  std::vector<Buffer> uwb = uartBuffers(uwbWords());
+  std::vector<Buffer> text = uartBuffers(textWords());
+  std::vector<Buffer> fuzz = fuzzBuffers();
+  int errors;
+
+  errors = checkCompression(prng) + checkCompression(uwb) + checkCompression(fuzz)
+         + checkCompressionV2(prng) + checkCompressionV2(uwb) + checkCompressionV2(text)
+         + checkCompressionV2(fuzz) + fuzzDecompression(fuzz) + checkTextLost(text)
+         + checkStream(prng) + checkStream(uwb) + checkStream(text) + checkStream(fuzz);
+  printf("CompressionTest %s, %u buffers, %d errors\n", errors ? "FAIL" : "ok",
+         (unsigned)(prng.size() + uwb.size() + text.size() + fuzz.size()), errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,255 @@
+/**
+ *****************************************************************************
+   @file     Corpus.cpp
+   @brief    corpora of host tests of codecs and of MicroBench
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @see     Corpus.hpp, read_me.txt
+**/
+#include <random>
+#include <stdio.h>
+#include <string.h>
+#include "uwbpacketclass.hpp"
+#include "settings.h"
+#include "Corpus.hpp"
+#include "Compression.h"
+#include "UwbCodec.h"
+#include "TextDict.h"
+
+/*******************************************************************************
+* corpora
+*/
+/**
+   @brief  hexadecimal '$' terminated words of PktGenerator, slaves interleaved
+**/
+std::vector<Buffer> prngWords(std::vector<PRNGrandomPacket>* packets)
+{
+  std::vector<Buffer> words;
+  struct PRNGslave slaves[CORPUS_SLAVES];
+  uint8_t hexa[sizeof(struct PRNGrandomPacket) * 2];
+  int i;
+
+  for (i = 0; i < CORPUS_SLAVES; i++)
+    PRNGinit(&slaves[i], i + 1);
+  for (i = 0; i < CORPUS_WORDS; i++){
+    struct PRNGslave* s = &slaves[i % CORPUS_SLAVES];
+    PRNGnew(s);
+    if (packets)
+      packets->push_back(s->packet);
+    binToHexa((uint8_t*)&s->packet, hexa, sizeof(hexa) / 2);
+    Buffer w(hexa, hexa + sizeof(hexa));
+    w.push_back(STRING_TERMINATOR);
+    words.push_back(w);
+  }
+  return words;
+}
+
+/**
+   @brief  packets of uwbPacketTx, targets are moving by random walk
+**/
+std::vector<Buffer> uwbWords(void)
+{
+  std::vector<Buffer> words;
+  std::mt19937 rng(SEED);
+  std::normal_distribution<float> step(0.0f, 0.05f);
+  float data[UWB_VALUES];
+  uwbPacketTx tx(1);
+  int i, j;
+
+  for (j = 0; j < UWB_VALUES; j++)
+    data[j] = 5.0f + 30.0f * (rng() % 1000) / 1000.0f;
+  for (i = 0; i < CORPUS_WORDS; i++){
+    for (j = 0; j < UWB_VALUES; j++){
+      data[j] += step(rng);
+      if (data[j] < 0.0f)  data[j] = 0.0f;
+      if (data[j] > 40.0f) data[j] = 40.0f;
+    }
+    tx.generatePacket(data, UWB_VALUES);
+    words.push_back(Buffer(tx.getPacketTx(), tx.getPacketTx() + tx.getPacketLength()));
+  }
+  return words;
+}
+
+/**
+   @brief  status strings of textDictionary[] and of radars, each third word
+           is hexadecimal, some words are unique
+**/
+std::vector<Buffer> textWords(void)
+{
+  std::vector<Buffer> words;
+  std::mt19937 rng(SEED);
+  char word[TEXT_MAX_WORD + 1];
+  uint32_t r;
+  int i;
+
+  for (i = 0; i < CORPUS_WORDS; i++){
+    r = rng() % 100;
+    if (r < 33)
+      snprintf(word, sizeof(word), "%08X%08X", (unsigned)rng(), (unsigned)rng());
+    else if (r < 66)
+      snprintf(word, sizeof(word), "%s", textDictionary[rng() % textDictionarySize]);
+    else if (r < 95)
+      snprintf(word, sizeof(word), "#RADAR_%u_ONLINE", (unsigned)(rng() % TEXT_MESSAGES));
+    else
+      snprintf(word, sizeof(word), "NOTE_%d", i);
+    Buffer w(word, word + strlen(word));
+    w.push_back(STRING_TERMINATOR);
+    words.push_back(w);
+  }
+  return words;
+}
+
+/**
+   @brief  split words into UART buffers, buffer is closed after word like in
+           UART_Int_Handler() of slave
+**/
+std::vector<Buffer> uartBuffers(const std::vector<Buffer>& words)
+{
+  std::vector<Buffer> buffers(1);
+  for (const Buffer& w : words){
+    buffers.back().insert(buffers.back().end(), w.begin(), w.end());
+    if (buffers.back().size() >= UART_BUFFER_DEEPTH - (HEAD_LENGHT*2 + MAX_LEN_OF_RX_PKT))
+      buffers.push_back(Buffer());
+  }
+  if (buffers.back().empty())
+    buffers.pop_back();
+  return buffers;
+}
+
+size_t totalSize(const std::vector<Buffer>& buffers)
+{
+  size_t size = 0;
+  for (const Buffer& b : buffers)
+    size += b.size();
+  return size;
+}
+
+/**
+   @brief  payloads of radio packets like slave is storing them, UART buffers
+           by hexaToBinaryCompression() or with uwb records of uwbEncode()
+           packed to packets (packWords() of Slave.c)
+**/
+std::vector<Buffer> packetPayloads(const std::vector<Buffer>& words, bool uwb)
+{
+  std::vector<Buffer> payloads;
+  uint8_t dest[UART_BUFFER_DEEPTH * 2];
+  uint16_t len;
+
+  if (!uwb){
+    for (Buffer& b : uartBuffers(words)){
+      len = hexaToBinaryCompression(b.data(), dest, b.size());
+      if (len <= PACKET_MEMORY_DEPTH - HEAD_LENGHT)
+        payloads.push_back(Buffer(dest, dest + len));
+    }
+    return payloads;
+  }
+  uwbReset();
+  payloads.push_back(Buffer());
+  for (const Buffer& w : words){
+    len = uwbEncode((uint8_t*)w.data(), w.size() - 1, dest);
+    if (payloads.back().size() + len > PACKET_MEMORY_DEPTH - HEAD_LENGHT)
+      payloads.push_back(Buffer());
+    payloads.back().insert(payloads.back().end(), dest, dest + len);
+  }
+  uwbReset();
+  return payloads;
+}
+
+/**
+   @brief  random UART buffers, hexadecimal words of random lenght, not
+           hexadecimal chars, missing STRING_TERMINATOR at end
+**/
+std::vector<Buffer> fuzzBuffers(void)
+{
+  static const char other[] = "a0f:@G\x00\xff\n#";
+  std::vector<Buffer> buffers;
+  std::mt19937 rng(SEED);
+  int i;
+
+  for (i = 0; i < FUZZ_BUFFERS; i++){
+    Buffer b(rng() % (UART_BUFFER_DEEPTH + 1));
+    for (uint8_t& ch : b){
+      uint32_t r = rng() % 100;
+      if (r < 8)
+        ch = STRING_TERMINATOR;
+      else if (r < 8u + (i % 4))      // every fourth buffer is only hexadecimal
+        ch = other[rng() % (sizeof(other) - 1)];
+      else
+        ch = "0123456789ABCDEF"[rng() % 16];
+    }
+    buffers.push_back(b);
+  }
+  return buffers;
+}
+
+/**
+   @brief  random payloads, bytes of few values (coded) and of all values
+**/
+std::vector<Buffer> randomPayloads(void)
+{
+  std::vector<Buffer> payloads;
+  std::mt19937 rng(SEED);
+  int i;
+
+  for (i = 0; i < ENTROPY_RANDOM; i++){
+    Buffer p(1 + rng() % (PACKET_MEMORY_DEPTH - HEAD_LENGHT));
+    uint32_t values = (i % 2) ? 256 : 1 + i % 16;
+    for (uint8_t& b : p)
+      b = rng() % values;
+    payloads.push_back(p);
+  }
+  return payloads;
+}
+
+/*******************************************************************************
+* reference kernels, previous versions kept to compare output and speed
+*/
+/**
+   @brief  hexaToBinaryCompression() before single pass version with hexaTable,
+           two passes (STRING_TERMINATOR and classification, hexaToBin())
+**/
+uint16_t hexaToBinaryCompressionRef(uint8_t * hexaInput, uint8_t * binaryOutput, uint16_t hexaLen)
+{
+  int16_t binaryLen = 0, processed = 0, wordLen;
+  uint8_t *procesPtr = hexaInput;
+#if ADAPTIVE_COMPRESSION
+  uint8_t hexa = 1;
+#endif
+  while(1){
+    wordLen = 0;
+    while(*procesPtr != STRING_TERMINATOR && processed < hexaLen){
+#if ADAPTIVE_COMPRESSION
+      if ((*procesPtr < '0' || *procesPtr > '9'))
+        if (*procesPtr < 'A' || *procesPtr > 'F' )
+          hexa = 0;
+#endif
+      procesPtr++;
+      wordLen ++;
+      processed ++;
+    }
+    processed ++;
+    procesPtr++;
+#if ADAPTIVE_COMPRESSION
+    if (hexa){
+#endif
+      if (wordLen % 2 == 0){
+        hexaToBin(hexaInput, &binaryOutput[1], wordLen/2);
+        binaryLen += wordLen/2 + 1;
+        *binaryOutput = wordLen/2;
+        binaryOutput += wordLen/2 +1 ;
+      }
+#if ADAPTIVE_COMPRESSION
+    }else{
+      memcpy(&binaryOutput[1], hexaInput, wordLen+1);
+      binaryLen += wordLen + 1;
+      *binaryOutput = 0;
+      binaryOutput += wordLen +1 ;
+    }
+#endif
+    hexaInput += wordLen + 1;
+    if (processed >= hexaLen)
+      return binaryLen;
+  }
+}
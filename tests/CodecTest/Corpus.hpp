@@ -0,0 +1,92 @@
+/**
+ *****************************************************************************
+   @file     Corpus.hpp
+   @brief    corpora of host tests of codecs and of MicroBench, generated
+             deterministically from SEED
+              - PRNG : UART stream of PktGenerator, 4 slaves, '$' terminated words
+              - UWB  : packets of uwbPacketTx, 10 targets moving in 40 x 40 m room
+              - text : status strings of radars and hexadecimal words
+              - random UART buffers and random payloads of packets
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    hexaToBinaryCompressionRef() is previous version of
+            hexaToBinaryCompression(), CompressionTest is comparing output
+            and MicroBench speed with it
+   @see     read_me.txt
+**/
+#ifndef _CORPUS_hpp
+#define _CORPUS_hpp
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+#include "PRNG.h"
+#pragma pack()    // PRNG.h is leaving pack(1) active
+
+/** @brief slaves of PRNG corpus **/
+#define CORPUS_SLAVES           4
+/** @brief number of words in each corpus **/
+#define CORPUS_WORDS            4096
+/** @brief coordinates of UWB packet (x, y of 10 targets) **/
+#define UWB_VALUES              20
+/** @brief random UART buffers of fuzzBuffers() **/
+#define FUZZ_BUFFERS            100000
+/** @brief random payloads of randomPayloads() **/
+#define ENTROPY_RANDOM          20000
+/** @brief status strings of radars in text corpus (besides textDictionary[]) **/
+#define TEXT_MESSAGES           6
+
+typedef std::vector<uint8_t> Buffer;
+
+/**
+   @brief  hexadecimal '$' terminated words of PktGenerator, slaves interleaved
+   @param  packets : PRNG packets of words are appended if not NULL
+**/
+std::vector<Buffer> prngWords(std::vector<PRNGrandomPacket>* packets);
+
+/**
+   @brief  packets of uwbPacketTx, targets are moving by random walk
+**/
+std::vector<Buffer> uwbWords(void);
+
+/**
+   @brief  status strings of textDictionary[] and of radars, each third word
+           is hexadecimal, some words are unique
+**/
+std::vector<Buffer> textWords(void);
+
+/**
+   @brief  split words into UART buffers, buffer is closed after word like in
+           UART_Int_Handler() of slave
+**/
+std::vector<Buffer> uartBuffers(const std::vector<Buffer>& words);
+
+size_t totalSize(const std::vector<Buffer>& buffers);
+
+/**
+   @brief  payloads of radio packets like slave is storing them, UART buffers
+           by hexaToBinaryCompression() or with uwb records of uwbEncode()
+           packed to packets (packWords() of Slave.c)
+**/
+std::vector<Buffer> packetPayloads(const std::vector<Buffer>& words, bool uwb);
+
+/**
+   @brief  random UART buffers, hexadecimal words of random lenght, not
+           hexadecimal chars, missing STRING_TERMINATOR at end
+**/
+std::vector<Buffer> fuzzBuffers(void);
+
+/**
+   @brief  random payloads, bytes of few values (coded) and of all values
+**/
+std::vector<Buffer> randomPayloads(void);
+
+/**
+   @brief  hexaToBinaryCompression() before single pass version with hexaTable,
+           two passes (STRING_TERMINATOR and classification, hexaToBin())
+**/
+uint16_t hexaToBinaryCompressionRef(uint8_t * hexaInput, uint8_t * binaryOutput, uint16_t hexaLen);
+
+#endif // _CORPUS_hpp
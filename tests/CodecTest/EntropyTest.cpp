@@ -0,0 +1,61 @@
+/**
+ *****************************************************************************
+   @file     EntropyTest.cpp
+   @brief    host test of src/include/Entropy.c and EntropyTables.c, payloads
+             of packets of PRNG and UWB corpora and random payloads
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    decoded payloads are compared with input, coded payload must
+            be shorter and truncated one refused, exit code 0 if all checks
+            passed
+   @see     read_me.txt
+**/
+#include <stdio.h>
+#include <string.h>
+#include "settings.h"
+#include "Corpus.hpp"
+#include "Entropy.h"
+
+
+/**
+   @brief  entropyDecode() of entropyEncode() must give the same payload,
+           coded payload is shorter, truncated coded payload is refused
+   @return number of different outputs
+**/
+static int checkEntropy(const std::vector<Buffer>& payloads)
+{
+  uint8_t coded[PACKET_MEMORY_DEPTH], decoded[256];
+  uint16_t codedLen, len;
+  uint8_t table;
+  int errors = 0;
+
+  for (const Buffer& p : payloads){
+    table = entropyEncode(p.data(), p.size(), coded, &codedLen);
+    if (table == 0)
+      continue;
+    len = entropyDecode(table, coded, codedLen, decoded);
+    if (codedLen >= p.size() || len != p.size() || memcmp(decoded, p.data(), len) != 0){
+      if (errors++ == 0)
+        fprintf(stderr, "entropyDecode differs, table %u, payload %u B coded to %u B\n",
+                table, (unsigned)p.size(), codedLen);
+    }
+    else if (entropyDecode(table, coded, codedLen / 2, decoded) != 0 && errors++ == 0)
+      fprintf(stderr, "entropyDecode is not refusing truncated payload, table %u\n", table);
+  }
+  return errors;
+}
+
+int main(void)
+{
+  std::vector<Buffer> prng = packetPayloads(prngWords(NULL), false);
+  std::vector<Buffer> uwb = packetPayloads(uwbWords(), true);
+  std::vector<Buffer> random = randomPayloads();
+  int errors;
+
+  errors = checkEntropy(prng) + checkEntropy(uwb) + checkEntropy(random);
+  printf("EntropyTest %s, %u payloads, %d errors\n", errors ? "FAIL" : "ok",
+         (unsigned)(prng.size() + uwb.size() + random.size()), errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,136 @@
+/**
+ *****************************************************************************
+   @file     HexCrcTest.cpp
+   @brief    host test of hexadecimal and CRC kernels of PktTester, HexSimd.c,
+             CrcSimd.c and CrcLib.hpp
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    binToHexa() and hexaToBin() of each level of HexSimd.c are
+            compared with scalar loop, crcNibble, crcFast, crcSimd of each
+            level and crcLibCcitt with crcSlow, crcLibUwb with CRC of
+            uwbpacketclass bit by bit, exit code 0 if all checks passed
+   @see     read_me.txt
+**/
+#include <random>
+#include <stdio.h>
+#include <string.h>
+#include "settings.h"
+#include "PRNG.h"
+#pragma pack()    // PRNG.h is leaving pack(1) active
+#include "HexSimd.h"
+#include "CrcSimd.h"
+#include "CrcLib.hpp"
+
+
+/**
+   @brief  compare binToHexa() and hexaToBin() of all SIMD levels with scalar
+           loop, random data and lenghts, not hexadecimal chars, in place
+   @return number of different outputs
+**/
+static int checkHexa(void)
+{
+  uint8_t best = hexaSimdLevel(-1), level;
+  uint8_t bin[1024], hexa[2048], out[2048], refHexa[2048], refBin[2048];
+  std::mt19937 rng(SEED);
+  int errors = 0, i;
+  uint16_t len;
+
+  for (i = 0; i < 20000; i++){
+    len = rng() % (sizeof(bin) + 1);
+    for (uint8_t& b : bin)
+      b = rng();
+    for (uint8_t& h : hexa)       // mostly hexadecimal chars, sometimes any byte
+      h = (rng() % 8) ? "0123456789ABCDEF"[rng() % 16] : rng();
+    for (level = HEXA_SIMD_SCALAR; level <= best; level++){
+      hexaSimdLevel(level);
+      memset(out, 0, sizeof(out));
+      binToHexa(bin, out, len);
+      if (level == HEXA_SIMD_SCALAR)
+        memcpy(refHexa, out, sizeof(refHexa));
+      else if (memcmp(out, refHexa, sizeof(refHexa)) != 0 && errors++ == 0)
+        fprintf(stderr, "binToHexa %s differs from scalar, lenght %u\n", hexaSimdName(level), len);
+
+      // in place like PktReader
+      memcpy(out, hexa, sizeof(hexa));
+      hexaToBin(out, out, len);
+      if (level == HEXA_SIMD_SCALAR)
+        memcpy(refBin, out, sizeof(refBin));
+      else if (memcmp(out, refBin, sizeof(refBin)) != 0 && errors++ == 0)
+        fprintf(stderr, "hexaToBin %s differs from scalar, lenght %u\n", hexaSimdName(level), len);
+    }
+  }
+  hexaSimdLevel(best);
+  return errors;
+}
+
+/**
+   @brief  CRC of uwbpacketclass bit by bit, P_16 0xA001 with initial 0
+**/
+static uint16_t uwbCrcBitwise(const unsigned char* data, int len)
+{
+  uint16_t sum = 0;
+  int i, bit;
+
+  for (i = 0; i < len; i++){
+    sum ^= data[i];
+    for (bit = 0; bit < 8; bit++)
+      sum = (sum & 1) ? (sum >> 1) ^ 0xA001 : sum >> 1;
+  }
+  return sum;
+}
+
+/**
+   @brief  crcNibble(), crcFast(), crcSimd() of all levels and crcLibCcitt
+           must give crcSlow(), crcLibUwb must give uwbCrcBitwise(), random
+           data and lenghts, check values of "123456789"
+   @return number of different outputs
+**/
+static int checkCrc(void)
+{
+  unsigned char data[1024];
+  std::mt19937 rng(SEED);
+  uint8_t best = crcSimdLevel(-1), level;
+  int errors = 0, i, len;
+  crc ref;
+
+  if (crcNibble((unsigned char const*)"123456789", 9) != CHECK_VALUE){
+    fprintf(stderr, "crcNibble of \"123456789\" is not %x\n", CHECK_VALUE);
+    errors++;
+  }
+  if (crcLibCcitt::compute("123456789", 9) != 0x29B1 || crcLib16::compute("123456789", 9) != 0xBB3D
+      || crcLib32::compute("123456789", 9) != 0xCBF43926UL){
+    fprintf(stderr, "check value of crcLibCcitt, crcLib16 or crcLib32 is wrong\n");
+    errors++;
+  }
+  for (i = 0; i < 2000; i++){
+    len = rng() % (sizeof(data) + 1);
+    for (unsigned char& b : data)
+      b = rng();
+    ref = crcSlow(data, len);
+    if ((crcNibble(data, len) != ref || crcFast(data, len) != ref) && errors++ == 0)
+      fprintf(stderr, "crcNibble or crcFast differs from crcSlow, lenght %d\n", len);
+    if (crcLibCcitt::compute(data, len) != ref && errors++ == 0)
+      fprintf(stderr, "crcLibCcitt differs from crcSlow, lenght %d\n", len);
+    if (crcLibUwb::compute(data, len) != uwbCrcBitwise(data, len) && errors++ == 0)
+      fprintf(stderr, "crcLibUwb differs from P_16 bit by bit, lenght %d\n", len);
+    for (level = CRC_SIMD_TABLE; level <= best; level++){
+      crcSimdLevel(level);
+      if (crcSimd(data, len) != ref && errors++ == 0)
+        fprintf(stderr, "crcSimd %s differs from crcSlow, lenght %d\n", crcSimdName(level), len);
+    }
+  }
+  crcSimdLevel(best);
+  return errors;
+}
+
+int main(void)
+{
+  int errors;
+
+  errors = checkHexa() + checkCrc();
+  printf("HexCrcTest %s, hexa up to %s, crcSimd up to %s, %d errors\n", errors ? "FAIL" : "ok",
+         hexaSimdName(hexaSimdLevel(-1)), crcSimdName(crcSimdLevel(-1)), errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,74 @@
+/**
+ *****************************************************************************
+   @file     UwbCodecTest.cpp
+   @brief    host test of src/include/UwbCodec.c, frames of UWB corpus
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    decoded frames are compared with corpus, after lost frame
+            delta frames are dropped until keyframe, exit code 0 if all
+            checks passed
+   @see     read_me.txt
+**/
+#include <stdio.h>
+#include <string.h>
+#include "settings.h"
+#include "Corpus.hpp"
+#include "UwbCodec.h"
+
+
+/** @brief UWB frame lost by radio is any N-th **/
+#define UWB_LOST_FRAME          97
+
+/**
+   @brief  uwbEncode() and uwbDecode() of UWB corpus must give the same words,
+           after lost frame are delta frames dropped until keyframe
+   @return number of different outputs
+**/
+static int checkUwb(const std::vector<Buffer>& words)
+{
+  uint8_t record[UART_BUFFER_DEEPTH], hexa[UART_BUFFER_DEEPTH * 3];
+  int errors = 0, lost;
+  size_t i, dropped = 0;
+  uint16_t len;
+
+  for (lost = 0; lost <= 1; lost++){
+    uwbReset();
+    for (i = 0; i < words.size(); i++){
+      const Buffer& w = words[i];
+      if (uwbEncode((uint8_t*)w.data(), w.size() - 1, record) == 0){
+        if (errors++ == 0)
+          fprintf(stderr, "uwbEncode is not coding UWB frame \"%.*s\"\n", (int)w.size(), (const char*)w.data());
+        continue;
+      }
+      if (lost && i % UWB_LOST_FRAME == UWB_LOST_FRAME - 1)
+        continue;
+      len = uwbDecode(record, hexa);
+      if (len == 0 && lost)
+        dropped++;
+      else if (len != w.size() || memcmp(hexa, w.data(), len) != 0){
+        if (errors++ == 0)
+          fprintf(stderr, "uwbDecode differs, frame %u \"%.*s\"\n", (unsigned)i, (int)w.size(), (const char*)w.data());
+      }
+    }
+  }
+  // frames of radar between lost frame and keyframe
+  if (dropped > (words.size() / UWB_LOST_FRAME + 1) * UWB_KEYFRAME_INTERVAL){
+    fprintf(stderr, "uwbDecode dropped %u frames after %u lost\n", (unsigned)dropped,
+            (unsigned)(words.size() / UWB_LOST_FRAME));
+    errors++;
+  }
+  uwbReset();
+  return errors;
+}
+
+int main(void)
+{
+  std::vector<Buffer> uwb = uwbWords();
+  int errors;
+
+  errors = checkUwb(uwb);
+  printf("UwbCodecTest %s, %u frames, %d errors\n", errors ? "FAIL" : "ok", (unsigned)uwb.size(), errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,101 @@
+/**
+ *****************************************************************************
+   @file     CrcTest.c
+   @brief    host test of Integrity/crc.c, table crcTable computed by compiler
+             is compared with bit by bit division and CRC of "123456789"
+             with CHECK_VALUE of selected standard
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    standard is selected by -DCRC_CCITT, -DCRC16 or -DCRC32 (Makefile
+            builds all of them), exit code 0 if all checks passed
+   @note    crcFast, crcNibble (CRC_CCITT) and crcSimd of all levels supported
+            by CPU (tests/PktTester/CrcSimd.c) are compared with crcSlow on
+            pseudo-random messages of all lenghts up to MAX_LEN
+   @see     read_me.txt
+**/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crc.h"
+#include "CrcSimd.h"
+
+#define WIDTH           (8 * sizeof(crc))
+#define TOPBIT          ((crc)1 << (WIDTH - 1))
+#define MAX_LEN         600
+
+/**
+   @fn     static crc tableEntry(int dividend)
+   @brief  remainder of dividend followed by zeros, bit by bit like former crcInit()
+**/
+static crc tableEntry(int dividend)
+{
+  crc remainder = (crc)dividend << (WIDTH - 8);
+  int bit;
+
+  for (bit = 8; bit > 0; --bit){
+    if (remainder & TOPBIT)
+      remainder = (crc)((remainder << 1) ^ POLYNOMIAL);
+    else
+      remainder = (crc)(remainder << 1);
+  }
+  return remainder;
+}
+
+int main(void)
+{
+  static const unsigned char check[] = "123456789";
+  unsigned char message[MAX_LEN];
+  unsigned long seed = 500;
+  int errors = 0, i, len;
+  int best = crcSimdLevel(-1), level;
+  crc ref;
+
+  for (i = 0; i < 256; i++){
+    if (crcTable[i] != tableEntry(i) && errors++ < 5)
+      printf("%s crcTable[%d] = %lX, expected %lX\n", CRC_NAME, i,
+             (unsigned long)crcTable[i], (unsigned long)tableEntry(i));
+  }
+
+  if (crcSlow(check, 9) != CHECK_VALUE){
+    printf("%s crcSlow of \"123456789\" = %lX, expected %lX\n", CRC_NAME,
+           (unsigned long)crcSlow(check, 9), (unsigned long)CHECK_VALUE);
+    errors++;
+  }
+  if (crcFast(check, 9) != CHECK_VALUE){
+    printf("%s crcFast of \"123456789\" = %lX, expected %lX\n", CRC_NAME,
+           (unsigned long)crcFast(check, 9), (unsigned long)CHECK_VALUE);
+    errors++;
+  }
+#if defined(CRC_CCITT)
+  if (crcNibble(check, 9) != CHECK_VALUE){
+    printf("%s crcNibble of \"123456789\" = %lX, expected %lX\n", CRC_NAME,
+           (unsigned long)crcNibble(check, 9), (unsigned long)CHECK_VALUE);
+    errors++;
+  }
+#endif
+
+  for (len = 0; len <= MAX_LEN; len++){
+    for (i = 0; i < len; i++){
+      seed = seed * 1103515245UL + 12345UL;
+      message[i] = (unsigned char)(seed >> 16);
+    }
+    ref = crcSlow(message, len);
+    if (crcFast(message, len) != ref && errors++ < 5)
+      printf("%s crcFast differs from crcSlow, lenght %d\n", CRC_NAME, len);
+#if defined(CRC_CCITT)
+    if (crcNibble(message, len) != ref && errors++ < 5)
+      printf("%s crcNibble differs from crcSlow, lenght %d\n", CRC_NAME, len);
+#endif
+    for (level = CRC_SIMD_TABLE; level <= best; level++){
+      crcSimdLevel(level);
+      if (crcSimd(message, len) != ref && errors++ < 5)
+        printf("%s crcSimd %s differs from crcSlow, lenght %d\n", CRC_NAME, crcSimdName(level), len);
+    }
+  }
+
+  printf("%s %s, check value %lX, crcSimd up to %s, %d errors\n", CRC_NAME, errors ? "FAIL" : "ok",
+         (unsigned long)CHECK_VALUE, crcSimdName(best), errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,180 @@
+/**
+ *****************************************************************************
+   @file     FeeSignTest.cpp
+   @brief    host test of model of flash controller signature (Integrity/feesign.c)
+             and of FeeSignHex, without board
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    checks
+              - feeSignature() against CRC-24 of CrcLib.hpp (the same polynomial
+                and seed, bytes of each word from MSB)
+              - any changed bit of signed pages changes signature, reserved
+                last 4 bytes are not signed
+              - feeSignStore() / feeSignCheck() like Sign command of controller
+              - FeeSignHex writes and checks signature of .hex file, broken
+                image is refused (exit code 1)
+   @note    exit code 0 if all checks passed
+   @see     read_me.txt
+**/
+#include <random>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include "feesign.h"
+#include "ihex.h"
+#include "CrcLib.hpp"
+
+#define FLASH_SIZE      0x20000
+#define SEED            500
+
+/** @brief signature as CRC of byte stream, polynomial and seed of feesign.h **/
+typedef crcLib<uint32_t, 24, FEE_SIGN_POLYNOMIAL, false, FEE_SIGN_SEED, 0> crcLibFeeSign;
+
+static int errors = 0;
+
+static void fail(const char* text, unsigned long value)
+{
+  if (errors++ < 5)
+    printf("FeeSign %s 0x%lX\n", text, value);
+}
+
+/**
+   @brief  signature of pages by crcLibFeeSign, words are little endian in FLASH
+**/
+static unsigned long referenceSignature(const std::vector<unsigned char>& image, unsigned long startAddr, unsigned long endAddr)
+{
+  unsigned long addr = startAddr & ~(unsigned long)(FEE_PAGE_SIZE - 1);
+  uint32_t state = crcLibFeeSign::begin();
+  unsigned char word[4];
+
+  for ( ; addr < (unsigned long)FEE_SIGN_OFFSET(endAddr); addr += 4){
+    word[0] = image[addr + 3];
+    word[1] = image[addr + 2];
+    word[2] = image[addr + 1];
+    word[3] = image[addr];
+    state = crcLibFeeSign::update(state, word, sizeof(word));
+  }
+  return crcLibFeeSign::finish(state);
+}
+
+/**
+   @brief  firmware like image, code at begin, radio configuration page, rest erased
+**/
+static void firmwareImage(std::vector<unsigned char>& image, std::mt19937& rng)
+{
+  unsigned long i;
+
+  memset(image.data(), 0xFF, image.size());
+  for (i = 0; i < 0x6000; i++)
+    image[i] = (unsigned char)rng();
+  for (i = 0x1F000; i < 0x1F040; i++)
+    image[i] = (unsigned char)rng();
+}
+
+static int run(const char* command)
+{
+  int status = system(command);
+
+  return (status == -1) ? -1 : WEXITSTATUS(status);
+}
+
+int main(void)
+{
+  std::vector<unsigned char> image(FLASH_SIZE), read(FLASH_SIZE);
+  static const unsigned long blocks[][2] = {{0, FLASH_SIZE - 1}, {0, 0x1FF}, {0x400, 0x7FF}, {0x1F000, 0x1F1FF}};
+  std::mt19937 rng(SEED);
+  unsigned long signature, addr;
+  unsigned char old;
+  unsigned i;
+  FILE* file;
+
+  // model against CRC of CrcLib.hpp, seed of erased FLASH
+  firmwareImage(image, rng);
+  for (i = 0; i < sizeof(blocks) / sizeof(blocks[0]); i++){
+    signature = feeSignature(image.data(), blocks[i][0], blocks[i][1]);
+    if (signature != referenceSignature(image, blocks[i][0], blocks[i][1]))
+      fail("differs from CRC-24 of CrcLib.hpp, block", blocks[i][0]);
+    if (signature > FEE_SIGN_MASK)
+      fail("is longer than 24 bits", signature);
+  }
+  if (feeSignature(image.data(), 0x10, 0x1F0) != feeSignature(image.data(), 0, FEE_PAGE_SIZE - 1))
+    fail("is not using whole pages", 0);
+
+  // any changed bit of signed pages is found, reserved bytes are not signed
+  signature = feeSignature(image.data(), 0, FLASH_SIZE - 1);
+  for (i = 0; i < 200; i++){
+    addr = rng() % FEE_SIGN_OFFSET(FLASH_SIZE - 1);
+    old = image[addr];
+    image[addr] ^= 1 << (rng() % 8);
+    if (feeSignature(image.data(), 0, FLASH_SIZE - 1) == signature)
+      fail("is not changed by bit at", addr);
+    image[addr] = old;
+  }
+  image[FLASH_SIZE - 1] ^= 0x5A;
+  if (feeSignature(image.data(), 0, FLASH_SIZE - 1) != signature)
+    fail("is changed by reserved bytes", FLASH_SIZE - 1);
+
+  // store and check like Sign command
+  firmwareImage(image, rng = std::mt19937(SEED));
+  if (feeSignCheck(image.data(), 0, FLASH_SIZE - 1))
+    fail("of erased reserved bytes passed", 0);
+  signature = feeSignStore(image.data(), 0, FLASH_SIZE - 1);
+  if (!feeSignCheck(image.data(), 0, FLASH_SIZE - 1) || image[FLASH_SIZE - 1] != 0)
+    fail("stored is not accepted", signature);
+  image[0x100] ^= 0x80;
+  if (feeSignCheck(image.data(), 0, FLASH_SIZE - 1))
+    fail("of changed image passed", 0x100);
+
+  // FeeSignHex, sparse .hex file like output of compiler
+  firmwareImage(image, rng = std::mt19937(SEED));
+  if ((file = fopen("FeeSignTest_in.hex", "w")) == NULL){
+    printf("can not write FeeSignTest_in.hex\n");
+    return 1;
+  }
+  for (addr = 0; addr < 0x6000; addr += 32){
+    fprintf(file, ":20%04lX00", addr);
+    unsigned char sum = (unsigned char)(0x20 + (addr >> 8) + addr);
+    for (i = 0; i < 32; i++){
+      fprintf(file, "%02X", image[addr + i]);
+      sum += image[addr + i];
+    }
+    fprintf(file, "%02X\n", (unsigned char)-sum);
+  }
+  fprintf(file, ":020000040001F9\n");
+  for (addr = 0x1F000; addr < 0x1F040; addr += 16){
+    fprintf(file, ":10%04lX00", addr & 0xFFFF);
+    unsigned char sum = (unsigned char)(0x10 + ((addr >> 8) & 0xFF) + addr);
+    for (i = 0; i < 16; i++){
+      fprintf(file, "%02X", image[addr + i]);
+      sum += image[addr + i];
+    }
+    fprintf(file, "%02X\n", (unsigned char)-sum);
+  }
+  fprintf(file, ":00000001FF\n");
+  fclose(file);
+
+  if (ihexRead("FeeSignTest_in.hex", read.data(), FLASH_SIZE) != 0x6000 + 0x40 || read != image)
+    fail("ihexRead differs from image", 0);
+  if (run("./FeeSignHex FeeSignTest_in.hex FeeSignTest_out.hex > /dev/null") != 0)
+    fail("FeeSignHex failed", 0);
+  signature = feeSignStore(image.data(), 0, FLASH_SIZE - 1);
+  if (ihexRead("FeeSignTest_out.hex", read.data(), FLASH_SIZE) != FLASH_SIZE || read != image)
+    fail("FeeSignHex output differs from signed image", signature);
+  if (run("./FeeSignHex -c FeeSignTest_out.hex > /dev/null") != 0)
+    fail("FeeSignHex -c refused signed image", signature);
+  if (run("./FeeSignHex -c FeeSignTest_in.hex > /dev/null") != 1)
+    fail("FeeSignHex -c accepted image without signature", 0);
+  read[0x2345] ^= 0x10;
+  ihexWrite("FeeSignTest_out.hex", read.data(), FLASH_SIZE);
+  if (run("./FeeSignHex -c FeeSignTest_out.hex > /dev/null") != 1)
+    fail("FeeSignHex -c accepted changed image", 0x2345);
+  remove("FeeSignTest_in.hex");
+  remove("FeeSignTest_out.hex");
+
+  printf("FeeSign %s, signature of test image 0x%06lX, %d errors\n", errors ? "FAIL" : "ok", signature, errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,535 @@
+/**
+ *****************************************************************************
+   @file     HostPeriph.c
+   @brief    host stand-in of DasLib peripherals (UART, DMA, GPT, GPIO, FLASH)
+             and of NVIC used by Master.c and Slave.c
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    interrupts are asynchronous: POSIX timer is raising SIGALRM every
+            SIM_TICK_US and the signal handler is dispatching pending and
+            enabled interrupts in order of NVIC priority, so firmware main loop
+            is interrupted at any place like on target
+   @note    UART TX (DMA) is written into stdout, UART RX is read from file
+            SIM_UART_IN and paced by baud rate
+   @note    all timing (timers, UART) is multiplied by SIM_TIME_SCALE
+**/
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "library.h"
+#include "settings.h"
+#include "HostSim.h"
+#include "feesign.h"
+
+/** @brief lowest priority, interrupt without priority set **/
+#define NO_PRIORITY             0xFF
+
+extern void UART_Int_Handler(void);
+extern void DMA_UART_TX_Int_Handler(void);
+extern void DMA_UART_RX_Int_Handler(void);
+extern void GP_Tmr0_Int_Handler(void);
+extern void GP_Tmr1_Int_Handler(void);
+
+ADI_GPIO_TypeDef  hostGpio[5];
+ADI_TIMER_TypeDef hostTimer[2];
+ADI_SPI_TypeDef   hostSpi[2];
+uint8_t           hostFlash[HOST_FLASH_SIZE];
+
+struct rfMedium*  hostMedium;
+uint8_t           hostNode = 0;
+double            hostTimeScale = 1.0;
+double            hostLoss = 0.0;
+
+static uint8_t    button = 0;
+static uint64_t   pollNs = 114;
+static uint64_t   lastIdleNs = 0;
+static uint64_t   randomState = 88172645463325252ull;
+static sigset_t   tickSet, savedSet;
+static int        lockDepth = 0;
+
+/** @brief state of interrupt controller **/
+static void (* const vector[HOST_NUM_OF_IRQn])(void) = {
+  [TIMER0_IRQn]      = GP_Tmr0_Int_Handler,
+  [TIMER1_IRQn]      = GP_Tmr1_Int_Handler,
+  [UART_IRQn]        = UART_Int_Handler,
+  [DMA_UART_TX_IRQn] = DMA_UART_TX_Int_Handler,
+  [DMA_UART_RX_IRQn] = DMA_UART_RX_Int_Handler,
+};
+static uint8_t irqEnabled[HOST_NUM_OF_IRQn];
+static uint8_t irqPending[HOST_NUM_OF_IRQn];
+static uint8_t irqPriority[HOST_NUM_OF_IRQn];
+
+/** @brief state of general purpose timers **/
+static struct {
+  uint8_t  running;
+  uint8_t  periodic;
+  uint64_t periodNs;
+  uint64_t nextNs;
+} timer[2];
+
+/** @brief state of UART and its DMA channels **/
+static struct {
+  int      baud;
+  uint64_t byteNs;
+  int      intMask;
+  int      dmaSel;
+  uint8_t  rxFull;
+  uint8_t  rxByte;
+  uint64_t rxNextNs;
+  int      rxFd;
+  uint8_t  rxData[4096];
+  size_t   rxHead, rxTail;
+  uint8_t  txChanEnabled;
+  uint8_t* txPtr;
+  int      txLen;
+  uint8_t  txBusy;
+  uint64_t txEndNs;
+} uart = { .baud = 9600, .byteNs = 1041666, .rxFd = -1 };
+
+/////////////////////////////////////////////////////////////////////////////
+// simulation helpers
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+   @fn     void hostLock(void)
+   @brief  block dispatcher of interrupts, nesting is allowed
+**/
+void hostLock(void)
+{
+  sigset_t old;
+  sigprocmask(SIG_BLOCK, &tickSet, &old);
+  if (lockDepth++ == 0)
+    savedSet = old;
+}
+
+/**
+   @fn     void hostUnlock(void)
+   @brief  unblock dispatcher of interrupts
+**/
+void hostUnlock(void)
+{
+  if (--lockDepth == 0)
+    sigprocmask(SIG_SETMASK, &savedSet, NULL);
+}
+
+/**
+   @fn     uint64_t hostRandom(void)
+   @brief  xorshift generator of loss model
+**/
+uint64_t hostRandom(void)
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 7;
+  randomState ^= randomState << 17;
+  return randomState;
+}
+
+/**
+   @fn     void hostIdle(void)
+   @brief  one unsuccessful poll of radio takes at least SIM_POLL_NS,
+           CPU is given to other nodes in meantime
+**/
+void hostIdle(void)
+{
+  uint64_t until = lastIdleNs + pollNs;
+  uint64_t now;
+
+  while ((now = rfNow()) < until)
+    sched_yield();
+  lastIdleNs = now;
+}
+
+/**
+   @fn     uint32_t hostCycles(void)
+   @brief  core clock cycles of simulation time for Profile.h
+   @note   time of host CPU is scaled by SIM_TIME_SCALE, cycles are not
+**/
+uint32_t hostCycles(void)
+{
+  return (uint32_t)(rfNow() / hostTimeScale * HOST_UCLK / 1e9);
+}
+
+/**
+   @fn     void hostStopCheck(void)
+   @brief  terminate node if simulation is over
+**/
+void hostStopCheck(void)
+{
+  if (hostMedium->stop){
+    fflush(stdout);
+    exit(0);
+  }
+}
+
+static uint64_t timerPeriod(ADI_TIMER_TypeDef *pTMR, int iScale)
+{
+  static const double prescale[4] = {1, 16, 256, 32768};
+  uint32_t ld = pTMR->LD ? pTMR->LD : 0x10000;
+  return (uint64_t)(ld * prescale[iScale & TCON_PRE_MSK] / HOST_UCLK * 1e9 * hostTimeScale);
+}
+
+static void irqCall(IRQn_Type irq)
+{
+  irqPending[irq] = 0;
+  if (irq == TIMER0_IRQn || irq == TIMER1_IRQn){
+    ADI_TIMER_TypeDef* pTMR = &hostTimer[irq - TIMER0_IRQn];
+    pTMR->STA |= TSTA_TMOUT;
+    vector[irq]();
+    pTMR->STA &= ~TSTA_TMOUT;
+  }
+  else if (vector[irq])
+    vector[irq]();
+}
+
+/**
+   @fn     static void dispatch(int signal)
+   @brief  simulation of peripherals and interrupt controller
+   @note   called from SIGALRM, peripheral state is changed only with
+           blocked signal in main context
+**/
+static void dispatch(int signal)
+{
+  uint64_t now = rfNow();
+  int i, irq, best;
+  int savedErrno = errno;
+  (void)signal;
+
+  // timers
+  for (i = 0; i < 2; i++){
+    if (timer[i].running && now >= timer[i].nextNs){
+      irqPending[TIMER0_IRQn + i] = 1;
+      if (timer[i].periodic)
+        timer[i].nextNs += timer[i].periodNs;
+      else
+        timer[i].nextNs = now + timer[i].periodNs;
+      if (timer[i].nextNs < now)        // process was not scheduled, do not burst
+        timer[i].nextNs = now + timer[i].periodNs;
+    }
+  }
+
+  // end of DMA UART TX transfer
+  if (uart.txBusy && now >= uart.txEndNs){
+    uart.txBusy = 0;
+    irqPending[DMA_UART_TX_IRQn] = 1;
+  }
+
+  // run pending interrupts by priority
+  do {
+    best = -1;
+    for (irq = 0; irq < HOST_NUM_OF_IRQn; irq++)
+      if (irqPending[irq] && irqEnabled[irq] && (best < 0 || irqPriority[irq] < irqPriority[best]))
+        best = irq;
+    if (best >= 0)
+      irqCall((IRQn_Type)best);
+  } while (best >= 0);
+
+  // UART RX paced by baud rate
+  while (uart.rxFd >= 0 && (uart.intMask & COMIEN_ERBFI) && irqEnabled[UART_IRQn] && now >= uart.rxNextNs){
+    if (uart.rxHead == uart.rxTail){
+      ssize_t len = read(uart.rxFd, uart.rxData, sizeof(uart.rxData));
+      if (len == 0){                    // end of file
+        close(uart.rxFd);
+        uart.rxFd = -1;
+      }
+      if (len <= 0)
+        break;
+      uart.rxHead = 0;
+      uart.rxTail = len;
+    }
+    uart.rxByte = uart.rxData[uart.rxHead++];
+    uart.rxFull = 1;
+    hostMedium->node[hostNode].uartRxBytes++;
+    if (uart.rxNextNs + uart.byteNs < now)
+      uart.rxNextNs = now;
+    uart.rxNextNs += uart.byteNs;
+    UART_Int_Handler();
+  }
+  errno = savedErrno;
+}
+
+/**
+   @fn     static void hostInit(void)
+   @brief  start of node, called before main() of firmware
+**/
+__attribute__((constructor)) static void hostInit(void)
+{
+  const char* env;
+  struct sigaction sa;
+  struct sigevent sev;
+  struct itimerspec its;
+  timer_t tick;
+  long tickUs = 100;
+  crc image;
+
+  setvbuf(stdout, NULL, _IONBF, 0);     // printf and DMA share UART
+  memset(irqPriority, NO_PRIORITY, sizeof(irqPriority));
+
+  if ((env = getenv(SIM_ENV_NODE)))       hostNode = atoi(env);
+  if ((env = getenv(SIM_ENV_TIME_SCALE))) hostTimeScale = atof(env);
+  if ((env = getenv(SIM_ENV_LOSS)))       hostLoss = atof(env);
+  if ((env = getenv(SIM_ENV_SEED)))       randomState ^= strtoull(env, NULL, 0);
+  if ((env = getenv(SIM_ENV_BUTTON)))     button = atoi(env);
+  if ((env = getenv(SIM_ENV_TICK_US)))    tickUs = atol(env);
+  if ((env = getenv(SIM_ENV_POLL_NS)))    pollNs = strtoull(env, NULL, 0);
+  pollNs = (uint64_t)(pollNs * hostTimeScale);
+  randomState += (uint64_t)hostNode * 0x9E3779B97F4A7C15ull;
+  if (hostNode >= RF_MAX_NODES){
+    fprintf(stderr, "node %d out of range\n", hostNode);
+    exit(1);
+  }
+  if ((env = getenv(SIM_ENV_UART_IN)) && (uart.rxFd = open(env, O_RDONLY | O_NONBLOCK)) < 0)
+    perror(env);
+  if ((env = getenv(SIM_ENV_UART_DELAY)))
+    uart.rxNextNs = rfNow() + (uint64_t)(atof(env) * 1e9 * hostTimeScale);
+
+  // without launcher node is alone in private medium
+  if ((env = getenv(RF_ENV_MEDIUM)))
+    hostMedium = rfMediumAttach(env);
+  else
+    hostMedium = mmap(NULL, sizeof(struct rfMedium), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (hostMedium == NULL || hostMedium == MAP_FAILED){
+    fprintf(stderr, "node %d: no RF medium\n", hostNode);
+    exit(1);
+  }
+
+  // erased FLASH with CRC at the end like Integrity.bat is doing (signature like FeeSign.bat)
+  memset(hostFlash, 0xFF, sizeof(hostFlash));
+#if FEE_SIGN
+  feeSignStore(hostFlash, 0, HOST_FLASH_SIZE - 1);
+#else
+  image = crcSlow(hostFlash, HOST_FLASH_SIZE - 2);
+  hostFlash[HOST_FLASH_SIZE - 2] = (uint8_t)(image >> 8);
+  hostFlash[HOST_FLASH_SIZE - 1] = (uint8_t)image;
+#endif
+
+  hostGpio[0].GPOUT = BIT6;             // button is not pushed
+  if (button)
+    hostGpio[0].GPOUT &= ~BIT6;
+
+  sigemptyset(&tickSet);
+  sigaddset(&tickSet, SIGALRM);
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = dispatch;
+  sa.sa_flags = SA_RESTART;
+  sigfillset(&sa.sa_mask);
+  sigaction(SIGALRM, &sa, NULL);
+
+  memset(&sev, 0, sizeof(sev));
+  sev.sigev_notify = SIGEV_SIGNAL;
+  sev.sigev_signo = SIGALRM;
+  if (timer_create(CLOCK_MONOTONIC, &sev, &tick) != 0){
+    perror("timer_create");
+    exit(1);
+  }
+  its.it_interval.tv_sec = tickUs / 1000000;
+  its.it_interval.tv_nsec = (tickUs % 1000000) * 1000;
+  its.it_value = its.it_interval;
+  timer_settime(tick, 0, &its, NULL);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// NVIC
+/////////////////////////////////////////////////////////////////////////////
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  hostLock();
+  irqEnabled[IRQn] = 1;
+  hostUnlock();
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  hostLock();
+  irqEnabled[IRQn] = 0;
+  hostUnlock();
+}
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+  irqPriority[IRQn] = priority;
+}
+
+void NVIC_SystemReset(void)
+{
+  fprintf(stderr, "node %d: system reset\n", hostNode);
+  exit(1);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// UART
+/////////////////////////////////////////////////////////////////////////////
+int UrtLinCfg(int iChan, int iBaud, int iBits, int iFormat)
+{
+  (void)iChan; (void)iBits; (void)iFormat;
+  hostLock();
+  uart.baud = iBaud;
+  uart.byteNs = (uint64_t)(10e9 / iBaud * hostTimeScale);  // start + 8 data + stop bit
+  hostUnlock();
+  return 1;
+}
+
+int UrtLinSta(int iChan)          { (void)iChan; return 0; }
+
+int UrtIntCfg(int iChan, int iIrq)
+{
+  (void)iChan;
+  uart.intMask = iIrq;
+  return 1;
+}
+
+int UrtIntSta(int iChan)
+{
+  (void)iChan;
+  return uart.rxFull ? COMIIR_STA_RXBUFFULL : 1;  // NINT = no interrupt pending
+}
+
+int UrtRx(int iChan)
+{
+  (void)iChan;
+  uart.rxFull = 0;
+  return uart.rxByte;
+}
+
+int UrtTx(int iChan, int iTx)
+{
+  uint8_t ch = iTx;
+  (void)iChan;
+  hostMedium->node[hostNode].uartTxBytes++;
+  return write(STDOUT_FILENO, &ch, 1) == 1;
+}
+
+/**
+   @fn     int UrtDma(int iChan, int iDmaSel)
+   @brief  enabling DMA request of TX starts transfer set by DmaTransferSetup()
+   @note   data are written at once, end of transfer is signaled after
+           time needed for transmission at actual baud rate
+**/
+int UrtDma(int iChan, int iDmaSel)
+{
+  (void)iChan;
+  hostLock();
+  uart.dmaSel = iDmaSel;
+  if ((iDmaSel & COMIEN_EDMAT) && uart.txChanEnabled && uart.txLen > 0){
+    ssize_t len = write(STDOUT_FILENO, uart.txPtr, uart.txLen);
+    (void)len;
+    hostMedium->node[hostNode].uartTxBytes += uart.txLen;
+    uart.txEndNs = rfNow() + uart.txLen * uart.byteNs;
+    uart.txLen = 0;
+    uart.txBusy = 1;
+  }
+  else if (!(iDmaSel & COMIEN_EDMAT))
+    uart.txBusy = 0;
+  hostUnlock();
+  return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// DMA
+/////////////////////////////////////////////////////////////////////////////
+int DmaInit(void)                 { return 1; }
+
+int DmaTransferSetup(int iChan, int iNumVals, unsigned char *pucDMA)
+{
+  if (iChan == UARTTX_C){
+    hostLock();
+    uart.txPtr = pucDMA;
+    uart.txLen = iNumVals;
+    hostUnlock();
+  }
+  return 1;
+}
+
+int DmaChanSetup(unsigned int iChan, unsigned char iEnable, int iPriority)
+{
+  (void)iPriority;
+  if (iChan == UARTTX_C){
+    hostLock();
+    uart.txChanEnabled = iEnable;
+    hostUnlock();
+  }
+  return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// general purpose timers
+/////////////////////////////////////////////////////////////////////////////
+int GptLd(ADI_TIMER_TypeDef *pTMR, int iTld)
+{
+  pTMR->LD = iTld & 0xFFFF;
+  return 1;
+}
+
+int GptCfg(ADI_TIMER_TypeDef *pTMR, int iClkSrc, int iScale, int iMode)
+{
+  int i = pTMR - hostTimer;
+  (void)iClkSrc;
+  hostLock();
+  pTMR->CON = iClkSrc | iScale | iMode;
+  timer[i].running = (iMode & TCON_ENABLE) ? 1 : 0;
+  timer[i].periodic = (iMode & TCON_MOD_PERIODIC) ? 1 : 0;
+  timer[i].periodNs = timerPeriod(pTMR, iScale);
+  timer[i].nextNs = rfNow() + timer[i].periodNs;
+  hostUnlock();
+  return 1;
+}
+
+int GptSta(ADI_TIMER_TypeDef *pTMR)
+{
+  return pTMR->STA;
+}
+
+int GptClrInt(ADI_TIMER_TypeDef *pTMR, int iSource)
+{
+  pTMR->STA &= ~iSource;
+  return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// GPIO
+/////////////////////////////////////////////////////////////////////////////
+int DioCfg(ADI_GPIO_TypeDef *pPort, int iMpx)             { (void)pPort; (void)iMpx; return 1; }
+int DioOen(ADI_GPIO_TypeDef *pPort, int iOen)             { (void)pPort; (void)iOen; return 1; }
+int DioPul(ADI_GPIO_TypeDef *pPort, int iPul)             { (void)pPort; (void)iPul; return 1; }
+int DioCfgPin(ADI_GPIO_TypeDef *pPort, int iPin, int iMode){ (void)pPort; (void)iPin; (void)iMode; return 1; }
+int DioRd(ADI_GPIO_TypeDef *pPort)                        { return pPort->GPOUT; }
+int DioSet(ADI_GPIO_TypeDef *pPort, int iVal)             { pPort->GPOUT |= iVal; return 1; }
+int DioClr(ADI_GPIO_TypeDef *pPort, int iVal)             { pPort->GPOUT &= ~iVal; return 1; }
+
+/////////////////////////////////////////////////////////////////////////////
+// FLASH, watchdog
+/////////////////////////////////////////////////////////////////////////////
+static int hostFeeStatus;
+static unsigned long hostFeeSignature;
+
+int FeeWrEn(int iMde)             { (void)iMde; return 1; }
+
+/** @brief status is cleared by reading like FEESTA **/
+int FeeSta(void)
+{
+  int status = hostFeeStatus;
+
+  hostFeeStatus = 0;
+  return status;
+}
+
+/** @brief Sign command is done at once by model of feesign.c **/
+int FeeSign(unsigned long ulStartAddr, unsigned long ulEndAddr)
+{
+  hostFeeSignature = feeSignature(hostFlash, ulStartAddr, ulEndAddr);
+  hostFeeStatus = FEESTA_CMDDONE | (feeSignCheck(hostFlash, ulStartAddr, ulEndAddr) ? FEESTA_CMDRES_SUCCESS
+                                                                                      : FEESTA_CMDRES_VERIFYERR);
+  return 1;
+}
+
+int FeeSig(void)                  { return (int)hostFeeSignature; }
+int WdtGo(int iEnable)            { (void)iEnable; return 1; }
@@ -0,0 +1,432 @@
+/**
+ *****************************************************************************
+   @file     HostRadio.c
+   @brief    host stand-in of Radio Interface Engine (radioeng.c)
+             transmitted packets are published into simulated RF medium,
+             received packets are taken from medium
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    frame is received if
+              - it is on the same frequency
+              - it started after radio was switched into RX
+              - it was not dropped by loss model (SIM_LOSS)
+              - no other frame on the same frequency overlapped it
+            radio is after received/failed frame still in RX like ADF7023
+            with CRC check, only correct packet set flag of received packet
+   @note    with SIM_REPLAY frames are not received from medium, received
+            frames of trace (RadioCapture.h dump) are delivered after the same
+            number of transmitted frames as in trace, at recorded delay after
+            last of them divided by SIM_REPLAY_SPEED, replayed frames are
+            published into medium for statistic of SimRun
+   @see     RfMedium.h
+**/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "radioeng.h"
+#include "settings.h"
+#include "Airtime.h"
+#include "RadioCapture.h"
+#include "HostSim.h"
+
+#define DEFAULT_CHNL_FREQ       915000000
+/** @brief constant RSSI of simulated channel **/
+#define HOST_RSSI               -90
+/** @brief how far back are frames checked for collision **/
+#define COLLISION_WINDOW        32
+/** @brief line of trace, "capture tick dir rssi len hexadata#" **/
+#define REPLAY_LINE_LEN         (RF_FRAME_LEN * 2 + 64)
+
+static RIE_U32   frequency = DEFAULT_CHNL_FREQ;
+static RIE_BaseConfigs baseConfig = DR_38_4kbps_Dev20kHz;
+static RIE_BOOL  manchester = RIE_FALSE;
+
+static uint64_t  txEndNs = 0;
+static RIE_BOOL  bPacketTx = RIE_TRUE;   // the same initial state as radioeng.c
+static RIE_BOOL  bPacketRx = RIE_TRUE;
+
+static uint8_t   rxArmed = 0;
+static uint64_t  rxArmedNs = 0;
+static uint64_t  rxCursor = 0;           // next frame in medium to examine
+static uint8_t   rxCursorValid = 0;
+static uint8_t   rxBuffer[RF_FRAME_LEN];
+static uint8_t   rxLen = 0;
+static int8_t    rxRssi = HOST_RSSI;
+
+/** @brief received frame of trace **/
+struct replayFrame {
+  uint32_t txBefore;          /*!< @brief transmitted frames before this one in trace */
+  uint64_t dueNs;             /*!< @brief delay after last transmitted frame (start of replay) */
+  int8_t   rssi;
+  uint8_t  len;
+  uint8_t  data[RF_FRAME_LEN];
+};
+static struct replayFrame* replay = NULL;
+static size_t    replayCount = 0;
+static size_t    replayNext = 0;
+static uint64_t  replayStartNs = 0;
+static uint32_t  replayTx = 0;          // frames transmitted by node during replay
+static uint64_t  replayTxNs = 0;        // time of last of them
+static uint32_t  replayLate = 0;        // frames delivered after more transmissions than in trace
+
+/**
+   @fn     static uint64_t preamble(void)
+   @brief  duration of preamble, receiver switched to RX during first half
+           of preamble is still able to detect sync word
+   @return uint64_t - duration in ns (scaled by SIM_TIME_SCALE)
+**/
+static uint64_t preamble(void)
+{
+  return (uint64_t)(airtimePreambleUs(baseConfig) * 1e3 * hostTimeScale);
+}
+
+/**
+   @fn     static uint64_t airtime(uint8_t len)
+   @brief  duration of variable length packet on air
+   @param  len : lenght of payload
+   @return uint64_t - duration in ns (scaled by SIM_TIME_SCALE)
+**/
+static uint64_t airtime(uint8_t len)
+{
+  return (uint64_t)(airtimeUs(baseConfig, manchester, len) * 1e3 * hostTimeScale);
+}
+
+/**
+   @fn     static uint8_t collided(uint64_t index, const struct rfFrame* frame)
+   @brief  check if some frame of other node overlapped received frame
+   @param  index : index of received frame in medium
+   @param  frame : received frame
+   @return uint8_t - 1 collision, 0 clean
+**/
+static uint8_t collided(uint64_t index, const struct rfFrame* frame)
+{
+  struct rfFrame other;
+  uint64_t i = (index > COLLISION_WINDOW) ? index - COLLISION_WINDOW : 0;
+  uint64_t head = __atomic_load_n(&hostMedium->head, __ATOMIC_ACQUIRE);
+
+  for (; i < head; i++){
+    if (i == index || rfMediumRead(hostMedium, i, &other) != 1)
+      continue;
+    if (other.frequency != frame->frequency || other.sender == frame->sender)
+      continue;
+    if (other.startNs < frame->endNs && other.endNs > frame->startNs)
+      return 1;
+  }
+  return 0;
+}
+
+/**
+   @fn     static void rxScan(void)
+   @brief  walk trought medium and capture first valid frame for this node
+**/
+static void rxScan(void)
+{
+  struct rfFrame frame;
+  struct rfNodeStat* stat = &hostMedium->node[hostNode];
+  uint64_t now = rfNow();
+  int8_t state;
+
+  if (!rxCursorValid){
+    rxCursor = __atomic_load_n(&hostMedium->head, __ATOMIC_ACQUIRE);
+    rxCursorValid = 1;
+  }
+
+  while ((state = rfMediumRead(hostMedium, rxCursor, &frame)) != 0){
+    if (state < 0){                     // node was too slow, skip lost history
+      rxCursor++;
+      stat->rxMissed++;
+      continue;
+    }
+    if (frame.sender == hostNode || frame.frequency != frequency){
+      rxCursor++;
+      continue;
+    }
+    if (frame.startNs + preamble() / 2 < rxArmedNs){     // preamble was lost
+      rxCursor++;
+      stat->rxMissed++;
+      continue;
+    }
+    if (frame.endNs > now)              // still on air
+      return;
+    rxCursor++;
+    if (hostLoss > 0.0 && (hostRandom() % 1000000) < (uint64_t)(hostLoss * 1000000)){
+      stat->rxLost++;
+      continue;
+    }
+    if (collided(rxCursor - 1, &frame)){
+      stat->rxCollided++;
+      continue;
+    }
+    memcpy(rxBuffer, frame.data, frame.len);
+    rxLen = frame.len;
+    rxArmed = 0;
+    bPacketRx = RIE_TRUE;
+    stat->rxFrames++;
+    stat->rxBytes += frame.len;
+    return;
+  }
+}
+
+/**
+   @fn     static void replayLoad(const char* name, double speed)
+   @brief  read received frames of trace, other lines of file are skipped
+   @param  name : file with dump of radioCaptureDump() (e.g. UART output of master)
+   @param  speed : speed up of replay, 0 = frames are delivered at any poll
+**/
+static void replayLoad(const char* name, double speed)
+{
+  FILE* file = fopen(name, "r");
+  char line[REPLAY_LINE_LEN], hexa[RF_FRAME_LEN * 2 + 1], dir, *p;
+  unsigned long tick, lastTick = 0;
+  unsigned len, i, byte;
+  int rssi;
+  uint32_t txBefore = 0;
+  size_t size = 0;
+
+  if (file == NULL){
+    perror(name);
+    exit(1);
+  }
+  while (fgets(line, sizeof(line), file)){
+    if ((p = strstr(line, "capture ")) == NULL)
+      continue;
+    hexa[0] = '\0';
+    if (sscanf(p, "capture %lu %c %d %u %480[0-9A-F]", &tick, &dir, &rssi, &len, hexa) < 4)
+      continue;                         // "capture end ..."
+    if (len > RF_FRAME_LEN || strlen(hexa) != len * 2)
+      continue;
+    if (replayCount == 0 && txBefore == 0)
+      lastTick = tick;                  // begining of trace
+    if (dir == RADIO_CAPTURE_TX){
+      txBefore++;
+      lastTick = tick;
+      continue;
+    }
+    if (dir != RADIO_CAPTURE_RX)
+      continue;
+    if (replayCount == size){
+      size = size ? size * 2 : 256;
+      replay = realloc(replay, size * sizeof(struct replayFrame));
+    }
+    // tick is 32 bit cycle counter, difference is correct also after overflow
+    replay[replayCount].txBefore = txBefore;
+    replay[replayCount].dueNs = (speed > 0) ?
+        (uint64_t)((uint32_t)(tick - lastTick) / HOST_UCLK * 1e9 * hostTimeScale / speed) : 0;
+    replay[replayCount].rssi = (int8_t)rssi;
+    replay[replayCount].len = len;
+    for (i = 0; i < len; i++){
+      sscanf(&hexa[i * 2], "%2x", &byte);
+      replay[replayCount].data[i] = byte;
+    }
+    replayCount++;
+  }
+  fclose(file);
+  fprintf(stderr, "node %d: replay of %zu received frames after %u transmitted from %s\n",
+          hostNode, replayCount, (unsigned)txBefore, name);
+}
+
+/**
+   @fn     static void replayScan(void)
+   @brief  deliver next frame of trace if node transmitted the same number of
+           frames as in trace and recorded delay is over, frame is delivered
+           at once if node transmitted more frames (diverged from trace),
+           frames before first transmission wait from first poll of receiver
+**/
+static void replayScan(void)
+{
+  struct replayFrame* frame = &replay[replayNext];
+  struct rfNodeStat* stat = &hostMedium->node[hostNode];
+  uint64_t now = rfNow();
+  uint8_t sender;
+
+  if (replayNext >= replayCount)
+    return;
+  if (replayStartNs == 0)
+    replayStartNs = now;
+  if (replayTx < frame->txBefore)
+    return;
+  if (replayTx == frame->txBefore){
+    if (now < (frame->txBefore ? replayTxNs : replayStartNs) + frame->dueNs)
+      return;
+  }else
+    replayLate++;
+  replayNext++;
+  memcpy(rxBuffer, frame->data, frame->len);
+  rxLen = frame->len;
+  rxRssi = frame->rssi;
+  rxArmed = 0;
+  bPacketRx = RIE_TRUE;
+  stat->rxFrames++;
+  stat->rxBytes += frame->len;
+
+  // sender is slave id in head of data packet, for statistic of SimRun
+  sender = frame->len ? frame->data[0] - '0' : 0;
+  if (sender > 0 && sender < RF_MAX_NODES)
+    rfMediumPublish(hostMedium, sender, frequency, now - airtime(frame->len), now,
+                    frame->data, frame->len);
+  if (replayNext == replayCount)
+    fprintf(stderr, "node %d: replay is finished after %.3f s, %u transmitted, %u frames late\n",
+            hostNode, (now - replayStartNs) / 1e9 / hostTimeScale, (unsigned)replayTx,
+            (unsigned)replayLate);
+}
+
+RIE_Responses RadioGetAPIVersion(RIE_U32 *pVersion)
+{
+  if (pVersion)
+    *pVersion = 0x0100;
+  return RIE_Success;
+}
+
+RIE_Responses RadioInit(RIE_BaseConfigs BaseConfig)
+{
+  const char* env;
+
+  if (airtimeDataRate(BaseConfig) == 0)
+    return RIE_UnsupportedRadioConfig;
+  if (replay == NULL && (env = getenv(SIM_ENV_REPLAY))){
+    const char* speed = getenv(SIM_ENV_REPLAY_SPEED);
+    replayLoad(env, speed ? atof(speed) : 1.0);
+  }
+  baseConfig = BaseConfig;
+  frequency = DEFAULT_CHNL_FREQ;
+  rxArmed = 0;
+  return RIE_Success;
+}
+
+RIE_Responses RadioDeInit(void)             { rxArmed = 0; return RIE_Success; }
+RIE_Responses RadioPowerOff(void)           { rxArmed = 0; return RIE_Success; }
+RIE_Responses RadioTerminateRadioOp(void)   { rxArmed = 0; return RIE_Success; }
+RIE_Responses RadioHWreset(void)            { rxArmed = 0; return RIE_Success; }
+
+RIE_Responses RadioSetFrequency(RIE_U32 Frequency)
+{
+  frequency = Frequency;
+  if (rxArmed)                          // PLL is locking again
+    rxArmedNs = rfNow();
+  return RIE_Success;
+}
+
+RIE_Responses RadioSetModulationType(RIE_ModulationTypes ModulationType)
+{
+  (void)ModulationType;
+  return RIE_Success;
+}
+
+RIE_Responses RadioPayldManchesterEncode(RIE_BOOL bEnable)
+{
+  manchester = bEnable;
+  return RIE_Success;
+}
+
+RIE_Responses RadioPayldDataWhitening(RIE_BOOL bEnable)
+{
+  (void)bEnable;
+  return RIE_Success;
+}
+
+RIE_Responses RadioTxSetPA(RIE_PATypes PAType, RIE_PAPowerLevel Power)
+{
+  (void)PAType;
+  (void)Power;
+  return RIE_Success;
+}
+
+RIE_Responses RadioTxSetPower(RIE_PAPowerLevel Power)
+{
+  (void)Power;
+  return RIE_Success;
+}
+
+RIE_Responses RadioRadioGetRSSI(RIE_S8 *pRSSIdBm)
+{
+  if (pRSSIdBm)
+    *pRSSIdBm = HOST_RSSI;
+  return RIE_Success;
+}
+
+/**
+   @fn     RIE_Responses RadioTxPacketVariableLen(RIE_U8 Len, RIE_U8 *pData)
+   @brief  publish packet into medium, transmission lasts airtime of packet
+**/
+RIE_Responses RadioTxPacketVariableLen(RIE_U8 Len, RIE_U8 *pData)
+{
+  struct rfNodeStat* stat = &hostMedium->node[hostNode];
+  uint64_t now;
+
+  if ((Len + 1) > PACKETRAM_LEN)
+    return RIE_InvalidParamter;
+  hostStopCheck();
+  now = rfNow() + (uint64_t)(AIRTIME_TX_TURNAROUND_US * 1e3 * hostTimeScale);
+  if (now < txEndNs)
+    now = txEndNs;
+  txEndNs = now + airtime(Len);
+  rfMediumPublish(hostMedium, hostNode, frequency, now, txEndNs, pData, Len);
+  RADIO_CAPTURE_FRAME(RADIO_CAPTURE_TX, pData, Len, 0);
+  if (replay != NULL){
+    replayTx++;
+    replayTxNs = rfNow();
+  }
+  rxArmed = 0;
+  bPacketTx = RIE_FALSE;
+  stat->txFrames++;
+  stat->txBytes += Len;
+  return RIE_Success;
+}
+
+RIE_BOOL RadioTxPacketComplete(void)
+{
+  hostStopCheck();
+  if (!bPacketTx && rfNow() >= txEndNs)
+    bPacketTx = RIE_TRUE;
+  if (!bPacketTx)
+    hostIdle();
+  return bPacketTx;
+}
+
+/**
+   @fn     RIE_Responses RadioRxPacketVariableLen(void)
+   @brief  switch radio into RX, only frames starting from now can be received
+**/
+RIE_Responses RadioRxPacketVariableLen(void)
+{
+  uint64_t now = rfNow();
+  struct rfNodeStat* stat = &hostMedium->node[hostNode];
+
+  rxArmed = 1;
+  rxArmedNs = (now > txEndNs) ? now : txEndNs;
+  bPacketRx = RIE_FALSE;
+  if (!stat->ready)
+    stat->ready = 1;
+  return RIE_Success;
+}
+
+RIE_BOOL RadioRxPacketAvailable(void)
+{
+  hostStopCheck();
+  if (!bPacketRx && rxArmed){
+    if (replay != NULL)
+      replayScan();
+    else
+      rxScan();
+  }
+  if (!bPacketRx){
+    hostMedium->node[hostNode].rxIdlePolls++;
+    hostIdle();
+  }
+  return bPacketRx;
+}
+
+RIE_Responses RadioRxPacketRead(RIE_U8 BufferLen, RIE_U8 *pPktLen, RIE_U8 *pData, RIE_S8 *pRSSIdBm)
+{
+  if (bPacketRx){
+    if (pPktLen)
+      *pPktLen = rxLen;
+    memcpy(pData, rxBuffer, (rxLen < BufferLen) ? rxLen : BufferLen);
+    if (pRSSIdBm)
+      *pRSSIdBm = rxRssi;
+    RADIO_CAPTURE_FRAME(RADIO_CAPTURE_RX, pData, (rxLen < BufferLen) ? rxLen : BufferLen, rxRssi);
+  }
+  return RIE_Success;
+}
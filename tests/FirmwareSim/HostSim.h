@@ -0,0 +1,47 @@
+/**
+ *****************************************************************************
+   @file     HostSim.h
+   @brief    state shared between host stand-ins of radio and peripherals
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @see     HostRadio.c
+   @see     HostPeriph.c
+**/
+#ifndef __HOST_SIM_H
+#define __HOST_SIM_H
+
+#include <stdint.h>
+#include "RfMedium.h"
+
+/** @name environment variables read at start of node process **/
+///@{
+#define SIM_ENV_NODE        "SIM_NODE"        /*!< @brief 0 = master, 1..N = slave */
+#define SIM_ENV_TIME_SCALE  "SIM_TIME_SCALE"  /*!< @brief slow down of simulated time (airtime, UART, timers) */
+#define SIM_ENV_LOSS        "SIM_LOSS"        /*!< @brief probability of lost frame {0.0 - 1.0} */
+#define SIM_ENV_SEED        "SIM_SEED"        /*!< @brief seed of loss model */
+#define SIM_ENV_BUTTON      "SIM_BUTTON"      /*!< @brief 1 = button at GP0.6 is pushed (PRNG mode of slave) */
+#define SIM_ENV_UART_IN     "SIM_UART_IN"     /*!< @brief file/FIFO feeding UART RX of node */
+#define SIM_ENV_TICK_US     "SIM_TICK_US"     /*!< @brief period of interrupt dispatcher in us */
+#define SIM_ENV_POLL_NS     "SIM_POLL_NS"     /*!< @brief duration of one unsuccessful radio poll */
+#define SIM_ENV_UART_DELAY  "SIM_UART_DELAY"  /*!< @brief seconds before UART RX is started (late directives) */
+#define SIM_ENV_REPLAY      "SIM_REPLAY"      /*!< @brief trace of RadioCapture.h, received frames are replayed */
+#define SIM_ENV_REPLAY_SPEED "SIM_REPLAY_SPEED" /*!< @brief speed up of replay, 0 = frame at any poll */
+///@}
+
+/** @brief clock of timers, UART and cycle counter **/
+#define HOST_UCLK           16000000.0
+
+extern struct rfMedium*  hostMedium;
+extern uint8_t           hostNode;
+extern double            hostTimeScale;
+extern double            hostLoss;
+
+extern uint64_t hostRandom(void);
+extern void     hostIdle(void);
+extern void     hostStopCheck(void);
+extern void     hostLock(void);
+extern void     hostUnlock(void);
+
+#endif //__HOST_SIM_H
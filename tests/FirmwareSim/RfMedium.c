@@ -0,0 +1,140 @@
+/**
+ *****************************************************************************
+   @file     RfMedium.c
+   @brief    simulated RF broadcast medium shared between host processes
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+**/
+#include <fcntl.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "RfMedium.h"
+
+/**
+   @fn     uint64_t rfNow(void)
+   @brief  monotonic time common for all processes
+   @return uint64_t - time in nanoseconds
+**/
+uint64_t rfNow(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static struct rfMedium* rfMediumMap(const char* name, int flags)
+{
+  struct rfMedium* medium;
+  int fd = shm_open(name, flags, 0600);
+  if (fd < 0){
+    perror("shm_open");
+    return NULL;
+  }
+  if ((flags & O_CREAT) && ftruncate(fd, sizeof(struct rfMedium)) != 0){
+    perror("ftruncate");
+    close(fd);
+    return NULL;
+  }
+  medium = mmap(NULL, sizeof(struct rfMedium), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (medium == MAP_FAILED){
+    perror("mmap");
+    return NULL;
+  }
+  return medium;
+}
+
+/**
+   @fn     struct rfMedium* rfMediumCreate(const char* name)
+   @brief  create new empty medium in shared memory
+   @param  name : name of shared memory object ("/rfsim123")
+   @return pointer at medium or NULL
+**/
+struct rfMedium* rfMediumCreate(const char* name)
+{
+  struct rfMedium* medium = rfMediumMap(name, O_RDWR | O_CREAT | O_TRUNC);
+  if (medium)
+    memset(medium, 0, sizeof(struct rfMedium));
+  return medium;
+}
+
+/**
+   @fn     struct rfMedium* rfMediumAttach(const char* name)
+   @brief  attach medium created by other process
+   @param  name : name of shared memory object
+   @return pointer at medium or NULL
+**/
+struct rfMedium* rfMediumAttach(const char* name)
+{
+  return rfMediumMap(name, O_RDWR);
+}
+
+/**
+   @fn     void rfMediumRemove(const char* name)
+   @brief  remove shared memory object, mapped medium stay valid until exit
+**/
+void rfMediumRemove(const char* name)
+{
+  shm_unlink(name);
+}
+
+/**
+   @fn     uint64_t rfMediumPublish(...)
+   @brief  put one frame on air
+   @param  medium : pointer at medium
+   @param  sender : number of transmitting node
+   @param  frequency : actual frequency of transmitter
+   @param  startNs : begining of frame on air @see rfNow()
+   @param  endNs : end of frame on air
+   @param  data : payload of frame
+   @param  len : {0-240} lenght of payload
+   @return uint64_t - index of frame in medium
+**/
+uint64_t rfMediumPublish(struct rfMedium* medium, uint8_t sender, uint32_t frequency,
+                         uint64_t startNs, uint64_t endNs,
+                         const uint8_t* data, uint8_t len)
+{
+  uint64_t index = __atomic_fetch_add(&medium->head, 1, __ATOMIC_ACQ_REL);
+  struct rfFrame* frame = &medium->frame[index & (RF_MEDIUM_DEPTH - 1)];
+
+  __atomic_store_n(&frame->seq, 0, __ATOMIC_RELEASE);   // invalidate slot during writing
+  frame->startNs = startNs;
+  frame->endNs = endNs;
+  frame->frequency = frequency;
+  frame->sender = sender;
+  frame->len = len;
+  memcpy(frame->data, data, len);
+  __atomic_store_n(&frame->seq, index + 1, __ATOMIC_RELEASE);
+  return index;
+}
+
+/**
+   @fn     int8_t rfMediumRead(struct rfMedium* medium, uint64_t index, struct rfFrame* frame)
+   @brief  copy frame from medium
+   @param  medium : pointer at medium
+   @param  index : index of frame @see rfMediumPublish()
+   @param  frame : out: copy of frame
+   @return int8_t -  1 frame is copied
+                  -  0 frame is not yet published
+                  - -1 frame was overwritten (reader is too slow)
+**/
+int8_t rfMediumRead(struct rfMedium* medium, uint64_t index, struct rfFrame* frame)
+{
+  struct rfFrame* slot = &medium->frame[index & (RF_MEDIUM_DEPTH - 1)];
+  uint64_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+
+  if (seq != index + 1){
+    if (index + RF_MEDIUM_DEPTH < __atomic_load_n(&medium->head, __ATOMIC_ACQUIRE))
+      return -1;
+    return 0;
+  }
+  memcpy(frame, slot, sizeof(struct rfFrame));
+  if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != seq)   // overwritten during copy
+    return -1;
+  return 1;
+}
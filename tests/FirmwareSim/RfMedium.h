@@ -0,0 +1,83 @@
+/**
+ *****************************************************************************
+   @file     RfMedium.h
+   @brief    simulated RF broadcast medium shared between host processes
+             of Master and Slave firmware
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    medium is circular buffer of frames in POSIX shared memory
+            any transmitted frame is visible for all nodes, receiving node
+            decides (frequency, rx state, loss, collision) if frame is received
+   @see     HostRadio.c
+   @see     SimRun.c
+**/
+#ifndef __RF_MEDIUM_H
+#define __RF_MEDIUM_H
+
+#include <stdint.h>
+
+// PRNG.h is setting #pragma pack(1) for rest of firmware, medium is shared
+// with SimRun compiled without it, so keep default alignment
+#pragma pack(push)
+#pragma pack()
+
+/** @brief number of frames in medium, must be power of 2 **/
+#define RF_MEDIUM_DEPTH     8192
+/** @brief maximal number of nodes (master + slaves) **/
+#define RF_MAX_NODES        11
+/** @brief size of packet RAM in radio interface @see PACKETRAM_LEN **/
+#define RF_FRAME_LEN        240
+
+/** @brief name of environment variable with name of shared memory **/
+#define RF_ENV_MEDIUM       "SIM_MEDIUM"
+
+/**
+   @brief  one frame on air
+   @note   seq is written last, frame is valid if seq == index + 1
+**/
+struct rfFrame {
+  volatile uint64_t seq;
+  uint64_t startNs;           /*!< @brief begining of transmission (preamble) */
+  uint64_t endNs;             /*!< @brief end of transmission (CRC) */
+  uint32_t frequency;
+  uint8_t  sender;            /*!< @brief node number 0 = master, 1..N = slave */
+  uint8_t  len;
+  uint8_t  data[RF_FRAME_LEN];
+};
+
+/** @brief statistic of one node, written only by node itself **/
+struct rfNodeStat {
+  volatile uint8_t  ready;     /*!< @brief node is receiving first time */
+  uint64_t txFrames;
+  uint64_t txBytes;
+  uint64_t rxFrames;
+  uint64_t rxBytes;
+  uint64_t rxLost;            /*!< @brief frames dropped by loss model */
+  uint64_t rxCollided;        /*!< @brief frames overlapped by other frame at same frequency */
+  uint64_t rxMissed;          /*!< @brief frames on air while radio was not in receiving mode */
+  uint64_t rxIdlePolls;       /*!< @brief unsuccessful polls of RadioRxPacketAvailable() */
+  uint64_t uartTxBytes;
+  uint64_t uartRxBytes;
+};
+
+struct rfMedium {
+  volatile uint64_t head;     /*!< @brief number of frames ever transmitted */
+  volatile uint8_t  stop;     /*!< @brief request to terminate all nodes */
+  struct rfNodeStat node[RF_MAX_NODES];
+  struct rfFrame    frame[RF_MEDIUM_DEPTH];
+};
+
+#pragma pack(pop)
+
+extern uint64_t          rfNow(void);
+extern struct rfMedium*  rfMediumCreate(const char* name);
+extern struct rfMedium*  rfMediumAttach(const char* name);
+extern void              rfMediumRemove(const char* name);
+extern uint64_t          rfMediumPublish(struct rfMedium* medium, uint8_t sender, uint32_t frequency,
+                                         uint64_t startNs, uint64_t endNs,
+                                         const uint8_t* data, uint8_t len);
+extern int8_t            rfMediumRead(struct rfMedium* medium, uint64_t index, struct rfFrame* frame);
+
+#endif //__RF_MEDIUM_H
@@ -0,0 +1,270 @@
+/**
+ *****************************************************************************
+   @file     SimRun.c
+   @brief    launcher of firmware-in-the-loop simulation
+             starts Slave1..N and Master processes over one simulated RF medium,
+             watches traffic on air and prints statistic of run
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @code    ./SimRun -s 4 -t 10 -l 0.01 -o master.txt -u slave%d.txt
+   @endcode
+   @note    with -R only Master is started and receives frames of trace
+            (RadioCapture.h dump) instead of slaves
+   @see     read_me.txt
+**/
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "RfMedium.h"
+#include "HostSim.h"
+
+#define HEAD_LENGHT         3
+#define CHAR_OFFSET         '0'
+
+/** @brief traffic of one slave seen on air **/
+struct slaveTraffic {
+  uint64_t polls;           /*!< @brief "Nslot" packets of master */
+  uint64_t zeroPkts;        /*!< @brief slave has nothing to send */
+  uint64_t dataPkts;
+  uint64_t dataBytes;       /*!< @brief payload without head */
+  uint64_t reRequests;      /*!< @brief "NRE.." packets of master */
+  uint64_t reRequested;     /*!< @brief number of packets requested again */
+  uint64_t retxPkts;        /*!< @brief data packets transmitted after request */
+};
+
+static struct slaveTraffic traffic[RF_MAX_NODES];
+static uint64_t syncPkts, freqPkts, otherPkts, superframes;
+static uint64_t airNs;
+static int      verbose = 0;
+
+static void usage(const char* name)
+{
+  printf("usage: %s [options]\n"
+         "  -s <n>      number of slaves (default 4, binaries Slave1..n)\n"
+         "  -t <s>      duration of simulation in seconds (default 5)\n"
+         "  -l <p>      probability of frame loss 0.0 - 1.0 (default 0)\n"
+         "  -x <k>      slow down of simulated time (default 1.0)\n"
+         "  -o <file>   output of master UART (default /dev/null)\n"
+         "  -u <fmt>    input of slave UART, %%d is slave number (\"slave%%d.txt\")\n"
+         "  -w <fmt>    output of slave UART, %%d is slave number (default /dev/null)\n"
+         "  -m <file>   input of master UART (directives, e.g. \"PROF$\")\n"
+         "  -D <s>      delay of master UART input in seconds (late \"CAPT$\", \"PROF$\")\n"
+         "  -R <file>   replay received frames of trace (\"capture\" lines of master UART),\n"
+         "              slaves are not started\n"
+         "  -a <k>      speed up of replay, 0 = frame at any poll of master (default 1.0)\n"
+         "  -g          push button of slaves (PRNG data generation)\n"
+         "  -v          print any frame on air\n", name);
+}
+
+static pid_t start(const char* binary, int node, const char* uartIn, const char* uartOut, int button)
+{
+  char buff[32];
+  pid_t pid = fork();
+
+  if (pid != 0)
+    return pid;
+  snprintf(buff, sizeof(buff), "%d", node);
+  setenv(SIM_ENV_NODE, buff, 1);
+  setenv(SIM_ENV_BUTTON, button ? "1" : "0", 1);
+  if (uartIn)
+    setenv(SIM_ENV_UART_IN, uartIn, 1);
+  snprintf(buff, sizeof(buff), "gmon.%s", binary + 2);
+  setenv("GMON_OUT_PREFIX", buff, 1);
+  if (uartOut){
+    int fd = open(uartOut, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0){
+      perror(uartOut);
+      _exit(1);
+    }
+    dup2(fd, STDOUT_FILENO);
+    close(fd);
+  }
+  execl(binary, binary, (char*)NULL);
+  perror(binary);
+  _exit(1);
+}
+
+/**
+   @fn     static void classify(const struct rfFrame* frame)
+   @brief  recognize packet of TDMA protocol
+**/
+static void classify(const struct rfFrame* frame)
+{
+  static uint8_t lastPolled = 0, reSlave = 0;
+  const char* data = (const char*)frame->data;
+  uint8_t len = frame->len;
+  uint8_t id;
+
+  airNs += frame->endNs - frame->startNs;
+  if (verbose)
+    printf("%12.6f node %d len %3d: %.*s\n", frame->startNs / 1e9, frame->sender,
+           len, (len > 40) ? 40 : len, data);
+
+  if (frame->sender == 0){
+    if (len >= 5 && strncmp(&data[1], "slot", 4) == 0){
+      id = data[0] - CHAR_OFFSET;
+      if (id < RF_MAX_NODES){
+        if (id <= lastPolled)
+          superframes++;
+        lastPolled = id;
+        traffic[id].polls++;
+      }
+      reSlave = 0;
+    }
+    else if (len >= 4 && strncmp(data, "SYNC", 4) == 0)
+      syncPkts++;
+    else if (len >= 4 && strncmp(data, "FREQ", 4) == 0)
+      freqPkts++;
+    else if (len >= 4 && strncmp(&data[1], "RE", 2) == 0){
+      reSlave = lastPolled;     // slave id in request is not reliable
+      traffic[reSlave].reRequests++;
+      traffic[reSlave].reRequested += len - 4;
+    }
+    else
+      otherPkts++;
+    return;
+  }
+
+  if (frame->sender >= RF_MAX_NODES)
+    return;
+  if (len <= HEAD_LENGHT && data[1] == CHAR_OFFSET)
+    traffic[frame->sender].zeroPkts++;
+  else if (len > HEAD_LENGHT){
+    traffic[frame->sender].dataPkts++;
+    traffic[frame->sender].dataBytes += len - HEAD_LENGHT;
+    if (reSlave == frame->sender)
+      traffic[frame->sender].retxPkts++;
+  }
+}
+
+static void report(struct rfMedium* medium, int slaves, double seconds)
+{
+  int i;
+  uint64_t payload = 0;
+  struct rfNodeStat* m = &medium->node[0];
+
+  printf("\n==== simulation %.2f s, %d slaves, %llu superframes (%.1f /s)\n",
+         seconds, slaves, (unsigned long long)superframes, superframes / seconds);
+  printf("frames on air %llu, air utilization %.1f %%, sync %llu, freq %llu, other %llu\n",
+         (unsigned long long)medium->head, airNs / (seconds * 1e9) * 100.0,
+         (unsigned long long)syncPkts, (unsigned long long)freqPkts, (unsigned long long)otherPkts);
+  printf("slave      polls   zero   data    bytes  reReq  reqPkts  retx   lost  coll  missed  uartRx\n");
+  for (i = 1; i <= slaves; i++){
+    struct slaveTraffic* t = &traffic[i];
+    struct rfNodeStat* s = &medium->node[i];
+    printf("%5d %10llu %6llu %6llu %8llu %6llu %8llu %5llu %6llu %5llu %7llu %7llu\n", i,
+           (unsigned long long)t->polls, (unsigned long long)t->zeroPkts,
+           (unsigned long long)t->dataPkts, (unsigned long long)t->dataBytes,
+           (unsigned long long)t->reRequests, (unsigned long long)t->reRequested,
+           (unsigned long long)t->retxPkts, (unsigned long long)s->rxLost,
+           (unsigned long long)s->rxCollided, (unsigned long long)s->rxMissed,
+           (unsigned long long)s->uartRxBytes);
+    payload += t->dataBytes;
+  }
+  printf("master: rx %llu frames, lost %llu, collided %llu, missed %llu, idle polls %llu\n",
+         (unsigned long long)m->rxFrames, (unsigned long long)m->rxLost,
+         (unsigned long long)m->rxCollided, (unsigned long long)m->rxMissed,
+         (unsigned long long)m->rxIdlePolls);
+  printf("radio payload %.1f B/s, master UART %llu B (%.1f B/s)\n",
+         payload / seconds, (unsigned long long)m->uartTxBytes, m->uartTxBytes / seconds);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt, i, slaves = 4, button = 0, status;
+  double seconds = 5.0;
+  const char* output = "/dev/null";
+  const char* uartFormat = NULL;
+  const char* outFormat = NULL;
+  const char* masterIn = NULL;
+  const char* trace = NULL;
+  char name[32], binary[32], uartIn[256], uartOut[256];
+  pid_t pid[RF_MAX_NODES];
+  struct rfMedium* medium;
+  struct rfFrame frame;
+  struct timespec pause = {0, 1000000};
+  uint64_t cursor = 0, begin, end, now;
+  int8_t state;
+
+  while ((opt = getopt(argc, argv, "s:t:l:x:o:u:w:m:D:R:a:gvh")) != -1){
+    switch (opt){
+      case 's': slaves = atoi(optarg); break;
+      case 't': seconds = atof(optarg); break;
+      case 'l': setenv(SIM_ENV_LOSS, optarg, 1); break;
+      case 'x': setenv(SIM_ENV_TIME_SCALE, optarg, 1); break;
+      case 'o': output = optarg; break;
+      case 'u': uartFormat = optarg; break;
+      case 'w': outFormat = optarg; break;
+      case 'm': masterIn = optarg; break;
+      case 'D': setenv(SIM_ENV_UART_DELAY, optarg, 1); break;
+      case 'R': trace = optarg; break;
+      case 'a': setenv(SIM_ENV_REPLAY_SPEED, optarg, 1); break;
+      case 'g': button = 1; break;
+      case 'v': verbose = 1; break;
+      default:
+        usage(argv[0]);
+        return 1;
+    }
+  }
+  if (slaves < 1 || slaves >= RF_MAX_NODES){
+    fprintf(stderr, "number of slaves must be 1..%d\n", RF_MAX_NODES - 1);
+    return 1;
+  }
+
+  snprintf(name, sizeof(name), "/rfsim%d", (int)getpid());
+  if ((medium = rfMediumCreate(name)) == NULL)
+    return 1;
+  setenv(RF_ENV_MEDIUM, name, 1);
+
+  // slaves first, they have to listen when master start polling
+  for (i = 1; i <= slaves && trace == NULL; i++){
+    snprintf(binary, sizeof(binary), "./Slave%d", i);
+    if (uartFormat)
+      snprintf(uartIn, sizeof(uartIn), uartFormat, i);
+    if (outFormat)
+      snprintf(uartOut, sizeof(uartOut), outFormat, i);
+    pid[i] = start(binary, i, uartFormat ? uartIn : NULL, outFormat ? uartOut : "/dev/null", button);
+  }
+  begin = rfNow();
+  for (i = 1; i <= slaves && trace == NULL; i++){
+    while (!medium->node[i].ready && rfNow() - begin < 5000000000ull)
+      nanosleep(&pause, NULL);
+    if (!medium->node[i].ready)
+      fprintf(stderr, "slave %d is not ready\n", i);
+  }
+  if (trace != NULL)
+    setenv(SIM_ENV_REPLAY, trace, 1);
+  pid[0] = start("./Master", 0, masterIn, output, 0);
+
+  begin = rfNow();
+  end = begin + (uint64_t)(seconds * 1e9);
+  while ((now = rfNow()) < end){
+    while ((state = rfMediumRead(medium, cursor, &frame)) != 0){
+      if (state > 0)
+        classify(&frame);
+      cursor++;
+    }
+    if (waitpid(-1, &status, WNOHANG) > 0){
+      fprintf(stderr, "node terminated before end of simulation\n");
+      break;
+    }
+    nanosleep(&pause, NULL);
+  }
+
+  medium->stop = 1;
+  nanosleep(&(struct timespec){0, 200000000}, NULL);
+  for (i = 0; i <= (trace ? 0 : slaves); i++)
+    kill(pid[i], SIGTERM);
+  while (wait(&status) > 0);
+
+  report(medium, slaves, (now - begin) / 1e9);
+  rfMediumRemove(name);
+  return 0;
+}
@@ -0,0 +1,6 @@
+/**
+   @file     ADUCRF101.h
+   @brief    library.h is including device header in upper case,
+             DasLib headers in mixed case, Linux file system is case sensitive
+**/
+#include "ADuCRF101.h"
@@ -0,0 +1,132 @@
+/**
+ *****************************************************************************
+   @file     ADuCRF101.h
+   @brief    host (Linux) stand-in of ADuCRF101 device header
+             defines only registers, bits and interrupt numbers used by
+             Master.c and Slave.c so that they can be compiled as they are
+             and linked against host peripherals in HostPeriph.c
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    values of bit masks are taken from src/include/Common/ADUCRF101.h
+   @see     HostPeriph.c
+**/
+#ifndef __ADUCRF101_HOST_H
+#define __ADUCRF101_HOST_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Interrupt numbers
+*/
+typedef enum {
+  HardFault_IRQn        = -13,
+  WUT_IRQn              = 0,
+  EINT8_IRQn            = 9,
+  UHFTRX_IRQn           = 9,
+  WDT_IRQn              = 10,
+  TIMER0_IRQn           = 12,
+  TIMER1_IRQn           = 13,
+  ADC0_IRQn             = 14,
+  FLASH_IRQn            = 15,
+  UART_IRQn             = 16,
+  SPI0_IRQn             = 17,
+  SPI1_IRQn             = 18,
+  DMA_UART_TX_IRQn      = 26,
+  DMA_UART_RX_IRQn      = 27,
+  HOST_NUM_OF_IRQn      = 32
+} IRQn_Type;
+
+extern void NVIC_EnableIRQ(IRQn_Type IRQn);
+extern void NVIC_DisableIRQ(IRQn_Type IRQn);
+extern void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+extern void NVIC_SystemReset(void);
+
+/*******************************************************************************
+* Peripherals
+* @note  firmware use only pointers at peripherals, all state is kept in HostPeriph.c
+*/
+typedef struct { volatile uint32_t GPOUT; volatile uint32_t GPIN; } ADI_GPIO_TypeDef;
+typedef struct { volatile uint32_t LD; volatile uint32_t CON; volatile uint32_t STA; } ADI_TIMER_TypeDef;
+typedef struct { volatile uint32_t SPISTA; } ADI_SPI_TypeDef;
+
+extern ADI_GPIO_TypeDef  hostGpio[5];
+extern ADI_TIMER_TypeDef hostTimer[2];
+extern ADI_SPI_TypeDef   hostSpi[2];
+
+#define pADI_GP0    (&hostGpio[0])
+#define pADI_GP1    (&hostGpio[1])
+#define pADI_GP2    (&hostGpio[2])
+#define pADI_GP3    (&hostGpio[3])
+#define pADI_GP4    (&hostGpio[4])
+#define pADI_TM0    (&hostTimer[0])
+#define pADI_TM1    (&hostTimer[1])
+#define pADI_SPI0   (&hostSpi[0])
+#define pADI_SPI1   (&hostSpi[1])
+
+/*******************************************************************************
+* Simulated memory map
+*/
+#define HOST_FLASH_SIZE         0x20000
+extern uint8_t hostFlash[HOST_FLASH_SIZE];
+
+/** @brief code memory is simulated with array filled at start of program @see HostPeriph.c **/
+#define BEGIN_OF_CODE_MEMORY    (hostFlash)
+/** @brief radio configuration is stored in simulated FLASH @see settings.h **/
+#define RADIO_CONF_ADDRESS      ((unsigned long)&hostFlash[0x1f000])
+
+/*******************************************************************************
+* Cycle counter of Profile.h, DWT is simulated from simulation time
+*/
+extern uint32_t hostCycles(void);
+#define PROFILE_CYCLES()        hostCycles()
+#define PROFILE_CYCLES_INIT()
+
+/*******************************************************************************
+* Bit definitions
+*/
+#define BIT0                    0x01
+#define BIT1                    0x02
+#define BIT2                    0x04
+#define BIT3                    0x08
+#define BIT4                    0x10
+#define BIT5                    0x20
+#define BIT6                    0x40
+#define BIT7                    0x80
+
+#define COMIEN_ERBFI            (0x1   << 0  )
+#define COMIEN_EDMAT            (0x1   << 4  )
+#define COMIEN_EDMAR            (0x1   << 5  )
+#define COMIIR_STA_RXBUFFULL    (0x2   << 1  )
+#define COMLCR_WLS_8BITS        (0x3   << 0  )
+#define COMLCR_STOP_DIS         (0x0   << 2  )
+#define COMLCR_STOP_EN          (0x1   << 2  )
+#define COMLSR_FE               (0x1   << 3  )
+
+#define FEESTA_CMDBUSY          (0x1   << 0  )
+#define FEESTA_CMDDONE          (0x1   << 2  )
+#define FEESTA_CMDRES_MSK       (0x3   << 4  )
+#define FEESTA_CMDRES_SUCCESS   (0x0   << 4  )
+#define FEESTA_CMDRES_VERIFYERR (0x2   << 4  )
+
+#define T3CON_ENABLE_DIS        (0x0   << 5  )
+#define T3CON_ENABLE_EN         (0x1   << 5  )
+
+#define TCON_RLD_EN             (0x1   << 7  )
+#define TCON_CLK_UCLK           (0x0   << 5  )
+#define TCON_ENABLE             (0x1   << 4  )
+#define TCON_ENABLE_DIS         (0x0   << 4  )
+#define TCON_ENABLE_EN          (0x1   << 4  )
+#define TCON_MOD_PERIODIC       (0x1   << 3  )
+#define TCON_PRE_DIV1           (0x0   << 0  )
+#define TCON_PRE_DIV16          (0x1   << 0  )
+#define TCON_PRE_DIV256         (0x2   << 0  )
+#define TCON_PRE_DIV32768       (0x3   << 0  )
+#define TCON_PRE_MSK            (0x3   << 0  )
+#define TCLRI_TMOUT             (0x1   << 0  )
+#define TSTA_TMOUT              (0x1   << 0  )
+#define TSTA_CON                (0x1   << 6  )
+#define TSTA_CLRI               (0x1   << 7  )
+
+#endif //__ADUCRF101_HOST_H
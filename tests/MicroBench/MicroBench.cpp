@@ -0,0 +1,684 @@
+/**
+ *****************************************************************************
+   @file     MicroBench.cpp
+   @brief    host microbenchmark of hot paths shared by firmware and PktTester
+              - hexaToBinaryCompression / binaryToHexaDecompression (Compression.c)
+              - hexaToBinaryCompressionV2 and decompression of format v2
+              - tokens of text words of format v2 (TextDict.c)
+              - decompressStream in chunks of DMA_CHUNK_DEPTH (master STREAM_FLUSH)
+              - recordEncode / recordDecode, COBS records of master (Cobs.c)
+              - uwbEncode / uwbDecode (UwbCodec.c)
+              - entropyEncode / entropyDecode (Entropy.c, EntropyTables.c)
+              - binToHexa / hexaToBin, PRNGnew / PRNGcheck (PRNG.c)
+              - crcSlow / crcNibble / crcFast (Integrity/crc.c)
+              - crcSimd, slicing-by-8 and PCLMULQDQ (CrcSimd.c)
+              - crcLibUwb, CRC of uwbpacketclass (CrcLib.hpp)
+              - uwbPacketTx::generatePacket / uwbPacketRx::readPacket
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    every kernel is repeated until it runs at least -m seconds,
+            best of -r runs is reported as ns/op, MB/s and allocations/op
+   @note    corpora of tests/CodecTest/Corpus.cpp, stream is split into UART
+            buffers like UART_Int_Handler() of slave, correctness of kernels
+            is checked by host tests of tests/CodecTest
+   @note    csv output (-c) of one commit can be passed by -b to other commit
+            to print relative change of ns/op
+   @see     read_me.txt
+**/
+#include <cctype>
+#include <chrono>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "uwbpacketclass.hpp"
+#include "settings.h"
+#include "Corpus.hpp"
+#include "Compression.h"
+#include "UwbCodec.h"
+#include "Entropy.h"
+#include "TextDict.h"
+#include "Cobs.h"
+#include "HexSimd.h"
+#include "CrcSimd.h"
+#include "CrcLib.hpp"
+
+/*******************************************************************************
+* allocation counter
+*/
+static uint64_t allocations = 0;
+
+void* operator new(size_t size)
+{
+  void* p;
+  allocations++;
+  if ((p = malloc(size ? size : 1)) == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+void* operator new[](size_t size)
+{
+  return operator new(size);
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+/*******************************************************************************
+* benchmark kernel
+*/
+struct Result {
+  std::string name;
+  size_t   bytes;           /*!< @brief bytes processed by one operation */
+  uint64_t ops;
+  double   nsPerOp;
+  double   mbPerS;
+  double   allocsPerOp;
+};
+
+static double minTime = 0.2;
+static int    runs = 3;
+static const char* filter = NULL;
+static volatile uint32_t sink;  // result of kernels is consumed, compiler can not drop them
+
+/**
+   @brief  repeat op until it runs minTime, best of runs is taken
+   @param  name : name of kernel in output
+   @param  bytes : bytes processed by one call of op
+   @param  op : kernel, argument is index of call
+**/
+template <class Op>
+static Result bench(const char* name, size_t bytes, Op op)
+{
+  typedef std::chrono::steady_clock clock;
+  Result res = {name, bytes, 0, 1e30, 0, 0};
+  uint64_t n = 1, i, index = 0;
+
+  if (filter && strstr(name, filter) == NULL)
+    return res;
+  for (int r = 0; r < runs; r++){
+    double elapsed;
+    uint64_t allocs;
+    for (;;){
+      allocs = allocations;
+      clock::time_point begin = clock::now();
+      for (i = 0; i < n; i++)
+        op(index++);
+      elapsed = std::chrono::duration<double>(clock::now() - begin).count();
+      allocs = allocations - allocs;
+      if (elapsed >= minTime)
+        break;
+      n = (elapsed > minTime / 100) ? (uint64_t)(n * minTime * 1.2 / elapsed) + 1 : n * 10;
+    }
+    if (elapsed * 1e9 / n < res.nsPerOp){
+      res.nsPerOp = elapsed * 1e9 / n;
+      res.ops = n;
+      res.allocsPerOp = (double)allocs / n;
+    }
+  }
+  res.mbPerS = bytes / res.nsPerOp * 1e3;
+  return res;
+}
+
+/*******************************************************************************
+* kernels
+*/
+static void benchCompression(std::vector<Result>& out, const char* corpus, const std::vector<Buffer>& words)
+{
+  std::vector<Buffer> buffers = uartBuffers(words);
+  std::vector<Buffer> compressed;
+  uint8_t dest[UART_BUFFER_DEEPTH * 2];
+  size_t n = buffers.size(), bytes = totalSize(buffers) / n;
+  std::string name;
+
+  for (Buffer& b : buffers){
+    uint16_t len = hexaToBinaryCompression(b.data(), dest, b.size());
+    compressed.push_back(Buffer(dest, dest + len));
+  }
+
+  name = std::string("hexaToBinaryCompression/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    Buffer& b = buffers[i % n];
+    sink += hexaToBinaryCompression(b.data(), dest, b.size());
+  }));
+  name = std::string("hexaToBinaryCompressionRef/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    Buffer& b = buffers[i % n];
+    sink += hexaToBinaryCompressionRef(b.data(), dest, b.size());
+  }));
+  name = std::string("binaryToHexaDecompression/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    Buffer& b = compressed[i % n];
+    sink += binaryToHexaDecompression(b.data(), dest, b.size());
+  }));
+
+  compressed.clear();
+  textEncoderReset();
+  textDecoderReset();
+  for (Buffer& b : buffers){
+    uint16_t len = hexaToBinaryCompressionV2(b.data(), dest, b.size());
+    compressed.push_back(Buffer(dest, dest + len));
+  }
+  name = std::string("hexaToBinaryCompressionV2/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    Buffer& b = buffers[i % n];
+    sink += hexaToBinaryCompressionV2(b.data(), dest, b.size());
+  }));
+  name = std::string("binaryToHexaDecompressionV2/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    Buffer& b = compressed[i % n];
+    sink += binaryToHexaDecompression(b.data(), dest, b.size());
+  }));
+  // latency of first DMA transfer of packet, whole packet in chunks
+  name = std::string("decompressStreamFirst/") + corpus;
+  out.push_back(bench(name.c_str(), DMA_CHUNK_DEPTH, [&](uint64_t i){
+    Buffer& b = compressed[i % n];
+    struct decompressStream stream;
+    decompressStreamInit(&stream, b.data(), b.size());
+    sink += decompressStream(&stream, dest, DMA_CHUNK_DEPTH);
+  }));
+  name = std::string("decompressStreamV2/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    Buffer& b = compressed[i % n];
+    struct decompressStream stream;
+    decompressStreamInit(&stream, b.data(), b.size());
+    while (!decompressStreamDone(&stream))
+      sink += decompressStream(&stream, dest, DMA_CHUNK_DEPTH);
+  }));
+}
+
+static void benchUwbCodec(std::vector<Result>& out, const std::vector<Buffer>& words)
+{
+  std::vector<Buffer> records;
+  uint8_t record[UART_BUFFER_DEEPTH], hexa[UART_BUFFER_DEEPTH * 3];
+  size_t n = words.size(), bytes = words[0].size();
+
+  uwbReset();
+  for (const Buffer& w : words){
+    uint16_t len = uwbEncode((uint8_t*)w.data(), w.size() - 1, record);
+    records.push_back(Buffer(record, record + len));
+  }
+
+  // first frame of corpus is keyframe again after wrap (gap of packetCount)
+  uwbReset();
+  out.push_back(bench("uwbEncode/uwb", bytes, [&](uint64_t i){
+    const Buffer& w = words[i % n];
+    sink += uwbEncode((uint8_t*)w.data(), w.size() - 1, record);
+  }));
+  uwbReset();
+  out.push_back(bench("uwbDecode/uwb", bytes, [&](uint64_t i){
+    sink += uwbDecode(records[i % n].data(), hexa);
+  }));
+  uwbReset();
+}
+
+static void benchEntropy(std::vector<Result>& out, const char* corpus, const std::vector<Buffer>& payloads)
+{
+  std::vector<Buffer> coded;
+  std::vector<uint8_t> tables;
+  uint8_t dest[PACKET_MEMORY_DEPTH], decoded[256], table;
+  size_t n = payloads.size(), bytes = totalSize(payloads) / n;
+  uint16_t len;
+  std::string name;
+
+  for (const Buffer& p : payloads){
+    table = entropyEncode(p.data(), p.size(), dest, &len);
+    if (table){
+      coded.push_back(Buffer(dest, dest + len));
+      tables.push_back(table);
+    }
+  }
+
+  name = std::string("entropyEncode/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    const Buffer& p = payloads[i % n];
+    sink += entropyEncode(p.data(), p.size(), dest, &len);
+  }));
+  if (coded.empty())
+    return;
+  name = std::string("entropyDecode/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    const Buffer& c = coded[i % coded.size()];
+    sink += entropyDecode(tables[i % coded.size()], c.data(), c.size(), decoded);
+  }));
+}
+
+static void benchRecord(std::vector<Result>& out, const char* corpus, const std::vector<Buffer>& payloads)
+{
+  std::vector<Buffer> frames;
+  uint8_t record[RECORD_HEAD + PACKET_MEMORY_DEPTH + RECORD_CRC], frame[RECORD_MAX_FRAME];
+  size_t n = payloads.size(), bytes = totalSize(payloads) / n;
+  uint16_t len;
+  std::string name;
+
+  record[0] = 1;
+  record[1] = 1;
+  for (const Buffer& p : payloads){
+    memcpy(&record[RECORD_HEAD], p.data(), p.size());
+    len = recordEncode(record, p.size(), frame);
+    frames.push_back(Buffer(frame + 1, frame + len - 1));
+  }
+
+  name = std::string("recordEncode/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    const Buffer& p = payloads[i % n];
+    memcpy(&record[RECORD_HEAD], p.data(), p.size());
+    sink += recordEncode(record, p.size(), frame);
+  }));
+  name = std::string("recordDecode/") + corpus;
+  out.push_back(bench(name.c_str(), bytes, [&](uint64_t i){
+    const Buffer& f = frames[i % n];
+    sink += recordDecode(f.data(), f.size(), record);
+  }));
+}
+
+static void benchHexa(std::vector<Result>& out)
+{
+  static const size_t sizes[] = {sizeof(struct PRNGrandomPacket), PACKETRAM_LEN};
+  uint8_t bin[PACKETRAM_LEN], hexa[PACKETRAM_LEN * 2];
+  uint8_t best = hexaSimdLevel(-1), level;
+  char name[64];
+
+  for (size_t i = 0; i < sizeof(bin); i++)
+    bin[i] = (uint8_t)(i * 37 + 11);
+  binToHexa(bin, hexa, sizeof(bin));
+  for (size_t len : sizes){
+    snprintf(name, sizeof(name), "binToHexa/%u", (unsigned)len);
+    out.push_back(bench(name, len, [&](uint64_t){
+      binToHexa(bin, hexa, len);
+      sink += hexa[len];
+    }));
+    snprintf(name, sizeof(name), "hexaToBin/%u", (unsigned)len);
+    out.push_back(bench(name, len * 2, [&](uint64_t){
+      hexaToBin(hexa, bin, len);
+      sink += bin[len / 2];
+    }));
+  }
+
+  // each level of HexSimd.c, names without level are using selected level
+  for (size_t len : sizes){
+    for (level = HEXA_SIMD_SCALAR; level <= best; level++){
+      hexaSimdLevel(level);
+      snprintf(name, sizeof(name), "binToHexa/%u/%s", (unsigned)len, hexaSimdName(level));
+      out.push_back(bench(name, len, [&](uint64_t){
+        binToHexa(bin, hexa, len);
+        sink += hexa[len];
+      }));
+      snprintf(name, sizeof(name), "hexaToBin/%u/%s", (unsigned)len, hexaSimdName(level));
+      out.push_back(bench(name, len * 2, [&](uint64_t){
+        hexaToBin(hexa, bin, len);
+        sink += bin[len / 2];
+      }));
+    }
+  }
+  hexaSimdLevel(best);
+}
+
+static void benchPrng(std::vector<Result>& out, const std::vector<PRNGrandomPacket>& packets)
+{
+  struct PRNGslave generator, checker[CORPUS_SLAVES];
+  uint8_t message[256];
+  size_t n = packets.size();
+  int i;
+
+  memset(&generator, 0, sizeof(generator));
+  memset(checker, 0, sizeof(checker));
+  PRNGinit(&generator, 1);
+  out.push_back(bench("PRNGnew", sizeof(struct PRNGrandomPacket), [&](uint64_t){
+    PRNGnew(&generator);
+    sink += generator.packet.crc;
+  }));
+
+  // received stream is replayed, checkers start again with stream
+  out.push_back(bench("PRNGcheck", sizeof(struct PRNGrandomPacket), [&](uint64_t index){
+    if (index % n == 0)
+      for (i = 0; i < CORPUS_SLAVES; i++)
+        PRNGinit(&checker[i], i + 1);
+    PRNGrandomPacket pkt = packets[index % n];
+    sink += PRNGcheck(checker, &pkt, message, CORPUS_SLAVES);
+  }));
+}
+
+static void benchCrc(std::vector<Result>& out)
+{
+  static const size_t sizes[] = {sizeof(struct PRNGrandomPacket) - sizeof(crc), PACKETRAM_LEN, 4096};
+  std::vector<unsigned char> data(4096);
+  uint8_t best = crcSimdLevel(-1), level;
+  char name[64];
+
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = (unsigned char)(i * 131 + 7);
+  for (size_t len : sizes){
+    snprintf(name, sizeof(name), "crcSlow/%u", (unsigned)len);
+    out.push_back(bench(name, len, [&](uint64_t){
+      sink += crcSlow(data.data(), len);
+    }));
+    snprintf(name, sizeof(name), "crcNibble/%u", (unsigned)len);
+    out.push_back(bench(name, len, [&](uint64_t){
+      sink += crcNibble(data.data(), len);
+    }));
+    snprintf(name, sizeof(name), "crcFast/%u", (unsigned)len);
+    out.push_back(bench(name, len, [&](uint64_t){
+      sink += crcFast(data.data(), len);
+    }));
+    snprintf(name, sizeof(name), "crcLibUwb/%u", (unsigned)len);
+    out.push_back(bench(name, len, [&](uint64_t){
+      sink += crcLibUwb::compute(data.data(), len);
+    }));
+  }
+
+  // each level of CrcSimd.c, 1 MB is bigger than caches of data
+  data.resize(1 << 20);
+  for (size_t i = 4096; i < data.size(); i++)
+    data[i] = (unsigned char)(i * 131 + 7);
+  for (size_t len : {sizes[0], sizes[1], sizes[2], data.size()}){
+    for (level = CRC_SIMD_TABLE; level <= best; level++){
+      crcSimdLevel(level);
+      snprintf(name, sizeof(name), "crcSimd/%u/%s", (unsigned)len, crcSimdName(level));
+      out.push_back(bench(name, len, [&](uint64_t){
+        sink += crcSimd(data.data(), len);
+      }));
+    }
+  }
+  crcSimdLevel(best);
+}
+
+static void benchUwb(std::vector<Result>& out, const std::vector<Buffer>& words)
+{
+  std::vector<Buffer> packets(words);
+  float data[UWB_VALUES];
+  uwbPacketTx tx(1);
+  uwbPacketRx rx;
+  size_t n = packets.size();
+
+  for (int j = 0; j < UWB_VALUES; j++)
+    data[j] = 1.5f + j;
+  out.push_back(bench("uwbPacketTx::generatePacket", UWB_VALUES * sizeof(float), [&](uint64_t){
+    tx.generatePacket(data, UWB_VALUES);
+    sink += tx.getPacketLength();
+  }));
+  tx.deleteLastPacket();
+
+  out.push_back(bench("uwbPacketRx::readPacket", packets[0].size(), [&](uint64_t i){
+    Buffer& p = packets[i % n];
+    rx.setPacket(p.data());
+    rx.setPacketLength(p.size());
+    rx.readPacket();
+    sink += rx.getRadarId();
+    delete[] rx.getData();      // readPacket() allocates data of each packet
+  }));
+  rx.setPacket(NULL);
+}
+
+/*******************************************************************************
+* output
+*/
+static std::map<std::string, double> readBaseline(const char* file)
+{
+  std::map<std::string, double> baseline;
+  char line[256], name[128];
+  double ns;
+  FILE* f = fopen(file, "r");
+
+  if (f == NULL){
+    perror(file);
+    return baseline;
+  }
+  while (fgets(line, sizeof(line), f))
+    if (sscanf(line, "%127[^,],%*[^,],%*[^,],%lf", name, &ns) == 2)
+      baseline[name] = ns;
+  fclose(f);
+  return baseline;
+}
+
+static void printResults(const std::vector<Result>& results, bool csv, const char* baselineFile)
+{
+  std::map<std::string, double> baseline;
+
+  if (baselineFile)
+    baseline = readBaseline(baselineFile);
+  if (csv)
+    printf("name,bytes,ops,nsPerOp,MBperS,allocsPerOp%s\n", baselineFile ? ",change" : "");
+  else
+    printf("%-36s %6s %12s %12s %10s %8s%s\n", "name", "bytes", "ops", "ns/op", "MB/s", "alloc/op",
+           baselineFile ? "   change" : "");
+  for (const Result& r : results){
+    if (r.ops == 0)       // skipped by filter
+      continue;
+    if (csv)
+      printf("%s,%u,%llu,%.2f,%.2f,%.2f", r.name.c_str(), (unsigned)r.bytes,
+             (unsigned long long)r.ops, r.nsPerOp, r.mbPerS, r.allocsPerOp);
+    else
+      printf("%-36s %6u %12llu %12.2f %10.2f %8.2f", r.name.c_str(), (unsigned)r.bytes,
+             (unsigned long long)r.ops, r.nsPerOp, r.mbPerS, r.allocsPerOp);
+    if (baselineFile){
+      std::map<std::string, double>::iterator b = baseline.find(r.name);
+      if (b != baseline.end())
+        printf(csv ? ",%.1f%%" : " %+7.1f%%", (r.nsPerOp / b->second - 1.0) * 100.0);
+      else
+        printf(csv ? "," : "        -");
+    }
+    printf("\n");
+  }
+}
+
+/**
+   @brief  TSC ticks per ns, 0 if not x86
+**/
+static double tscPerNs(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  typedef std::chrono::steady_clock clock;
+  clock::time_point begin = clock::now();
+  uint64_t tsc = __rdtsc();
+  while (clock::now() - begin < std::chrono::milliseconds(50));
+  return (__rdtsc() - tsc) / (std::chrono::duration<double>(clock::now() - begin).count() * 1e9);
+#else
+  return 0;
+#endif
+}
+
+/**
+   @brief  time saved by kernel against reference kernel (name + "Ref") per
+           packet of PACKETRAM_LEN bytes
+**/
+static void printSavings(const std::vector<Result>& results)
+{
+  double tsc = -1;
+
+  for (const Result& ref : results){
+    size_t pos = ref.name.find("Ref/");
+    if (ref.ops == 0 || pos == std::string::npos)
+      continue;
+    std::string name = ref.name.substr(0, pos) + ref.name.substr(pos + 3);
+    for (const Result& r : results){
+      if (r.name != name || r.ops == 0)
+        continue;
+      double refNs = ref.nsPerOp * PACKETRAM_LEN / ref.bytes;
+      double ns = r.nsPerOp * PACKETRAM_LEN / r.bytes;
+      if (tsc < 0)
+        tsc = tscPerNs();
+      printf("%s : %.0f -> %.0f ns per %u B packet, saved %.0f ns", name.c_str(), refNs, ns,
+             PACKETRAM_LEN, refNs - ns);
+      if (tsc > 0)
+        printf(" (%.0f TSC cycles)", (refNs - ns) * tsc);
+      printf(" %.1f %%\n", (1.0 - ns / refNs) * 100.0);
+    }
+  }
+}
+
+/**
+   @brief  radio bytes of UWB corpus, records of hexaToBinaryCompression() and
+           of uwbEncode(), frames in one packet of PACKETRAM_LEN bytes
+**/
+static void printUwbSize(const std::vector<Buffer>& words)
+{
+  uint8_t record[UART_BUFFER_DEEPTH];
+  size_t hexaBytes = 0, uwbBytes = 0;
+  double hexaFrame, uwbFrame;
+
+  uwbReset();
+  for (const Buffer& w : words){
+    hexaBytes += (w.size() - 1) / 2 + 1;
+    uwbBytes += uwbEncode((uint8_t*)w.data(), w.size() - 1, record);
+  }
+  uwbReset();
+  hexaFrame = (double)hexaBytes / words.size();
+  uwbFrame = (double)uwbBytes / words.size();
+  printf("uwb : %.1f -> %.1f B per frame of %u values (keyframe any %u), %.1f -> %.1f frames per %u B packet\n",
+         hexaFrame, uwbFrame, UWB_VALUES, UWB_KEYFRAME_INTERVAL,
+         (PACKETRAM_LEN - HEAD_LENGHT) / hexaFrame, (PACKETRAM_LEN - HEAD_LENGHT) / uwbFrame, PACKETRAM_LEN);
+}
+
+/**
+   @brief  radio bytes of packet payloads before and after entropyEncode(),
+           not coded payloads are counted with original size
+**/
+static void printEntropySize(const char* corpus, const std::vector<Buffer>& payloads)
+{
+  uint8_t dest[PACKET_MEMORY_DEPTH];
+  size_t bytes = 0, codedBytes = 0, codedPkts = 0;
+  uint16_t len;
+
+  for (const Buffer& p : payloads){
+    bytes += p.size();
+    if (entropyEncode(p.data(), p.size(), dest, &len)){
+      codedBytes += len;
+      codedPkts++;
+    }
+    else
+      codedBytes += p.size();
+  }
+  printf("entropy %s : %u -> %u B of payloads (%.1f %%), %u of %u packets coded\n", corpus,
+         (unsigned)bytes, (unsigned)codedBytes, 100.0 * codedBytes / bytes,
+         (unsigned)codedPkts, (unsigned)payloads.size());
+}
+
+/**
+   @brief  radio bytes of text corpus in format v2 with tokens of text words
+           and without them (not hexadecimal word is [0][lenght][chars])
+**/
+static void printTextSize(const std::vector<Buffer>& words)
+{
+  uint8_t dest[UART_BUFFER_DEEPTH * 2];
+  size_t chars = 0, rawBytes = 0, textBytes = 0;
+
+  for (const Buffer& w : words){
+    bool hexa = true;
+    for (size_t i = 0; i + 1 < w.size(); i++)
+      hexa = hexa && isxdigit(w[i]);
+    rawBytes += hexa ? (w.size() - 1 + 1) / 2 + 1 : w.size() - 1 + 2;
+  }
+  for (Buffer& b : uartBuffers(words)){
+    textEncoderReset();                 // any UART buffer is superframe
+    chars += b.size();
+    textBytes += hexaToBinaryCompressionV2(b.data(), dest, b.size()) - COMPRESSION_BLOCK_HEAD;
+  }
+  printf("text : %u chars -> %u B of words v2, %u B with tokens (%.1f %%)\n",
+         (unsigned)chars, (unsigned)rawBytes, (unsigned)textBytes, 100.0 * textBytes / rawBytes);
+}
+
+/**
+   @brief  master UART bytes of payloads as hexadecimal words (binaryToHexaDecompression())
+           and as COBS framed records (BINARY_OUTPUT)
+**/
+static void printRecordSize(const char* corpus, const std::vector<Buffer>& payloads)
+{
+  uint8_t record[RECORD_HEAD + PACKET_MEMORY_DEPTH + RECORD_CRC], frame[RECORD_MAX_FRAME];
+  uint8_t hexa[DECOMPRESSED_DEPTH];
+  size_t hexaBytes = 0, recordBytes = 0;
+
+  record[0] = 1;
+  record[1] = 1;
+  for (const Buffer& p : payloads){
+    Buffer in(p);
+    hexaBytes += binaryToHexaDecompression(in.data(), hexa, in.size());
+    memcpy(&record[RECORD_HEAD], p.data(), p.size());
+    recordBytes += recordEncode(record, p.size(), frame);
+  }
+  printf("binary %s : %u B of hexadecimal words -> %u B of records (%.1f %%)\n",
+         corpus, (unsigned)hexaBytes, (unsigned)recordBytes, 100.0 * recordBytes / hexaBytes);
+}
+
+static void help(void)
+{
+  printf("MicroBench is measuring hot paths of Compression.c, TextDict.c, UwbCodec.c, Entropy.c, Cobs.c, PRNG.c, crc.c and uwbpacketclass.cpp\n");
+  printf("usage: 'MicroBench [-m, -r, -f, -c, -b, -h]'\n");
+  printf("example: 'MicroBench -c > base.csv' and after change 'MicroBench -b base.csv'\n");
+  printf("parameters: -m minimal time of one run in s [0.2]\n");
+  printf("            -r number of runs, best is reported [3]\n");
+  printf("            -f run only kernels containing string\n");
+  printf("            -c csv output\n");
+  printf("            -b csv output of previous run, print change of ns/op\n");
+  printf("            -h help\n");
+}
+
+int main(int argc, char* argv[])
+{
+  std::vector<Result> results;
+  std::vector<PRNGrandomPacket> packets;
+  const char *baselineFile = NULL;
+  bool csv = false;
+  char* ptr;
+  int i;
+
+  for (i = 1; i < argc; i++){
+    if (strcmp(argv[i], "-m") == 0 && i + 1 < argc)        // -m minimal time of run
+      minTime = strtod(argv[++i], &ptr);
+    else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)   // -r number of runs
+      runs = strtol(argv[++i], &ptr, 10);
+    else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)   // -f filter
+      filter = argv[++i];
+    else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)   // -b baseline
+      baselineFile = argv[++i];
+    else if (strcmp(argv[i], "-c") == 0)                   // -c csv
+      csv = true;
+    else {
+      help();
+      return strcmp(argv[i], "-h") ? 2 : 0;
+    }
+  }
+  if (minTime <= 0 || runs < 1){
+    help();
+    return 2;
+  }
+
+  std::vector<Buffer> prng = prngWords(&packets);
+  std::vector<Buffer> uwb = uwbWords();
+  std::vector<Buffer> prngPayloads = packetPayloads(prng, false);
+  std::vector<Buffer> uwbPayloads = packetPayloads(uwb, true);
+  std::vector<Buffer> text = textWords();
+
+  benchCompression(results, "prng", prng);
+  benchCompression(results, "uwb", uwb);
+  benchCompression(results, "text", text);
+  benchUwbCodec(results, uwb);
+  benchEntropy(results, "prng", prngPayloads);
+  benchEntropy(results, "uwb", uwbPayloads);
+  benchRecord(results, "prng", prngPayloads);
+  benchHexa(results);
+  benchPrng(results, packets);
+  benchCrc(results);
+  benchUwb(results, uwb);
+
+  printResults(results, csv, baselineFile);
+  if (!csv){
+    printSavings(results);
+    printUwbSize(uwb);
+    printEntropySize("prng", prngPayloads);
+    printEntropySize("uwb", uwbPayloads);
+    printTextSize(text);
+    printRecordSize("prng", prngPayloads);
+  }
+  return 0;
+}
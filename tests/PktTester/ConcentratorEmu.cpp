@@ -0,0 +1,381 @@
+/**
+ *****************************************************************************
+   @file     ConcentratorEmu.cpp
+   @brief    emulator of master (concentrator) UART output for stress test of
+             PktReader at line rate without boards and without PktGenerator
+              - N virtual slaves generating PRNG packets by PRNGnew()
+              - radio packets of slaves are flushed in superframe order as
+                slowFlush() of Master is doing it
+              - output to file, stdout or Linux pseudo-terminal
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    one radio packet carries as many whole words as fit into
+            PACKETRAM_LEN - HEAD_LENGHT, with COMPRESSION words are packed
+            compressed and decompressed by binaryToHexaDecompression() before
+            output, like in Master
+   @note    lost radio packet is reported by "\nmissing packet n #" message
+            of Master, other faults (-w -r -e) are injected silently
+   @note    with -B radio packet is COBS framed record of BINARY_OUTPUT
+            (Cobs.h) with compressed words, lost packet is record without
+            payload, read by PktReader -binary
+   @note    output is paced by -b baud rate (10 bits per byte), 0 is not paced,
+            pseudo-terminal is blocking writer when PktReader is slower, with -O
+            bytes are dropped as by UART without flow control
+   @code
+        ./ConcentratorEmu -s 4 -b 921600 -p /tmp/emu -t 10 &
+        ./PktReader 1 -D /tmp/emu -s 4 -T 11
+   @endcode
+   @see     read_me.txt, flood_test.sh
+**/
+#include <string>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "settings.h"
+#include "Compression.h"
+#include "Cobs.h"
+#include "PRNG.h"
+
+
+#define MAX_SLAVES      9
+/** @brief hexadecimal word with STRING_TERMINATOR **/
+#define HEXA_WORD_LEN   (sizeof(struct PRNGrandomPacket) * 2 + 1)
+/** @brief start, 8 data and stop bit **/
+#define BITS_PER_BYTE   10.0
+/** @brief time to read rest of data from pseudo-terminal after end of emulation **/
+#define LINGER_SECONDS  1
+
+static int      slaves = 4;
+static int      packetsPerSlot = NUM_OF_PACKETS_IN_MEMORY;
+static double   baud = UART_BAUD_RATE_MASTER;
+static double   radioLoss = 0, wordLoss = 0, reorder = 0, corrupt = 0;
+static int      compression = COMPRESSION;
+static int      binaryRecords = 0;
+static int      overrun = 0;
+static int      fd = -1, peerFd = -1;
+static volatile sig_atomic_t stop = 0;
+
+/** @brief statistic of emulator **/
+static uint64_t words, bytes, lostPackets, lostWords, wordsSkipped, reordered, corrupted, overrunBytes;
+
+static void usage(const char* name)
+{
+  printf("usage: %s [options]\n"
+         "  -s <n>      number of virtual slaves 1..%d (default 4)\n"
+         "  -k <n>      radio packets of slave in superframe (default %d)\n"
+         "  -o <file>   output file, - is stdout (default -)\n"
+         "  -p <path>   output to pseudo-terminal linked as <path>\n"
+         "  -b <baud>   baud rate of master UART, 0 = not paced (default %d)\n"
+         "  -c <0|1>    words are packed compressed in radio packet (default %d)\n"
+         "  -B          binary records of BINARY_OUTPUT (Cobs.h), needs -c 1\n"
+         "  -l <p>      probability of lost radio packet, reported by Master (default 0)\n"
+         "  -w <p>      probability of silently lost word (default 0)\n"
+         "  -r <p>      probability of word swapped with next word of slave (default 0)\n"
+         "  -e <p>      probability of corrupted hexadecimal char in word (default 0)\n"
+         "  -O          drop bytes if pseudo-terminal is full (UART overrun)\n"
+         "  -d <s>      delay before first byte, PktReader is opening port (default 0)\n"
+         "  -t <s>      duration in seconds, 0 = until SIGINT/SIGTERM or -n (default 0)\n"
+         "  -n <n>      number of words of each slave, 0 = unlimited (default 0)\n"
+         "  -S <seed>   seed of fault model (default 1)\n",
+         name, MAX_SLAVES, NUM_OF_PACKETS_IN_MEMORY, UART_BAUD_RATE_MASTER, COMPRESSION);
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void onSignal(int signal)
+{
+  (void)signal;
+  stop = 1;
+}
+
+/**
+   @fn     static int openPty(const char* link)
+   @brief  create pseudo-terminal in raw mode and link to its slave side
+   @return 0 if success
+**/
+static int openPty(const char* link)
+{
+  struct termios tio;
+  const char* name;
+
+  if ((fd = posix_openpt(O_RDWR | O_NOCTTY)) < 0 || grantpt(fd) || unlockpt(fd)
+      || (name = ptsname(fd)) == NULL){
+    perror("posix_openpt");
+    return 1;
+  }
+  if ((peerFd = open(name, O_RDWR | O_NOCTTY)) < 0){
+    perror(name);
+    return 1;
+  }
+  tcgetattr(peerFd, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(peerFd, TCSANOW, &tio);
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+  unlink(link);
+  if (symlink(name, link)){
+    perror(link);
+    return 1;
+  }
+  fprintf(stderr, "%s -> %s\n", link, name);
+  return 0;
+}
+
+/**
+   @fn     static void output(const uint8_t* data, size_t len, int isPty)
+   @brief  write data to master UART, pseudo-terminal is blocking writer
+           or dropping bytes in overrun mode
+**/
+static void output(const uint8_t* data, size_t len, int isPty)
+{
+  struct pollfd pfd;
+  ssize_t w;
+
+  while (len > 0){
+    w = write(fd, data, len);
+    if (w > 0){
+      data += w;
+      len -= w;
+      bytes += w;
+      continue;
+    }
+    if (w < 0 && errno != EAGAIN && errno != EINTR){
+      perror("write");
+      stop = 1;
+      return;
+    }
+    if (!isPty)
+      continue;
+    if (overrun){
+      overrunBytes += len;
+      return;
+    }
+    if (stop)
+      return;
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+    poll(&pfd, 1, 10);
+  }
+}
+
+/**
+   @fn     static void corruptWord(uint8_t* word)
+   @brief  one hexadecimal char of word is changed to other hexadecimal char
+**/
+static void corruptWord(uint8_t* word)
+{
+  static const char hexa[] = "0123456789ABCDEF";
+  size_t pos = lrand48() % (HEXA_WORD_LEN - 1);
+  char c;
+
+  do
+    c = hexa[lrand48() % 16];
+  while (c == word[pos]);
+  word[pos] = c;
+}
+
+static void printStatistic(double seconds)
+{
+  fprintf(stderr, "emu words %llu bytes %llu lost packets %llu words %llu skipped %llu reordered %llu "
+          "corrupted %llu overrun %llu time %.1f s rate %.0f B/s requested %.0f B/s\n",
+          (unsigned long long)words, (unsigned long long)bytes, (unsigned long long)lostPackets,
+          (unsigned long long)lostWords, (unsigned long long)wordsSkipped,
+          (unsigned long long)reordered, (unsigned long long)corrupted,
+          (unsigned long long)overrunBytes, seconds, seconds > 0 ? bytes / seconds : 0.0,
+          baud / BITS_PER_BYTE);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt, i, j, k, isPty = 0;
+  double seconds = 0, delay = 0, begin, txNext, t;
+  const char* file = "-";
+  const char* link = NULL;
+  unsigned long count = 0;
+  long seed = 1;
+  struct PRNGslave slave[MAX_SLAVES];
+  uint8_t hexa[HEXA_WORD_LEN + 1], binary[HEXA_WORD_LEN + 1];
+  uint8_t radioPkt[PACKETRAM_LEN];
+  uint8_t flushBuffer[PACKETRAM_LEN * 2 + 1];
+  uint8_t record[RECORD_HEAD + PACKET_MEMORY_DEPTH + RECORD_CRC], frame[RECORD_MAX_FRAME];
+  char message[32];
+  size_t wordBytes, wordsPerPacket, len;
+  std::vector<std::string> pkt;   // words of one radio packet in output format
+
+  while ((opt = getopt(argc, argv, "s:k:o:p:b:c:Bl:w:r:e:Od:t:n:S:h")) != -1){
+    switch (opt){
+      case 's': slaves = atoi(optarg); break;
+      case 'k': packetsPerSlot = atoi(optarg); break;
+      case 'o': file = optarg; break;
+      case 'p': link = optarg; break;
+      case 'b': baud = atof(optarg); break;
+      case 'c': compression = atoi(optarg); break;
+      case 'B': binaryRecords = 1; break;
+      case 'l': radioLoss = atof(optarg); break;
+      case 'w': wordLoss = atof(optarg); break;
+      case 'r': reorder = atof(optarg); break;
+      case 'e': corrupt = atof(optarg); break;
+      case 'O': overrun = 1; break;
+      case 'd': delay = atof(optarg); break;
+      case 't': seconds = atof(optarg); break;
+      case 'n': count = strtoul(optarg, NULL, 0); break;
+      case 'S': seed = atol(optarg); break;
+      default:
+        usage(argv[0]);
+        return 1;
+    }
+  }
+  if (slaves < 1 || slaves > MAX_SLAVES || packetsPerSlot < 1){
+    fprintf(stderr, "number of slaves must be 1..%d, number of packets at least 1\n", MAX_SLAVES);
+    return 1;
+  }
+  if (binaryRecords && !compression){
+    fprintf(stderr, "binary records are carrying compressed words (-c 1)\n");
+    return 1;
+  }
+  srand48(seed);
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  signal(SIGPIPE, SIG_IGN);
+
+  for (i = 0; i < slaves; i++)
+    PRNGinit(&slave[i], i + 1);
+
+  // capacity of radio packet is given by length of word stored in pktMemory
+  memset(hexa, '0', HEXA_WORD_LEN - 1);
+  hexa[HEXA_WORD_LEN - 1] = STRING_TERMINATOR;
+  wordBytes = compression ? hexaToBinaryCompression(hexa, binary, HEXA_WORD_LEN) : HEXA_WORD_LEN;
+  wordsPerPacket = (PACKETRAM_LEN - HEAD_LENGHT) / wordBytes;
+  fprintf(stderr, "%d slaves, %d packets in slot, %zu words of %zu bytes in packet\n",
+          slaves, packetsPerSlot, wordsPerPacket, wordBytes);
+
+  if (link != NULL){
+    if (openPty(link))
+      return 1;
+    isPty = 1;
+  }else if (strcmp(file, "-") == 0)
+    fd = STDOUT_FILENO;
+  else if ((fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0){
+    perror(file);
+    return 1;
+  }
+  if (delay > 0)
+    usleep((useconds_t)(delay * 1e6));
+
+  begin = txNext = now();
+  while (!stop){
+    // superframe, slots of slaves in order, packets of slave in order
+    for (i = 0; i < slaves && !stop; i++){
+      if (count > 0 && slave[i].packet.numberOfPacket >= count)
+        continue;
+      for (j = 0; j < packetsPerSlot && !stop; j++){
+        if (seconds > 0 && now() - begin >= seconds){
+          stop = 1;
+          break;
+        }
+        // content of radio packet as generated by slave
+        pkt.clear();
+        len = 0;
+        for (k = 0; k < (int)wordsPerPacket; k++){
+          if (count > 0 && slave[i].packet.numberOfPacket >= count)
+            break;
+          PRNGnew(&slave[i]);
+          binToHexa((uint8_t*)&slave[i].packet, hexa, sizeof(struct PRNGrandomPacket));
+          hexa[HEXA_WORD_LEN - 1] = STRING_TERMINATOR;
+          if (compression){
+            // stored compressed in pktMemory, decompressed by slowFlush
+            len = hexaToBinaryCompression(hexa, radioPkt, HEXA_WORD_LEN);
+            len = binaryToHexaDecompression(radioPkt, flushBuffer, len);
+            pkt.push_back(std::string((char*)flushBuffer, len));
+          }else
+            pkt.push_back(std::string((char*)hexa, HEXA_WORD_LEN));
+        }
+        if (pkt.empty())
+          break;
+
+        if (radioLoss > 0 && drand48() < radioLoss){
+          lostPackets++;
+          wordsSkipped += pkt.size();
+          len = sprintf(message, "\nmissing packet %d #", j + 1);
+          pkt.assign(1, std::string(message, len));
+        }else{
+          for (k = 0; k < (int)pkt.size(); k++){
+            if (wordLoss > 0 && drand48() < wordLoss){
+              lostWords++;
+              wordsSkipped++;
+              pkt.erase(pkt.begin() + k--);
+              continue;
+            }
+            if (k + 1 < (int)pkt.size() && reorder > 0 && drand48() < reorder){
+              pkt[k].swap(pkt[k + 1]);
+              reordered++;
+              k++;
+            }
+          }
+          for (k = 0; k < (int)pkt.size(); k++)
+            if (corrupt > 0 && drand48() < corrupt){
+              corruptWord((uint8_t*)&pkt[k][0]);
+              corrupted++;
+            }
+          words += pkt.size();
+        }
+        if (binaryRecords){
+          // payload of packet in pktMemory, record of binaryFlush()
+          record[0] = i + 1;
+          record[1] = j + 1;
+          len = 0;
+          if (pkt.size() != 1 || pkt[0][0] != '\n')
+            for (k = 0; k < (int)pkt.size(); k++)
+              len += hexaToBinaryCompression((uint8_t*)&pkt[k][0], &record[RECORD_HEAD + len], pkt[k].size());
+          len = recordEncode(record, len, frame);
+          pkt.assign(1, std::string((char*)frame, len));
+        }
+
+        for (k = 0; k < (int)pkt.size(); k++){
+          if (baud > 0){
+            // pacing of master UART, sleeping only for longer gaps
+            t = now();
+            if (txNext < t)
+              txNext = t;
+            else if (txNext - t > 0.001)
+              usleep((useconds_t)((txNext - t) * 1e6));
+            txNext += pkt[k].size() * BITS_PER_BYTE / baud;
+          }
+          output((const uint8_t*)pkt[k].data(), pkt[k].size(), isPty);
+        }
+      }
+    }
+    if (count > 0){
+      for (i = 0; i < slaves; i++)
+        if (slave[i].packet.numberOfPacket < count)
+          break;
+      if (i == slaves)
+        break;
+    }
+  }
+
+  printStatistic(now() - begin);
+  if (isPty){
+    tcdrain(fd);
+    unlink(link);
+    sleep(LINGER_SECONDS);
+  }else if (fd != STDOUT_FILENO)
+    close(fd);
+  return 0;
+}
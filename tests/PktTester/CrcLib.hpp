@@ -0,0 +1,180 @@
+/**
+ *****************************************************************************
+   @file     CrcLib.hpp
+   @brief    CRC of host tools as template parameterised by width, polynomial,
+             reflection, initial remainder and final XOR, tables of
+             slicing-by-8 are computed by compiler
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    polynomial is written without reflection like POLYNOMIAL of
+            Integrity/crc.h, reflection of input and of result is the same
+            (REFLECT_DATA and REFLECT_REMAINDER of crc.h)
+   @note    tables are constant and shared by all users of the same
+            parameters, update() is computing 8 bytes per step
+   @note    crcLibCcitt, crcLib16 and crcLib32 are the standards of crc.h,
+            crcLibUwb is CRC of uwbpacketclass (P_16 0xA001 is reflected
+            0x8005, it is the same as crcLib16)
+   @note    used by CrcSimd.c (slicing-by-8 level) and uwbpacketclass.cpp
+   @code
+        crc sum = crcLibCcitt::compute(packet, len);
+        // message in parts
+        uint16_t state = crcLibUwb::begin();
+        state = crcLibUwb::update(state, head, headLen);
+        state = crcLibUwb::update(state, payload, payloadLen);
+        sum = crcLibUwb::finish(state);
+   @endcode
+**/
+#ifndef _CRC_LIB_hpp
+#define _CRC_LIB_hpp
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief indices 0..N-1 as parameter pack (std::index_sequence of C++14) **/
+template <unsigned... I> struct crcLibIndices {};
+template <unsigned N, unsigned... I> struct crcLibMakeIndices : crcLibMakeIndices<N - 1, N - 1, I...> {};
+template <unsigned... I> struct crcLibMakeIndices<0, I...> { typedef crcLibIndices<I...> type; };
+
+/**
+   @brief  remainders of polynomial division computed by compiler, reflected
+           remainder is in reflected bit order (LSB is highest power)
+**/
+template <unsigned Width, uint32_t Poly, bool Reflect>
+struct crcLibMath
+{
+  static_assert(Width >= 8 && Width <= 32, "width of CRC must be 8 .. 32 bits");
+
+  static constexpr uint32_t mask = 0xFFFFFFFFUL >> (32 - Width);
+
+  /** @brief reverse order of lowest bits of value **/
+  static constexpr uint32_t reflect(uint32_t value, unsigned bits)
+  {
+    return bits == 0 ? 0 : ((value & 1) << (bits - 1)) | reflect(value >> 1, bits - 1);
+  }
+
+  /** @brief one bit of division **/
+  static constexpr uint32_t divideBit(uint32_t remainder)
+  {
+    return Reflect ? ((remainder & 1) ? (remainder >> 1) ^ reflect(Poly, Width) : remainder >> 1)
+                   : (((remainder >> (Width - 1)) & 1) ? ((remainder << 1) ^ Poly) & mask : (remainder << 1) & mask);
+  }
+
+  static constexpr uint32_t divideBits(uint32_t remainder, unsigned bits)
+  {
+    return bits == 0 ? remainder : divideBits(divideBit(remainder), bits - 1);
+  }
+
+  /** @brief remainder of byte (the same as crcTable of crc.c) **/
+  static constexpr uint32_t byteEntry(uint32_t byte)
+  {
+    return divideBits(Reflect ? byte : byte << (Width - 8), 8);
+  }
+
+  /** @brief remainder followed by zero byte **/
+  static constexpr uint32_t zeroByte(uint32_t remainder)
+  {
+    return Reflect ? (remainder >> 8) ^ byteEntry(remainder & 0xFF)
+                   : ((remainder << 8) & mask) ^ byteEntry((remainder >> (Width - 8)) & 0xFF);
+  }
+
+  /** @brief remainder of byte followed by k zero bytes **/
+  static constexpr uint32_t entry(unsigned k, uint32_t byte)
+  {
+    return k == 0 ? byteEntry(byte) : zeroByte(entry(k - 1, byte));
+  }
+};
+
+template <typename T, typename Math, typename Indices> struct crcLibTables;
+
+/** @brief slice[k][i] is remainder of byte i followed by k zero bytes **/
+template <typename T, typename Math, unsigned... I>
+struct crcLibTables<T, Math, crcLibIndices<I...> >
+{
+  static constexpr T slice[8][256] = {
+    {T(Math::entry(0, I))...}, {T(Math::entry(1, I))...}, {T(Math::entry(2, I))...}, {T(Math::entry(3, I))...},
+    {T(Math::entry(4, I))...}, {T(Math::entry(5, I))...}, {T(Math::entry(6, I))...}, {T(Math::entry(7, I))...}
+  };
+};
+
+template <typename T, typename Math, unsigned... I>
+constexpr T crcLibTables<T, Math, crcLibIndices<I...> >::slice[8][256];
+
+/**
+   @brief  CRC of Width bits, state between begin() and finish() is remainder
+           in order of bits of the standard (reflected if Reflect)
+**/
+template <typename T, unsigned Width, T Poly, bool Reflect, T Init, T XorOut>
+class crcLib
+{
+private:
+  typedef crcLibMath<Width, Poly, Reflect> Math;
+  typedef crcLibTables<T, Math, typename crcLibMakeIndices<256>::type> Tables;
+
+public:
+  typedef T value_type;
+
+  /** @brief table of k zero bytes behind byte, k = 0 is table of crcFast() **/
+  static const T* table(unsigned k) { return Tables::slice[k]; }
+
+  /** @brief state before first byte **/
+  static T begin(void) { return T(Reflect ? Math::reflect(Init, Width) : Init & Math::mask); }
+
+  /**
+     @brief  state after len bytes of data
+     @param  T state : begin() or result of previous update()
+     @param  const void* data : bytes of message
+     @param  size_t len : lenght of data
+  **/
+  static T update(T state, const void* data, size_t len)
+  {
+    const uint8_t* byte = (const uint8_t*)data;
+    const T (*slice)[256] = Tables::slice;
+    uint32_t remainder = state, first, second;
+
+    for ( ; len >= 8; len -= 8, byte += 8){
+      if (Reflect){
+        first = ((uint32_t)byte[0] | (uint32_t)byte[1] << 8 | (uint32_t)byte[2] << 16 | (uint32_t)byte[3] << 24) ^ remainder;
+        second = (uint32_t)byte[4] | (uint32_t)byte[5] << 8 | (uint32_t)byte[6] << 16 | (uint32_t)byte[7] << 24;
+        remainder = slice[7][first & 0xFF] ^ slice[6][(first >> 8) & 0xFF]
+                  ^ slice[5][(first >> 16) & 0xFF] ^ slice[4][first >> 24]
+                  ^ slice[3][second & 0xFF] ^ slice[2][(second >> 8) & 0xFF]
+                  ^ slice[1][(second >> 16) & 0xFF] ^ slice[0][second >> 24];
+      }
+      else{
+        first = ((uint32_t)byte[0] << 24 | (uint32_t)byte[1] << 16 | (uint32_t)byte[2] << 8 | (uint32_t)byte[3])
+                ^ (remainder << (32 - Width));
+        second = (uint32_t)byte[4] << 24 | (uint32_t)byte[5] << 16 | (uint32_t)byte[6] << 8 | (uint32_t)byte[7];
+        remainder = slice[7][first >> 24] ^ slice[6][(first >> 16) & 0xFF]
+                  ^ slice[5][(first >> 8) & 0xFF] ^ slice[4][first & 0xFF]
+                  ^ slice[3][second >> 24] ^ slice[2][(second >> 16) & 0xFF]
+                  ^ slice[1][(second >> 8) & 0xFF] ^ slice[0][second & 0xFF];
+      }
+    }
+    for ( ; len > 0; len--, byte++){
+      if (Reflect)
+        remainder = slice[0][(remainder ^ *byte) & 0xFF] ^ (remainder >> 8);
+      else
+        remainder = slice[0][((remainder >> (Width - 8)) ^ *byte) & 0xFF] ^ ((remainder << 8) & Math::mask);
+    }
+    return T(remainder);
+  }
+
+  /** @brief CRC of state after last byte **/
+  static T finish(T state) { return T((state ^ XorOut) & Math::mask); }
+
+  /** @brief CRC of whole message **/
+  static T compute(const void* data, size_t len) { return finish(update(begin(), data, len)); }
+};
+
+/** @brief CRC-CCITT of firmware (CRC_CCITT of crc.h) **/
+typedef crcLib<uint16_t, 16, 0x1021, false, 0xFFFF, 0x0000> crcLibCcitt;
+/** @brief CRC-16 (CRC16 of crc.h) **/
+typedef crcLib<uint16_t, 16, 0x8005, true, 0x0000, 0x0000> crcLib16;
+/** @brief CRC-32 (CRC32 of crc.h) **/
+typedef crcLib<uint32_t, 32, 0x04C11DB7, true, 0xFFFFFFFF, 0xFFFFFFFF> crcLib32;
+/** @brief CRC of uwbpacketclass, table of P_16 0xA001 with initial 0 **/
+typedef crcLib16 crcLibUwb;
+
+#endif
@@ -0,0 +1,230 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "CrcSimd.h"
+#include "CrcLib.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CRC_SIMD_X86 1
+#else
+#define CRC_SIMD_X86 0
+#endif
+
+#define CRC_WIDTH       (8 * sizeof(crc))
+#define CRC_REFLECTED   (REFLECT_DATA == TRUE)
+
+static int8_t crcLevel = -1;      // not selected yet
+
+static const char* const crcNames[] = {"table", "slice8", "pclmul"};
+
+/**
+   @fn     static uint32_t crcReflect(uint32_t value, uint8_t bits)
+   @brief  reverse order of lowest bits of value
+**/
+static uint32_t crcReflect(uint32_t value, uint8_t bits)
+{
+  uint32_t reflection = 0;
+  uint8_t i;
+
+  for (i = 0; i < bits; i++, value >>= 1)
+    reflection = (reflection << 1) | (value & 1);
+  return reflection;
+}
+
+/** @brief standard of crc.h, tables of slicing-by-8 are computed by compiler **/
+typedef crcLib<crc, CRC_WIDTH, POLYNOMIAL, CRC_REFLECTED, INITIAL_REMAINDER, FINAL_XOR_VALUE> crcStandard;
+
+#if CRC_SIMD_X86
+/** @brief constants of folding, x^D mod P reflected and shifted by 1, Barrett mu and P reflected **/
+static uint64_t crcFold4[2], crcFold1[2], crcFold64, crcBarrett[2];
+static uint8_t crcConstantsReady = 0;
+
+/**
+   @fn     static void crcSimdConstants(void)
+   @brief  constants of PCLMULQDQ kernel for POLYNOMIAL of WIDTH bits
+   @note   polynomial of WIDTH < 32 bits is multiplied by x^(32 - WIDTH), its
+           reflected remainder is in lowest WIDTH bits of 32 bit remainder
+**/
+static void crcSimdConstants(void)
+{
+  uint32_t poly = (uint32_t)POLYNOMIAL << (32 - CRC_WIDTH), power;
+  static const unsigned distance[5] = {4 * 128 + 32, 4 * 128 - 32, 128 + 32, 128 - 32, 64};
+  uint64_t k[5], remainder = 0, mu = 0;
+  unsigned i, n;
+
+  for (i = 0; i < 5; i++){
+    for (power = 1, n = 0; n < distance[i]; n++)      // x^distance mod P
+      power = (power & 0x80000000UL) ? (power << 1) ^ poly : power << 1;
+    k[i] = (uint64_t)crcReflect(power, 32) << 1;
+  }
+  for (n = 0; n <= 64; n++){                           // mu = x^64 / P
+    remainder = (remainder << 1) | (n == 0);
+    if (remainder >> 32){
+      remainder ^= ((uint64_t)1 << 32) | poly;
+      mu |= (uint64_t)1 << (64 - n);
+    }
+  }
+  crcFold4[0] = k[0];
+  crcFold4[1] = k[1];
+  crcFold1[0] = k[2];
+  crcFold1[1] = k[3];
+  crcFold64 = k[4];
+  crcBarrett[0] = ((uint64_t)crcReflect(poly, 32) << 1) | 1;
+  crcBarrett[1] = crcReflect((uint32_t)(mu >> 1), 32) | (mu & 1) << 32;
+  crcConstantsReady = 1;
+}
+
+/**
+   @fn     static __m128i crcLoad(const uint8_t* data)
+   @brief  16 bytes of data, bits of each byte are reflected for CRC_CCITT
+**/
+__attribute__((target("pclmul,sse4.1")))
+static __m128i crcLoad(const uint8_t* data)
+{
+  __m128i block = _mm_loadu_si128((const __m128i*)data);
+#if !CRC_REFLECTED
+  const __m128i reflectLow = _mm_setr_epi8(0x00, 0x80, 0x40, (char)0xC0, 0x20, (char)0xA0, 0x60, (char)0xE0,
+                                           0x10, (char)0x90, 0x50, (char)0xD0, 0x30, (char)0xB0, 0x70, (char)0xF0);
+  const __m128i reflectHigh = _mm_setr_epi8(0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+                                            0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF);
+  const __m128i mask = _mm_set1_epi8(0x0F);
+
+  block = _mm_or_si128(_mm_shuffle_epi8(reflectLow, _mm_and_si128(block, mask)),
+                       _mm_shuffle_epi8(reflectHigh, _mm_and_si128(_mm_srli_epi16(block, 4), mask)));
+#endif
+  return block;
+}
+
+/**
+   @fn     static __m128i crcFold(__m128i x, __m128i k, __m128i data)
+   @brief  x folded by 128 bits (constants k) and added to next data
+**/
+__attribute__((target("pclmul,sse4.1")))
+static __m128i crcFold(__m128i x, __m128i k, __m128i data)
+{
+  return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)), data);
+}
+
+/**
+   @fn     static uint32_t crcPclmul(uint32_t remainder, const uint8_t* data, size_t len)
+   @brief  reflected 32 bit remainder after len bytes (multiple of 64), 4 x 128
+           bits are folded by 64 bytes, then to 128 bits and Barrett reduction
+**/
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t crcPclmul(uint32_t remainder, const uint8_t* data, size_t len)
+{
+  __m128i x1, x2, x3, x4, t;
+  __m128i k4 = _mm_set_epi64x((long long)crcFold4[1], (long long)crcFold4[0]);
+  __m128i k1 = _mm_set_epi64x((long long)crcFold1[1], (long long)crcFold1[0]);
+  __m128i k64 = _mm_set_epi64x(0, (long long)crcFold64);
+  __m128i barrett = _mm_set_epi64x((long long)crcBarrett[1], (long long)crcBarrett[0]);
+  __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+
+  x1 = _mm_xor_si128(crcLoad(data), _mm_cvtsi32_si128((int)remainder));
+  x2 = crcLoad(data + 16);
+  x3 = crcLoad(data + 32);
+  x4 = crcLoad(data + 48);
+  for (data += 64, len -= 64; len >= 64; data += 64, len -= 64){
+    x1 = crcFold(x1, k4, crcLoad(data));
+    x2 = crcFold(x2, k4, crcLoad(data + 16));
+    x3 = crcFold(x3, k4, crcLoad(data + 32));
+    x4 = crcFold(x4, k4, crcLoad(data + 48));
+  }
+  x1 = crcFold(x1, k1, x2);
+  x1 = crcFold(x1, k1, x3);
+  x1 = crcFold(x1, k1, x4);
+
+  // 128 -> 64 bits, 96 -> 64 bits
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k1, 0x10), _mm_srli_si128(x1, 8));
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k64, 0x00), _mm_srli_si128(x1, 4));
+  // Barrett reduction, remainder is in bits 32..63
+  t = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), barrett, 0x10);
+  t = _mm_clmulepi64_si128(_mm_and_si128(t, mask32), barrett, 0x00);
+  return (uint32_t)_mm_extract_epi32(_mm_xor_si128(t, x1), 1);
+}
+#endif
+
+/**
+   @fn     static uint8_t crcSimdSupported(void)
+   @brief  best level supported by CPU
+**/
+static uint8_t crcSimdSupported(void)
+{
+#if CRC_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1"))
+    return CRC_SIMD_PCLMUL;
+#endif
+  return CRC_SIMD_SLICE8;
+}
+
+/**
+   @fn     uint8_t crcSimdLevel(int8_t level)
+   @brief  select level of kernels
+   @param  int8_t level : crcSimdLevels, -1 only returns actual level
+   @return uint8_t - selected level, limited by CPU
+**/
+uint8_t crcSimdLevel(int8_t level)
+{
+  uint8_t supported = crcSimdSupported();
+  const char* env;
+  int8_t i;
+
+#if CRC_SIMD_X86
+  if (!crcConstantsReady)
+    crcSimdConstants();
+#endif
+  if (level < 0){
+    if (crcLevel >= 0)
+      return crcLevel;
+    level = supported;
+    if ((env = getenv("CRC_SIMD")) != NULL)
+      for (i = CRC_SIMD_TABLE; i <= CRC_SIMD_PCLMUL; i++)
+        if (strcmp(env, crcNames[i]) == 0)
+          level = i;
+  }
+  crcLevel = (level > supported) ? supported : level;
+  return crcLevel;
+}
+
+/**
+   @fn     const char* crcSimdName(uint8_t level)
+   @brief  name of level "table", "slice8" or "pclmul"
+**/
+const char* crcSimdName(uint8_t level)
+{
+  return (level <= CRC_SIMD_PCLMUL) ? crcNames[level] : "unknown";
+}
+
+/**
+   @fn     crc crcSimd(unsigned char const message[], size_t nBytes)
+   @brief  CRC of message by selected level
+   @return crc - the same as crcFast(message, nBytes)
+**/
+crc crcSimd(unsigned char const message[], size_t nBytes)
+{
+  crc remainder = crcStandard::begin();
+#if CRC_SIMD_X86
+  size_t folded;
+#endif
+
+  switch (crcLevel >= 0 ? crcLevel : crcSimdLevel(-1)){
+#if CRC_SIMD_X86
+    case CRC_SIMD_PCLMUL:
+      folded = nBytes & ~(size_t)63;
+      if (folded != 0){
+#if CRC_REFLECTED
+        remainder = crcPclmul(remainder, message, folded);
+#else
+        remainder = crcReflect(crcPclmul(crcReflect(remainder, CRC_WIDTH), message, folded), CRC_WIDTH);
+#endif
+      }
+      return crcStandard::finish(crcStandard::update(remainder, message + folded, nBytes - folded));
+#endif
+    case CRC_SIMD_SLICE8:
+      return crcStandard::compute(message, nBytes);
+    default:
+      return crcFast(message, (int)nBytes);
+  }
+}
@@ -0,0 +1,72 @@
+/**
+ *****************************************************************************
+   @file     CrcSimd.h
+   @brief    slicing-by-8 and PCLMULQDQ kernels of CRC of Integrity/crc.c for
+             host tools with runtime selection by CPU
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    used by PRNG.c (PRNGnew, PRNGcheck) if CRC_SIMD is 1 (PktTester and
+            MicroBench Makefile), firmware and FirmwareSim are using crc.c,
+            CrcSimd.c is compiled as C++ (g++) like other sources of PktTester
+   @note    result is the same as of crcSlow() and crcFast() for standard
+            selected in crc.h (CRC_CCITT, CRC16, CRC32), tables of slicing-by-8
+            are computed by compiler (CrcLib.hpp), constants of PCLMULQDQ are
+            derived from POLYNOMIAL at first call
+   @note    PCLMULQDQ kernel is folding 64 bytes per step, shorter messages and
+            rest are computed by slicing-by-8, standards without reflection
+            (CRC_CCITT) are folded on bit reflected bytes
+   @note    level is selected at first call by CPU (__builtin_cpu_supports),
+            environment variable CRC_SIMD=table|slice8|pclmul is limiting it
+   @code
+        if (crcSimd(image, len) != 0)
+          printf("image is broken");
+   @endcode
+**/
+#ifndef _CRC_SIMD_h
+#define _CRC_SIMD_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../../Integrity/crc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief level of kernels **/
+enum crcSimdLevels {
+  CRC_SIMD_TABLE = 0,         /*!< @brief crcFast() of crc.c, byte by byte */
+  CRC_SIMD_SLICE8,            /*!< @brief 8 bytes by 8 tables */
+  CRC_SIMD_PCLMUL             /*!< @brief carry-less multiplication, SSE4.1 */
+};
+
+/**
+   @fn     crc crcSimd(unsigned char const message[], size_t nBytes)
+   @brief  CRC of message by selected level
+   @param  unsigned char const message[] : data
+   @param  size_t nBytes : lenght of data
+   @return crc - the same as crcFast(message, nBytes)
+**/
+crc crcSimd(unsigned char const message[], size_t nBytes);
+
+/**
+   @fn     uint8_t crcSimdLevel(int8_t level)
+   @brief  select level of kernels
+   @param  int8_t level : crcSimdLevels, -1 only returns actual level
+   @return uint8_t - selected level, limited by CPU
+**/
+uint8_t crcSimdLevel(int8_t level);
+
+/**
+   @fn     const char* crcSimdName(uint8_t level)
+   @brief  name of level "table", "slice8" or "pclmul"
+**/
+const char* crcSimdName(uint8_t level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
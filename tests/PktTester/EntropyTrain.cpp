@@ -0,0 +1,367 @@
+/**
+ *****************************************************************************
+   @file     EntropyTrain.cpp
+   @brief    offline training of static Huffman tables of Entropy.c from
+             captured radio frames or UART logs, output is EntropyTables.c
+             compiled into firmware of master and slaves
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    input file with "capture tick R rssi len hexadata#" lines (CAPT$
+            dump of master, RadioCapture.h) gives payloads of received data
+            packets (behind head), already coded packets are skipped
+   @note    other input file is UART stream of slave ('$' terminated words),
+            words are compressed by hexaToBinaryCompression() in UART buffers
+            like storePkt() of slave, with -d are UWB frames coded by
+            uwbEncode() and records packed into packets like packWords()
+   @note    one table per argument name=file[,file], up to ENTROPY_MAX_TABLES,
+            ID of table is order of argument
+   @code
+        ./EntropyTrain -o ../../src/include/EntropyTables.c uwb=capt.txt
+        ./EntropyTrain -d -o EntropyTables.c uwb=uwb1.txt,uwb2.txt
+   @endcode
+   @see     read_me.txt
+**/
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "settings.h"
+#include "Compression.h"
+#include "UwbCodec.h"
+#include "Entropy.h"
+#include "PRNG.h"
+
+typedef std::vector<uint8_t> Buffer;
+
+/** @brief table in training **/
+struct Table {
+  std::string name;
+  std::vector<Buffer> payloads;
+  uint64_t freq[256];
+  uint8_t  length[256];
+  uint16_t code[256];
+  uint16_t count[ENTROPY_MAX_BITS + 1];
+  uint8_t  symbol[256];
+};
+
+static bool uwbDelta = false;
+
+static void usage(const char* name)
+{
+  printf("usage: %s [-d] [-o file] name=file[,file] ...\n"
+         "  name=files  one table trained from files, ID of table is order (1..%d)\n"
+         "              file with \"capture\" lines : received data packets (CAPT$ of master)\n"
+         "              other file : UART stream of slave, '$' terminated words\n"
+         "  -d          UWB frames of UART stream of following tables coded by uwbEncode()\n"
+         "              (UWB_COMPRESSION=1)\n"
+         "  -o <file>   output (default EntropyTables.c)\n"
+         "  -h          help\n", name, ENTROPY_MAX_TABLES);
+}
+
+static bool readFile(const char* file, std::string& text)
+{
+  char block[4096];
+  size_t n;
+  FILE* f = fopen(file, "rb");
+
+  if (f == NULL){
+    perror(file);
+    return false;
+  }
+  while ((n = fread(block, 1, sizeof(block), f)) > 0)
+    text.append(block, n);
+  fclose(f);
+  return true;
+}
+
+/**
+   @brief  payloads of received data packets of "capture" lines
+**/
+static size_t capturePayloads(const std::string& text, std::vector<Buffer>& payloads)
+{
+  size_t pos = 0, found = 0;
+  unsigned long tick;
+  unsigned len, byte, i;
+  char dir, hexa[2 * 256 + 2];
+  int rssi;
+
+  while ((pos = text.find("capture ", pos)) != std::string::npos){
+    pos += 8;
+    if (sscanf(text.c_str() + pos, "%lu %c %d %u %514[0-9A-F]", &tick, &dir, &rssi, &len, hexa) != 5)
+      continue;           // "capture end"
+    if (dir != 'R' || len <= HEAD_LENGHT || strlen(hexa) != 2 * len)
+      continue;
+    Buffer frame(len);
+    for (i = 0; i < len; i++){
+      sscanf(hexa + 2 * i, "%2X", &byte);
+      frame[i] = (uint8_t)byte;
+    }
+    // data packet of slave, not coded yet
+    if ((frame[0] & ENTROPY_HEAD_MASK) || frame[0] <= '0' || frame[0] > '0' + 10
+        || frame[1] <= '0' || frame[1] > '0' + NUM_OF_PACKETS_IN_MEMORY)
+      continue;
+    payloads.push_back(Buffer(frame.begin() + HEAD_LENGHT, frame.end()));
+    found++;
+  }
+  return found;
+}
+
+/**
+   @brief  payloads of UART stream compressed like slave
+**/
+static size_t uartPayloads(const std::string& text, std::vector<Buffer>& payloads)
+{
+  uint8_t binary[UART_BUFFER_DEEPTH * 2], record[UART_BUFFER_DEEPTH];
+  std::string uart;
+  Buffer packet;
+  size_t found = 0, pos, start = 0;
+  uint16_t len;
+
+  if (uwbDelta)
+    uwbReset();
+  for (pos = 0; pos < text.size(); pos++){
+    if (text[pos] == '\r' || text[pos] == '\n')
+      continue;
+    uart += text[pos];
+    if (text[pos] != STRING_TERMINATOR)
+      continue;
+
+    if (uwbDelta && uart.size() - start > UART_BUFFER_DEEPTH)
+      start = uart.size();    // longer than UART buffer of slave
+    else if (uwbDelta){
+      // one word, records packed into packet like packWords() of slave
+      len = uwbEncode((uint8_t*)&uart[start], uart.size() - start - 1, record);
+      if (len == 0)
+        len = hexaToBinaryCompression((uint8_t*)&uart[start], record, uart.size() - start);
+      start = uart.size();
+      if (packet.size() + len > PACKET_MEMORY_DEPTH - HEAD_LENGHT){
+        payloads.push_back(packet);
+        packet.clear();
+        found++;
+      }
+      packet.insert(packet.end(), record, record + len);
+    }
+    else if (uart.size() >= UART_BUFFER_DEEPTH - (HEAD_LENGHT*2 + MAX_LEN_OF_RX_PKT)){
+      // UART buffer closed behind word like UART_Int_Handler() of slave
+      len = hexaToBinaryCompression((uint8_t*)uart.data(), binary, uart.size());
+      if (len <= PACKET_MEMORY_DEPTH - HEAD_LENGHT){
+        payloads.push_back(Buffer(binary, binary + len));
+        found++;
+      }
+      uart.clear();
+    }
+  }
+  if (!packet.empty()){
+    payloads.push_back(packet);
+    found++;
+  }
+  return found;
+}
+
+/**
+   @brief  Huffman code lengths of frequencies, longest ENTROPY_MAX_BITS,
+           frequencies are halved until tree is not deeper
+**/
+static void buildLengths(Table& t)
+{
+  uint64_t freq[256];
+  int i, maxLen;
+
+  for (i = 0; i < 256; i++)
+    freq[i] = t.freq[i] + 1;      // any byte must have code
+  do{
+    typedef std::pair<uint64_t, int> Node;   // weight, index of node
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node> > queue;
+    std::vector<int> parent(2 * 256, -1);
+    int next = 256;
+
+    for (i = 0; i < 256; i++)
+      queue.push(Node(freq[i], i));
+    while (queue.size() > 1){
+      Node a = queue.top(); queue.pop();
+      Node b = queue.top(); queue.pop();
+      parent[a.second] = parent[b.second] = next;
+      queue.push(Node(a.first + b.first, next++));
+    }
+    maxLen = 0;
+    for (i = 0; i < 256; i++){
+      int depth = 0;
+      for (int n = i; parent[n] >= 0; n = parent[n])
+        depth++;
+      t.length[i] = (uint8_t)depth;
+      maxLen = std::max(maxLen, depth);
+    }
+    for (i = 0; i < 256; i++)
+      freq[i] = freq[i] / 2 + 1;
+  }while (maxLen > ENTROPY_MAX_BITS);
+}
+
+/**
+   @brief  canonical codes, bytes ordered by length and value
+**/
+static void buildCodes(Table& t)
+{
+  uint16_t code = 0;
+  int l, i, n = 0;
+
+  memset(t.count, 0, sizeof(t.count));
+  for (l = 1; l <= ENTROPY_MAX_BITS; l++){
+    for (i = 0; i < 256; i++)
+      if (t.length[i] == l){
+        t.symbol[n++] = (uint8_t)i;
+        t.code[i] = code++;
+        t.count[l]++;
+      }
+    code <<= 1;
+  }
+}
+
+/**
+   @brief  bytes of payloads after coding like entropyEncode() with one table
+**/
+static uint64_t codedSize(const Table& t, const std::vector<Buffer>& payloads)
+{
+  uint64_t size = 0, bits;
+
+  for (const Buffer& p : payloads){
+    bits = 0;
+    for (uint8_t b : p)
+      bits += t.length[b];
+    size += std::min<uint64_t>(p.size(), 1 + (bits + 7) / 8);
+  }
+  return size;
+}
+
+static uint64_t payloadSize(const std::vector<Buffer>& payloads)
+{
+  uint64_t size = 0;
+  for (const Buffer& p : payloads)
+    size += p.size();
+  return size;
+}
+
+static void writeArray(FILE* f, const char* type, const void* data, int n, const char* comment)
+{
+  int i;
+
+  fprintf(f, "    { /* %s */\n     ", comment);
+  for (i = 0; i < n; i++){
+    if (strcmp(type, "uint16_t") == 0)
+      fprintf(f, " 0x%03X", ((const uint16_t*)data)[i]);
+    else
+      fprintf(f, " %3u", ((const uint8_t*)data)[i]);
+    if (i + 1 < n)
+      fprintf(f, ",%s", (i % 16 == 15) ? "\n     " : "");
+  }
+  fprintf(f, "\n    }");
+}
+
+static bool writeTables(const char* file, const std::vector<Table>& tables)
+{
+  FILE* f = fopen(file, "w");
+
+  if (f == NULL){
+    perror(file);
+    return false;
+  }
+  fprintf(f, "/**\n"
+             " *****************************************************************************\n"
+             "   @file     EntropyTables.c\n"
+             "   @brief    static Huffman tables of Entropy.c\n\n"
+             "   @note    generated by tests/PktTester/EntropyTrain, do not edit\n");
+  for (size_t i = 0; i < tables.size(); i++)
+    fprintf(f, "   @note    table %u \"%s\" : %u payloads, %llu B -> %llu B\n", (unsigned)(i + 1),
+            tables[i].name.c_str(), (unsigned)tables[i].payloads.size(),
+            (unsigned long long)payloadSize(tables[i].payloads),
+            (unsigned long long)codedSize(tables[i], tables[i].payloads));
+  fprintf(f, "**/\n#include \"Entropy.h\"\n\n");
+  fprintf(f, "const uint8_t entropyTableCount = %u;\n\n", (unsigned)tables.size());
+  fprintf(f, "const struct entropyTable entropyTables[] = {\n");
+  for (size_t i = 0; i < tables.size(); i++){
+    const Table& t = tables[i];
+    fprintf(f, "  {\n    \"%s\",\n", t.name.c_str());
+    writeArray(f, "uint16_t", t.code, 256, "code");
+    fprintf(f, ",\n");
+    writeArray(f, "uint8_t", t.length, 256, "length");
+    fprintf(f, ",\n");
+    writeArray(f, "uint16_t", t.count, ENTROPY_MAX_BITS + 1, "count");
+    fprintf(f, ",\n");
+    writeArray(f, "uint8_t", t.symbol, 256, "symbol");
+    fprintf(f, "\n  }%s\n", (i + 1 < tables.size()) ? "," : "");
+  }
+  fprintf(f, "};\n");
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  std::vector<Table> tables;
+  const char* output = "EntropyTables.c";
+  int i;
+
+  for (i = 1; i < argc; i++){
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      output = argv[++i];
+    else if (strcmp(argv[i], "-d") == 0)
+      uwbDelta = true;
+    else if (argv[i][0] != '-' && strchr(argv[i], '=') != NULL){
+      Table t;
+      std::string arg(argv[i]), files;
+      size_t pos;
+
+      t.name = arg.substr(0, arg.find('='));
+      files = arg.substr(arg.find('=') + 1) + ",";
+      while ((pos = files.find(',')) != std::string::npos){
+        std::string file = files.substr(0, pos), text;
+        files.erase(0, pos + 1);
+        if (file.empty())
+          continue;
+        if (!readFile(file.c_str(), text))
+          return 1;
+        if (text.find("capture ") != std::string::npos)
+          printf("%s : %u captured packets\n", file.c_str(), (unsigned)capturePayloads(text, t.payloads));
+        else
+          printf("%s : %u packets of UART stream\n", file.c_str(), (unsigned)uartPayloads(text, t.payloads));
+      }
+      tables.push_back(t);
+    }
+    else{
+      usage(argv[0]);
+      return strcmp(argv[i], "-h") ? 2 : 0;
+    }
+  }
+  if (tables.empty() || tables.size() > ENTROPY_MAX_TABLES){
+    usage(argv[0]);
+    return 2;
+  }
+
+  for (Table& t : tables){
+    memset(t.freq, 0, sizeof(t.freq));
+    for (const Buffer& p : t.payloads)
+      for (uint8_t b : p)
+        t.freq[b]++;
+    buildLengths(t);
+    buildCodes(t);
+  }
+
+  // each table on training data of each table
+  printf("%-12s", "data\\table");
+  for (const Table& t : tables)
+    printf(" %12s", t.name.c_str());
+  printf("\n");
+  for (const Table& d : tables){
+    uint64_t size = payloadSize(d.payloads);
+    printf("%-12s", d.name.c_str());
+    for (const Table& t : tables)
+      printf(" %11.1f%%", size ? 100.0 * codedSize(t, d.payloads) / size : 0.0);
+    printf("   of %llu B\n", (unsigned long long)size);
+  }
+  return writeTables(output, tables) ? 0 : 1;
+}
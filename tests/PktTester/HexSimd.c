@@ -0,0 +1,232 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HexSimd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HEXA_SIMD_X86 1
+#else
+#define HEXA_SIMD_X86 0
+#endif
+
+static int8_t hexaLevel = -1;     // not selected yet
+
+static const char* const hexaNames[] = {"scalar", "sse2", "avx2"};
+
+#if HEXA_SIMD_X86
+/**
+   @fn     static __m128i nibbleToHexa128(__m128i nibble)
+   @brief  nibble 0..15 to '0'..'9', 'A'..'F' like scalar loop of binToHexa()
+**/
+__attribute__((target("sse2")))
+static __m128i nibbleToHexa128(__m128i nibble)
+{
+  __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(nibble, _mm_set1_epi8(9)), _mm_set1_epi8(7));
+  return _mm_add_epi8(_mm_add_epi8(nibble, _mm_set1_epi8('0')), letter);
+}
+
+/**
+   @fn     static __m128i hexaToNibble128(__m128i ch)
+   @brief  char to value like scalar loop of hexaToBin(), ch - '0' and - 7 if > 9
+**/
+__attribute__((target("sse2")))
+static __m128i hexaToNibble128(__m128i ch)
+{
+  __m128i value = _mm_sub_epi8(ch, _mm_set1_epi8('0'));
+  // unsigned value > 9 if saturated subtraction is not zero
+  __m128i letter = _mm_andnot_si128(_mm_cmpeq_epi8(_mm_subs_epu8(value, _mm_set1_epi8(9)), _mm_setzero_si128()),
+                                    _mm_set1_epi8(7));
+  return _mm_sub_epi8(value, letter);
+}
+
+/**
+   @fn     static __m128i pairsToBytes128(__m128i value)
+   @brief  (first << 4) | second of each pair of values, result in low byte of 16 bit lanes
+**/
+__attribute__((target("sse2")))
+static __m128i pairsToBytes128(__m128i value)
+{
+  __m128i pair = _mm_or_si128(_mm_slli_epi16(value, 4), _mm_srli_epi16(value, 8));
+  return _mm_and_si128(pair, _mm_set1_epi16(0x00FF));
+}
+
+__attribute__((target("sse2")))
+static uint16_t binToHexaSse2(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+{
+  uint16_t i;
+  __m128i bin, high, low, mask = _mm_set1_epi8(0x0F);
+
+  for (i = 0; i + 16 <= binaryLen; i += 16){
+    bin = _mm_loadu_si128((const __m128i*)(from + i));
+    high = nibbleToHexa128(_mm_and_si128(_mm_srli_epi16(bin, 4), mask));
+    low = nibbleToHexa128(_mm_and_si128(bin, mask));
+    _mm_storeu_si128((__m128i*)(to + 2 * i), _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128((__m128i*)(to + 2 * i + 16), _mm_unpackhi_epi8(high, low));
+  }
+  return i;
+}
+
+__attribute__((target("sse2")))
+static uint16_t hexaToBinSse2(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+{
+  uint16_t i;
+  __m128i first, second;
+
+  for (i = 0; i + 16 <= binaryLen; i += 16){
+    first = pairsToBytes128(hexaToNibble128(_mm_loadu_si128((const __m128i*)(from + 2 * i))));
+    second = pairsToBytes128(hexaToNibble128(_mm_loadu_si128((const __m128i*)(from + 2 * i + 16))));
+    _mm_storeu_si128((__m128i*)(to + i), _mm_packus_epi16(first, second));
+  }
+  return i;
+}
+
+__attribute__((target("avx2")))
+static __m256i nibbleToHexa256(__m256i nibble)
+{
+  __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(nibble, _mm256_set1_epi8(9)), _mm256_set1_epi8(7));
+  return _mm256_add_epi8(_mm256_add_epi8(nibble, _mm256_set1_epi8('0')), letter);
+}
+
+__attribute__((target("avx2")))
+static __m256i hexaToNibble256(__m256i ch)
+{
+  __m256i value = _mm256_sub_epi8(ch, _mm256_set1_epi8('0'));
+  __m256i letter = _mm256_andnot_si256(_mm256_cmpeq_epi8(_mm256_subs_epu8(value, _mm256_set1_epi8(9)),
+                                                         _mm256_setzero_si256()),
+                                       _mm256_set1_epi8(7));
+  return _mm256_sub_epi8(value, letter);
+}
+
+__attribute__((target("avx2")))
+static __m256i pairsToBytes256(__m256i value)
+{
+  __m256i pair = _mm256_or_si256(_mm256_slli_epi16(value, 4), _mm256_srli_epi16(value, 8));
+  return _mm256_and_si256(pair, _mm256_set1_epi16(0x00FF));
+}
+
+__attribute__((target("avx2")))
+static uint16_t binToHexaAvx2(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+{
+  uint16_t i;
+  __m256i bin, high, low, first, second, mask = _mm256_set1_epi8(0x0F);
+
+  for (i = 0; i + 32 <= binaryLen; i += 32){
+    bin = _mm256_loadu_si256((const __m256i*)(from + i));
+    high = nibbleToHexa256(_mm256_and_si256(_mm256_srli_epi16(bin, 4), mask));
+    low = nibbleToHexa256(_mm256_and_si256(bin, mask));
+    // unpack is inside of 128 bit lanes, lanes are reordered by permute
+    first = _mm256_unpacklo_epi8(high, low);
+    second = _mm256_unpackhi_epi8(high, low);
+    _mm256_storeu_si256((__m256i*)(to + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256((__m256i*)(to + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+  }
+  _mm256_zeroupper();     // no AVX-SSE transition penalty in SSE2 kernel
+  return i + binToHexaSse2(from + i, to + 2 * i, binaryLen - i);    // block of 16 bytes
+}
+
+__attribute__((target("avx2")))
+static uint16_t hexaToBinAvx2(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+{
+  uint16_t i;
+  __m256i first, second;
+
+  for (i = 0; i + 32 <= binaryLen; i += 32){
+    first = pairsToBytes256(hexaToNibble256(_mm256_loadu_si256((const __m256i*)(from + 2 * i))));
+    second = pairsToBytes256(hexaToNibble256(_mm256_loadu_si256((const __m256i*)(from + 2 * i + 32))));
+    // pack is inside of 128 bit lanes, 64 bit blocks are reordered
+    _mm256_storeu_si256((__m256i*)(to + i),
+                        _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8));
+  }
+  _mm256_zeroupper();     // no AVX-SSE transition penalty in SSE2 kernel
+  return i + hexaToBinSse2(from + 2 * i, to + i, binaryLen - i);    // block of 16 bytes
+}
+#endif
+
+/**
+   @fn     static uint8_t hexaSimdSupported(void)
+   @brief  best level supported by CPU
+**/
+static uint8_t hexaSimdSupported(void)
+{
+#if HEXA_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return HEXA_SIMD_AVX2;
+  if (__builtin_cpu_supports("sse2"))
+    return HEXA_SIMD_SSE2;
+#endif
+  return HEXA_SIMD_SCALAR;
+}
+
+/**
+   @fn     uint8_t hexaSimdLevel(int8_t level)
+   @brief  select level of kernels
+   @param  int8_t level : hexaSimdLevels, -1 only returns actual level
+   @return uint8_t - selected level, limited by CPU
+**/
+uint8_t hexaSimdLevel(int8_t level)
+{
+  uint8_t supported = hexaSimdSupported();
+  const char* env;
+  int8_t i;
+
+  if (level < 0){
+    if (hexaLevel >= 0)
+      return hexaLevel;
+    level = supported;
+    if ((env = getenv("HEXA_SIMD")) != NULL)
+      for (i = HEXA_SIMD_SCALAR; i <= HEXA_SIMD_AVX2; i++)
+        if (strcmp(env, hexaNames[i]) == 0)
+          level = i;
+  }
+  hexaLevel = (level > supported) ? supported : level;
+  return hexaLevel;
+}
+
+/**
+   @fn     const char* hexaSimdName(uint8_t level)
+   @brief  name of level "scalar", "sse2" or "avx2"
+**/
+const char* hexaSimdName(uint8_t level)
+{
+  return (level <= HEXA_SIMD_AVX2) ? hexaNames[level] : "unknown";
+}
+
+/**
+   @fn     uint16_t binToHexaSimd(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+   @brief  convert whole blocks of binary data to hexadecimal ASCII chars
+   @return uint16_t - number of converted binary bytes
+**/
+uint16_t binToHexaSimd(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+{
+  switch (hexaLevel >= 0 ? hexaLevel : hexaSimdLevel(-1)){
+#if HEXA_SIMD_X86
+    case HEXA_SIMD_AVX2:
+      return binToHexaAvx2(from, to, binaryLen);
+    case HEXA_SIMD_SSE2:
+      return binToHexaSse2(from, to, binaryLen);
+#endif
+    default:
+      return 0;
+  }
+}
+
+/**
+   @fn     uint16_t hexaToBinSimd(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+   @brief  convert whole blocks of hexadecimal ASCII chars to binary data
+   @return uint16_t - number of converted binary bytes
+**/
+uint16_t hexaToBinSimd(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+{
+  switch (hexaLevel >= 0 ? hexaLevel : hexaSimdLevel(-1)){
+#if HEXA_SIMD_X86
+    case HEXA_SIMD_AVX2:
+      return hexaToBinAvx2(from, to, binaryLen);
+    case HEXA_SIMD_SSE2:
+      return hexaToBinSse2(from, to, binaryLen);
+#endif
+    default:
+      return 0;
+  }
+}
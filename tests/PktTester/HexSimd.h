@@ -0,0 +1,76 @@
+/**
+ *****************************************************************************
+   @file     HexSimd.h
+   @brief    SSE2 / AVX2 kernels of binToHexa() and hexaToBin() for host tools
+             with runtime selection by CPU
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    used by PRNG.c if HEXA_SIMD is 1 (PktTester and MicroBench Makefile),
+            firmware and FirmwareSim are using scalar loops of PRNG.c
+   @note    kernels are converting whole blocks (16 / 32 bytes of binary data),
+            rest is converted by scalar loop of PRNG.c, output is the same as
+            of scalar loop for any input (also not hexadecimal chars)
+   @note    level is selected at first call by CPU (__builtin_cpu_supports),
+            environment variable HEXA_SIMD=scalar|sse2|avx2 is limiting it
+   @code
+        converted = hexaToBinSimd(from, to, binaryLen);
+        // scalar loop from converted to binaryLen
+   @endcode
+**/
+#ifndef _HEX_SIMD_h
+#define _HEX_SIMD_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief level of kernels **/
+enum hexaSimdLevels {
+  HEXA_SIMD_SCALAR = 0,
+  HEXA_SIMD_SSE2,
+  HEXA_SIMD_AVX2
+};
+
+/**
+   @fn     uint16_t binToHexaSimd(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+   @brief  convert whole blocks of binary data to hexadecimal ASCII chars
+   @param  uint8_t* from : pointer at binary data
+   @param  uint8_t* to : pointer at destination of 2 * binaryLen chars (not overlapping from)
+   @param  uint16_t binaryLen : lenght of binary data
+   @return uint16_t - number of converted binary bytes
+**/
+uint16_t binToHexaSimd(uint8_t* from, uint8_t* to, uint16_t binaryLen);
+
+/**
+   @fn     uint16_t hexaToBinSimd(uint8_t* from, uint8_t* to, uint16_t binaryLen)
+   @brief  convert whole blocks of hexadecimal ASCII chars to binary data
+   @param  uint8_t* from : pointer at 2 * binaryLen chars
+   @param  uint8_t* to : pointer at destination, to <= from is allowed (in place)
+   @param  uint16_t binaryLen : lenght of binary data
+   @return uint16_t - number of converted binary bytes
+**/
+uint16_t hexaToBinSimd(uint8_t* from, uint8_t* to, uint16_t binaryLen);
+
+/**
+   @fn     uint8_t hexaSimdLevel(int8_t level)
+   @brief  select level of kernels
+   @param  int8_t level : hexaSimdLevels, -1 only returns actual level
+   @return uint8_t - selected level, limited by CPU
+**/
+uint8_t hexaSimdLevel(int8_t level);
+
+/**
+   @fn     const char* hexaSimdName(uint8_t level)
+   @brief  name of level "scalar", "sse2" or "avx2"
+**/
+const char* hexaSimdName(uint8_t level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
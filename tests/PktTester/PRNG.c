@@ -3,6 +3,19 @@
 #include <stdio.h>
 #include "PRNG.h"
 #include "../../Integrity/crc.h"
+#if HEXA_SIMD
+#include "HexSimd.h"
+#endif
+#if CRC_SIMD
+#include "CrcSimd.h"
+/** @brief CRC of packets by slicing-by-8 or PCLMULQDQ kernel of CrcSimd.c **/
+#define packetCrc(data, len)    crcSimd(data, len)
+#else
+#define packetCrc(data, len)    crcFast(data, len)
+#endif
+
+/** @brief first STAMP_LENGHT random words are timestamp and are not checked **/
+uint8_t PRNGstamped = 0;
 
 /**
  * @fn    static void PRNGsrand(unsigned int seed,struct PRNGslave * slave)
@@ -40,12 +53,13 @@ static int16_t PRNGrand(struct PRNGslave * slave) // RAND_MAX assumed to be 3276
 **/
 void PRNGinit(struct PRNGslave * slave, uint8_t numberOfSlav )
 {
-    crcInit();
     PRNGsrand(SEED,slave);
     slave->packet.slave_id = numberOfSlav;
     slave->packet.numberOfPacket = 0;
     slave->numberOfMissingPackets = 0;
     slave->numberOfReceivedPackets = 0;
+    slave->receivedBytes = 0;
+    slave->packetNumberDiff = 0;
 }
 
 /**
@@ -79,7 +93,35 @@ void PRNGnew(struct PRNGslave * slave)
         slave->packet.random[i] = PRNGrand(slave);
     }
     /*crc is compuded from packet without crc part and packet terminator '$' */
-    slave->packet.crc = crcFast((unsigned char*)&slave->packet, sizeof(slave->packet)-2);
+    slave->packet.crc = packetCrc((unsigned char*)&slave->packet, sizeof(slave->packet)-2);
+}
+
+/**
+   @fn     void PRNGstamp(struct PRNGslave * slave, uint64_t stamp)
+   @brief  PRNGstamp is replacing first random words of generated packet by
+           timestamp, crc is computed again
+   @param  struct PRNGslave* slave : pointer slave structure with generated packet
+   @param  uint64_t stamp : timestamp of sender, e.g. microseconds of monotonic clock
+   @note   state of PRNG is not changed, receiver is checking packet with
+           PRNGstamped set to 1
+**/
+void PRNGstamp(struct PRNGslave * slave, uint64_t stamp)
+{
+    memcpy(slave->packet.random, &stamp, sizeof(stamp));
+    slave->packet.crc = packetCrc((unsigned char*)&slave->packet, sizeof(slave->packet)-2);
+}
+
+/**
+   @fn     uint64_t PRNGgetStamp(struct PRNGrandomPacket * receivedPkt)
+   @brief  PRNGgetStamp is returning timestamp stored by PRNGstamp
+   @param  struct PRNGrandomPacket * receivedPkt : pointer at received packet
+   @return timestamp of sender
+**/
+uint64_t PRNGgetStamp(struct PRNGrandomPacket * receivedPkt)
+{
+    uint64_t stamp;
+    memcpy(&stamp, receivedPkt->random, sizeof(stamp));
+    return stamp;
 }
 
 /**
@@ -91,7 +133,7 @@ void PRNGnew(struct PRNGslave * slave)
 **/
 static int8_t PRNGcheckRandom(struct PRNGslave* localSlave, struct PRNGrandomPacket * receivedPkt){
     uint8_t i;
-    for(i = 0; i < sizeof(receivedPkt->random)/2 ; i++){
+    for(i = PRNGstamped ? STAMP_LENGHT : 0; i < sizeof(receivedPkt->random)/2 ; i++){
         if (localSlave->packet.random[i] != receivedPkt->random[i]){
             return 1;
         }
@@ -135,7 +177,7 @@ int8_t PRNGcheck(struct PRNGslave* localPktArray, struct PRNGrandomPacket * rece
     crc checksum;
 
     /*check CRC of received packet*/
-    checksum = crcFast((unsigned char*)receivedPkt, sizeof(struct PRNGrandomPacket)-2);
+    checksum = packetCrc((unsigned char*)receivedPkt, sizeof(struct PRNGrandomPacket)-2);
     if (checksum == receivedPkt->crc){
         /*check slave id if is in range*/
         if (numOfSlaves >= receivedPkt->slave_id ){
@@ -217,8 +259,13 @@ int8_t PRNGcheck(struct PRNGslave* localPktArray, struct PRNGrandomPacket * rece
 **/
 void binToHexa(uint8_t* from, uint8_t* to, uint16_t binaryLen ){
 
-  uint16_t i;
-  for (i = 0 ; i < binaryLen ; i++){    //conversion of binary data to ascii chars 0 ... F
+  uint16_t i = 0;
+#if HEXA_SIMD
+  i = binToHexaSimd(from, to, binaryLen);   //whole blocks by SSE2/AVX2, rest by loop
+  from += i;
+  to += 2 * i;
+#endif
+  for ( ; i < binaryLen ; i++){    //conversion of binary data to ascii chars 0 ... F
     *to = ((*from & 0xf0)>>4)+'0';
     if (*to > '9')         //because ASCII table is 0123456789:;<=>?@ABCDEF
       *to += 7;
@@ -245,8 +292,13 @@ void binToHexa(uint8_t* from, uint8_t* to, uint16_t binaryLen ){
 **/
 void hexaToBin(uint8_t* from, uint8_t* to, uint16_t binaryLen ){
     uint8_t ch1, ch2;
-    uint16_t i;
-    for (i=0; i<binaryLen; i++){    //conversion to binary data from ascii chars 0 ... F
+    uint16_t i = 0;
+#if HEXA_SIMD
+    i = hexaToBinSimd(from, to, binaryLen); //whole blocks by SSE2/AVX2, rest by loop
+    from += 2 * i;
+    to += i;
+#endif
+    for ( ; i<binaryLen; i++){    //conversion to binary data from ascii chars 0 ... F
       ch1 = *from - '0';
       from++;
       ch2 = *from - '0';
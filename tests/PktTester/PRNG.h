@@ -4,6 +4,12 @@
 #define SEED 500
 #define MAX_DIFF 100
 #define RANDOM_LENGHT 10
+/** @brief random words carrying 64 bit timestamp of PktGenerator (latency mode) **/
+#define STAMP_LENGHT 4
+/** @brief SSE2/AVX2 kernels of binToHexa() and hexaToBin() (HexSimd.c), only host tools **/
+#ifndef HEXA_SIMD
+#define HEXA_SIMD 0
+#endif
 #include <stdint.h>
 #include "../../Integrity/crc.h"
 
@@ -30,5 +36,8 @@ extern void binToHexa(uint8_t* from, uint8_t* to, uint16_t binaryLen );
 extern int8_t PRNGcheck(struct PRNGslave* localPktArray, struct PRNGrandomPacket * receivedPkt,uint8_t * message, uint8_t numOfSlaves);
 extern void PRNGnew(struct PRNGslave * slave);
 extern void PRNGinit(struct PRNGslave * slaves, uint8_t numberOfSlaves );
+extern void PRNGstamp(struct PRNGslave * slave, uint64_t stamp);
+extern uint64_t PRNGgetStamp(struct PRNGrandomPacket * receivedPkt);
+extern uint8_t PRNGstamped;
 
 #endif
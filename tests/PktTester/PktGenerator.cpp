@@ -1,20 +1,32 @@
+#include <chrono>
 #include <stdio.h>
+#include <stdlib.h>
 #include "RS232/rs232.h"
 #include "PRNG.h"
 #include "Compression.h"
 #include "settings.h"
 #include <stdint.h>
 
+#if defined(_WIN32)
+#define msleep(ms) Sleep(ms)
+#else
+#define msleep(ms) usleep((ms)*1000)
+#endif
+
 
 uint16_t slaveID = 1;
 struct PRNGslave slave;
 uint16_t comPort = 7;
 uint16_t baudRate = 9600;
 uint16_t delay = 0;
+uint32_t count = 0;
+const char* device = NULL;
 bool compression = false;
+bool latency = false;
 
 
 void listPorts(void){
+#if defined(_WIN32)
     int test;
     char ComName[50] = "COM";
     TCHAR lpTargetPath[100];
@@ -26,6 +38,10 @@ void listPorts(void){
         if (test)
             printf("\n%s",ComName);
     }
+#else
+    printf("\ncislo portu je poradie zariadenia v zozname RS232/rs232.c (1 = /dev/ttyS0)");
+    printf("\npre pseudo-terminal PtyRelay pouzi -D [zariadenie]");
+#endif
 }
 /**
  * @brief close_all funkcia volana pri zatvarani programu
@@ -38,7 +54,7 @@ void close_all ()
 }
 
 void shortHelp(void){
-    printf("pouzitie: 'PktGenerator [cislo portu] [slaveID 1-9] [-b, -d, -h]'\n");
+    printf("pouzitie: 'PktGenerator [cislo portu] [slaveID 1-9] [-b, -d, -n, -D, -c, -L, -h]'\n");
     printf("priklad: 'PktGenerator 3 1' baudRate je prednastaveny 9600 a nemusi byt zadavany\n");
 }
 
@@ -64,10 +80,24 @@ int main(int argc, char *argv[])
                    return 0;
                }
            }else
+           if (strcmp(&argv[i][1],"n") == 0 || strcmp(&argv[i][1],"count") == 0) // -n number of packets
+           {
+               i++;
+               count = strtoul(argv[i],&ptr,10);
+           }else
+           if (strcmp(&argv[i][1],"D") == 0 || strcmp(&argv[i][1],"device") == 0) // -D device instead of com port
+           {
+               i++;
+               device = argv[i];
+           }else
            if (strcmp(&argv[i][1],"c") == 0 || strcmp(&argv[i][1],"compress") == 0 ) // -d do binary compression
            {
                compression = true;
            }else
+           if (strcmp(&argv[i][1],"L") == 0 || strcmp(&argv[i][1],"latency") == 0 ) // -L timestamp in packet
+           {
+               latency = true;
+           }else
            if (strcmp(&argv[i][1],"b") == 0 || strcmp(&argv[i][1],"baud") == 0) // -b baudrate parameter
            {
                i++;
@@ -80,10 +110,14 @@ int main(int argc, char *argv[])
            }else
            if (strcmp(&argv[i][1],"h") == 0 || strcmp(&argv[i][1],"help") == 0) // -h help
            {
-               printf("pouzitie: 'PktGenerator [cislo portu] [slaveID 1-9] [-b, -d, -h]'\n");
+               printf("pouzitie: 'PktGenerator [cislo portu] [slaveID 1-9] [-b, -d, -n, -D, -c, -L, -h]'\n");
                printf("priklad: 'PktGenerator 3 1' baudRate je prednastaveny 9600 a nemusi byt zadavany\n");
                printf("parametre: -b baudrate [9600]\n");
                printf("           -d delay oneskorenie medzi paketmi [0ms]\n");
+               printf("           -n pocet paketov, potom koniec [0 = nekonecne]\n");
+               printf("           -D zariadenie namiesto com portu, napr. pseudo-terminal PtyRelay\n");
+               printf("           -c binarna kompresia paketov\n");
+               printf("           -L casova peciatka v pakete pre meranie oneskorenia (PktReader -L)\n");
                printf("\n");
                return 0;
            }else{
@@ -118,6 +152,8 @@ int main(int argc, char *argv[])
       }
 
     printf("com port %d\nslaveID = %d,\nbaudRate = %d\n",comPort,slaveID,baudRate);
+    if (device != NULL)
+        RS232_SetComportName(comPort-1, device);
 
     atexit(close_all );
     PRNGinit(&slave,slaveID); //initialize slave variable
@@ -132,8 +168,12 @@ int main(int argc, char *argv[])
     }else{
         printf("com port uspesne otvoreny\n");
         RS232_flushRXTX(comPort -1);
-        while(1){
+        while(count == 0 || slave.packet.numberOfPacket < count){
             PRNGnew(&slave);  // generate new packet
+            if (latency == true){   //monotonic time of sending in microseconds, same clock as PktReader
+                PRNGstamp(&slave, std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
 
             binToHexa((uint8_t*)&slave.packet,hexaBuffer,sizeof(struct PRNGrandomPacket));
             hexaBuffer[(sizeof(struct PRNGrandomPacket)*2)] = STRING_TERMINATOR;
@@ -146,7 +186,7 @@ int main(int argc, char *argv[])
             }else{
                 RS232_cputs(comPort-1,(char *)&hexaBuffer);
             }
-            Sleep(delay);
+            msleep(delay);
  
             //read UART buffer if avaliable
             n = RS232_PollComport(comPort-1, buf, 4095);
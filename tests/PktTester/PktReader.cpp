@@ -1,6 +1,8 @@
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <vector>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -8,6 +10,7 @@
 #include "PRNG.h"
 #include "settings.h"
 #include "Compression.h"
+#include "Cobs.h"
 #include "RS232/rs232.h"
 #include "uwbpacketclass.hpp"
 
@@ -17,6 +20,7 @@
 #define BAUD_RATE 115200
 #define SEED 500
 #define NUM_OF_SLAVES 4
+#define MAX_SLAVES 9
 
 
 char logFile[100] = "log.txt";
@@ -26,6 +30,16 @@ int numOfSlaves = NUM_OF_SLAVES;
 bool Mikula = false;
 bool terminal = false;
 bool decompression = false;
+bool binary = false;
+bool clearScreen = true;
+double runTime = 0;
+const char* device = NULL;
+unsigned long errorPackets = 0;
+struct PRNGslave* slavesStat = NULL;
+bool latency = false;
+std::vector<uint32_t> latencySamples[MAX_SLAVES];  //oneskorenie paketov v mikrosekundach
+size_t latencyPrinted[MAX_SLAVES];                 //vzorky uz vypisane v print_output
+pthread_mutex_t latencyMutex = PTHREAD_MUTEX_INITIALIZER;
 uwbPacketRx reciever;
 
 std::chrono::time_point<std::chrono::system_clock> programStart;
@@ -69,6 +83,176 @@ void print_time(bool into_file){
         fputs(buffer,logFilePointer);
     }
 }
+/**
+ * @brief record_latency ulozenie oneskorenia paketu od odoslania z PktGenerator -L
+ * @note  PktGenerator a PktReader musia bezat na jednom pocitaci (spolocne monotonne hodiny)
+ */
+void record_latency(struct PRNGrandomPacket * pkt){
+    uint64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+    uint64_t stamp = PRNGgetStamp(pkt);
+
+    if (pkt->slave_id < 1 || pkt->slave_id > MAX_SLAVES)
+        return;
+    pthread_mutex_lock(&latencyMutex);
+    latencySamples[pkt->slave_id - 1].push_back(now > stamp ? (uint32_t)(now - stamp) : 0);
+    pthread_mutex_unlock(&latencyMutex);
+}
+
+/**
+ * @brief percentile hodnota zoradenych vzoriek pod ktorou je podiel p vzoriek
+ */
+double percentile(const std::vector<uint32_t> &sorted, double p){
+    size_t i = (size_t)(p * sorted.size() + 0.999999);
+    if (sorted.empty())
+        return 0;
+    if (i > 0)
+        i--;
+    if (i >= sorted.size())
+        i = sorted.size() - 1;
+    return sorted[i];
+}
+
+/**
+ * @brief latency_samples kopia vzoriek slave od indexu from, zoradena
+ */
+std::vector<uint32_t> latency_samples(int slave, size_t from){
+    std::vector<uint32_t> samples;
+
+    pthread_mutex_lock(&latencyMutex);
+    if (from < latencySamples[slave].size())
+        samples.assign(latencySamples[slave].begin() + from, latencySamples[slave].end());
+    latencyPrinted[slave] = latencySamples[slave].size();
+    pthread_mutex_unlock(&latencyMutex);
+    std::sort(samples.begin(), samples.end());
+    return samples;
+}
+
+/**
+ * @brief check_packet kontrola PRNG paketu, chyba je vypisana a zapisana do log suboru
+ * @return true ak paket nie je ocakavany (chyba alebo chybajuce pakety)
+ */
+bool check_packet(struct PRNGslave * slaves, struct PRNGrandomPacket * pkt, char * message){
+    if (PRNGcheck(slaves,pkt,(uint8_t *)message,numOfSlaves)){
+        if (strncmp(message,"\nmissing",8) != 0)
+            errorPackets++;
+        else if (latency == true)
+            record_latency(pkt);
+        print_time(true);
+        puts(message);
+        fputs(message,logFilePointer);
+        return true;
+    }
+    //printf("packet is valid");
+    if (latency == true)
+        record_latency(pkt);
+    return false;
+}
+
+/**
+ * @brief read_record binarny zaznam mastra (BINARY_OUTPUT), slova platu su dekomprimovane a kontrolovane
+ * @note  ramec medzi COBS_DELIMITER, ktory nie je zaznam a zacina '\n', je sprava mastra (dma_printf)
+ * @note  zaznam bez platu je chybajuci paket
+ */
+void read_record(struct PRNGslave * slaves, uint8_t * frame, uint16_t len, char * message){
+    uint8_t record[RECORD_MAX_FRAME], hexa[DECOMPRESSED_DEPTH];
+    uint8_t packet[sizeof(struct PRNGrandomPacket)];
+    uint16_t recordLen, hexaLen, begin, end;
+
+    recordLen = recordDecode(frame, len, record);
+    if (recordLen == 0){
+        if (frame[0] == '\n'){                             //sprava mastra
+            fwrite(frame,1,len,logFilePointer);
+            fwrite(frame,1,len,stdout);
+        }else{
+            errorPackets++;
+            sprintf(message,"\nbroken record of %u bytes#",len);
+            print_time(true);
+            puts(message);
+            fputs(message,logFilePointer);
+        }
+        return;
+    }
+#if TEXT_DICTIONARY
+    if (record[1] == 1)
+        textDecoderReset();                                 //prvy paket slotu
+#endif
+    if (recordLen == RECORD_HEAD){
+#if TEXT_DICTIONARY
+        textDecoderLost();
+#endif
+        sprintf(message,"\nmissing packet %d of slave %d #",record[1],record[0]);
+        puts(message);
+        fputs(message,logFilePointer);
+        return;
+    }
+    hexaLen = binaryToHexaDecompression(&record[RECORD_HEAD], hexa, recordLen - RECORD_HEAD);
+    for (begin = 0; begin < hexaLen; begin = end + 1){
+        for (end = begin; end < hexaLen && hexa[end] != STRING_TERMINATOR; end++)
+            ;
+        if (end - begin != sizeof(struct PRNGrandomPacket)*2){
+            errorPackets++;
+            sprintf(message,"\nunexpected word of %d chars from slave %d#",end - begin,record[0]);
+            puts(message);
+            fputs(message,logFilePointer);
+            continue;
+        }
+        //konvertuj paket z hexadecimalnej do binarnej podoby
+        hexaToBin(&hexa[begin],packet,sizeof(struct PRNGrandomPacket));
+        check_packet(slaves,(struct PRNGrandomPacket*)packet,message);
+    }
+}
+
+/**
+ * @brief compressed_packet PRNG paket komprimovaneho slova (hexaToBinaryCompression, format v1) bez kopirovania
+ * @return paket za hlavickou slova v prijimacom bufferi, NULL ak hlavicka nie je dlzka PRNG paketu
+ */
+static inline struct PRNGrandomPacket * compressed_packet(uint8_t * word){
+    if (word[0] != sizeof(struct PRNGrandomPacket))
+        return NULL;
+    return (struct PRNGrandomPacket *)&word[1];
+}
+
+/**
+ * @brief read_compressed blok prijatych bajtov v mode -decompress, pakety su kontrolovane priamo v prijimacom bufferi
+ *        bez binaryToHexaDecompression a hexaToBin
+ * @note  po strate synchronizacie (chybna hlavicka) je hladana po bajtoch hlavicka slova so spravnym CRC paketu,
+ *        necele slovo zostava na zaciatku buffera
+ */
+void read_compressed(struct PRNGslave * slaves, uint8_t * rx, int * rxLen, int rxSize, char * message){
+    static bool synchronized = true;
+    struct PRNGrandomPacket * pkt;
+    int n, pos = 0;
+
+    while ((n = RS232_PollComport(comPort -1, rx + *rxLen, rxSize - *rxLen)) <= 0)
+        ;
+    *rxLen += n;
+    while (*rxLen - pos >= (int)sizeof(struct PRNGrandomPacket) + 1){
+        pkt = compressed_packet(&rx[pos]);
+        if (pkt == NULL){
+            if (synchronized == true){
+                errorPackets++;
+                sprintf(message,"\nunexpected word header %d#",rx[pos]);
+                print_time(true);
+                puts(message);
+                fputs(message,logFilePointer);
+                synchronized = false;
+            }
+            pos++;
+            continue;
+        }
+        if (synchronized == false && crcFast((unsigned char *)pkt,sizeof(struct PRNGrandomPacket)-2) != pkt->crc){
+            pos++;                                          //hlavicka je v datach slova
+            continue;
+        }
+        synchronized = true;
+        check_packet(slaves,pkt,message);
+        pos += sizeof(struct PRNGrandomPacket) + 1;
+    }
+    memmove(rx, rx + pos, *rxLen - pos);
+    *rxLen -= pos;
+}
+
 void print_output(struct PRNGslave * slaves , int slavesNum){
     unsigned long numOfValidPkt = 0;
     unsigned int numOfMissPkt = 0;
@@ -81,7 +265,13 @@ void print_output(struct PRNGslave * slaves , int slavesNum){
         received += slaves[i].receivedBytes;
     }
 
-    system("cls");
+    if (clearScreen == true){
+#if defined(_WIN32)
+        system("cls");
+#else
+        printf("\033[2J\033[H");
+#endif
+    }
     printf("slave || pren.rychlost(UART)|| platne p. || chybajuce p.\n");
     printf("por.c.        bajt/s          pocet           pocet\n");
     //print all statistic separately
@@ -89,6 +279,14 @@ void print_output(struct PRNGslave * slaves , int slavesNum){
     for (i=0;i<slavesNum;i++){
         printf("%d             %.5lu           %.10lu         %.5u\n",slaves[i].packet.slave_id,slaves[i].receivedBytes,slaves[i].numberOfReceivedPackets,slaves[i].numberOfMissingPackets);
     }
+    if (latency == true){
+        printf("slave || oneskorenie za poslednu sekundu [ms] p50 / p99 / max || vzoriek\n");
+        for (i=0;i<slavesNum;i++){
+            std::vector<uint32_t> samples = latency_samples(i, latencyPrinted[i]);
+            printf("%d             %8.3f / %8.3f / %8.3f          %zu\n",i+1,percentile(samples,0.5)/1000,
+                   percentile(samples,0.99)/1000,samples.empty() ? 0.0 : samples.back()/1000.0,samples.size());
+        }
+    }
     print_time(false);
 
     for (i=0;i<slavesNum;i++){
@@ -103,7 +301,7 @@ void print_output(struct PRNGslave * slaves , int slavesNum){
 void *input (void * )
 {
     char inputBuffer[100];
-    char ch = '\0',i=0;
+    int ch = '\0',i=0;
     printf("\ninput\n");
     
     while(1){
@@ -111,9 +309,11 @@ void *input (void * )
         inputBuffer[0] = '#';
         do{
             ch = getchar();
+            if (ch == EOF)      //stdin is closed (scripted run)
+                return NULL;
             inputBuffer[i]=ch;
             i++;
-        }while(ch != '\n');
+        }while(ch != '\n' && i < (int)sizeof(inputBuffer) - 2);
         inputBuffer[i-1]=STRING_TERMINATOR;
         inputBuffer[i]='\0';
         printf(inputBuffer);
@@ -135,12 +335,16 @@ void *printing (void * slaves){
                 start = std::chrono::system_clock::now();
                 break;
             }
+            std::chrono::duration<double> run = end - programStart;
+            if (runTime > 0 && run.count() >= runTime)  //end of scripted run
+                exit(0);
         }
     }
     /* the function must return something - NULL will do */
     return NULL;
 }
 void listPorts(void){
+#if defined(_WIN32)
     int test;
     char ComName[50] = "COM";
     TCHAR lpTargetPath[100];
@@ -152,6 +356,49 @@ void listPorts(void){
         if (test)
             printf("\n%s",ComName);
     }
+#else
+    printf("\ncislo portu je poradie zariadenia v zozname RS232/rs232.c (1 = /dev/ttyS0)");
+    printf("\npre pseudo-terminal PtyRelay pouzi -D [zariadenie]");
+#endif
+}
+
+/**
+ * @brief print_summary vypis celkovej statistiky na konci behu (pre skripty)
+ * @note  riadok "summary valid N missing N errors N time N s rate N B/s"
+ * @note  s -L riadky "latency slave N samples N p50 N p99 N p999 N max N ms" a "latency all ..."
+ */
+void print_summary(struct PRNGslave * slaves , int slavesNum, double seconds){
+    unsigned long numOfValidPkt = 0;
+    unsigned long numOfMissPkt = 0;
+    int i;
+
+    for (i=0;i<slavesNum;i++){
+        numOfValidPkt += slaves[i].numberOfReceivedPackets;
+        numOfMissPkt += slaves[i].numberOfMissingPackets;
+        printf("\nslave %d valid %lu missing %lu",i+1,(unsigned long)slaves[i].numberOfReceivedPackets,
+               (unsigned long)slaves[i].numberOfMissingPackets);
+    }
+    if (latency == true){
+        std::vector<uint32_t> all;
+        for (i=0;i<=slavesNum;i++){
+            std::vector<uint32_t> samples;
+            if (i < slavesNum){
+                samples = latency_samples(i, 0);
+                all.insert(all.end(), samples.begin(), samples.end());
+                printf("\nlatency slave %d",i+1);
+            }else{
+                std::sort(all.begin(), all.end());
+                samples.swap(all);
+                printf("\nlatency all");
+            }
+            printf(" samples %zu p50 %.3f p99 %.3f p999 %.3f max %.3f ms",samples.size(),
+                   percentile(samples,0.5)/1000,percentile(samples,0.99)/1000,
+                   percentile(samples,0.999)/1000,samples.empty() ? 0.0 : samples.back()/1000.0);
+        }
+    }
+    printf("\nsummary valid %lu missing %lu errors %lu time %.1f s rate %.0f B/s\n",
+           numOfValidPkt,numOfMissPkt,errorPackets,seconds,
+           seconds > 0 ? numOfValidPkt*(sizeof(struct PRNGrandomPacket)*2+1)/seconds : 0.0);
 }
 
 /**
@@ -165,13 +412,15 @@ void close_all ()
 
    printf("\n program bezal %d minut ",(int)elapsed_time.count()/60);
    fprintf(logFilePointer,"\n program bezal %d minut ",(int)elapsed_time.count()/60);
+   if (slavesStat != NULL)
+       print_summary(slavesStat, numOfSlaves, elapsed_time.count());
     
    fclose(logFilePointer);
    RS232_CloseComport(comPort -1);
 }
 
 void shortHelp(void){
-    printf("pouzitie: 'PktReader [cislo portu] [-b, -s, -h, -p,-M ]'\n");
+    printf("pouzitie: 'PktReader [cislo portu] [-b, -s, -h, -p, -D, -T, -L, -M, -binary ]'\n");
     printf("priklad: 'PktReader 3 -b 9600' com 3, baudRate 9600 \n");
 }
 /**
@@ -216,6 +465,22 @@ int main(int argc, char *argv[])
                     return 0;
                 }
             }else
+            if (strcmp(&argv[i][1],"D") == 0 || strcmp(&argv[i][1],"device") == 0) // -D device instead of com port
+            {
+                i++;
+                device = argv[i];
+            }else
+            if (strcmp(&argv[i][1],"T") == 0 || strcmp(&argv[i][1],"time") == 0) // -T time of scripted run
+            {
+                i++;
+                runTime = strtod(argv[i],&ptr);
+                clearScreen = false;
+            }else
+            if (strcmp(&argv[i][1],"L") == 0 || strcmp(&argv[i][1],"latency") == 0) // -L latency of packets from PktGenerator -L
+            {
+                latency = true;
+                PRNGstamped = 1;
+            }else
             if (strcmp(&argv[i][1],"M") == 0 || strcmp(&argv[i][1],"Mikula") == 0) // M (Mikula) extracting data from UWB formated packet
             {
                 Mikula = true;
@@ -224,8 +489,12 @@ int main(int argc, char *argv[])
             {
                 terminal = true;
             }else
-            if (strcmp(&argv[i][1],"decompress") == 0) // spusti dekompresiu dat z binarnej podoby
-            {   //velmi citlive na chyby v prenosovom kanaly
+            if (strcmp(&argv[i][1],"binary") == 0) // binarne zaznamy mastra (BINARY_OUTPUT) v COBS ramcoch
+            {
+                binary = true;
+            }else
+            if (strcmp(&argv[i][1],"decompress") == 0) // komprimovane slova PktGenerator -c, kontrola bez dekompresie
+            {   //po chybe v prenosovom kanaly je hladana hlavicka slova (read_compressed)
                 decompression = true;
             }else
             if (strcmp(&argv[i][1],"o") == 0 || strcmp(&argv[i][1],"output") == 0) // -o output log file
@@ -238,13 +507,18 @@ int main(int argc, char *argv[])
                 printf("\nPkrReader je program spolupracujuci s programom PktGenerator\n");
                 printf("Program cita pakety generovane programom PktGenerator\n");
                 printf("Data cita z UARTu\n");
-                printf("pouzitie: 'PktReader [cislo portu] [-b, -s, -h, -p, -M ]'\n");
+                printf("pouzitie: 'PktReader [cislo portu] [-b, -s, -h, -p, -D, -T, -L, -M ]'\n");
                 printf("priklad: 'PktReader 3 -b 9600' com 3, baudRate 9600 \n");
                 printf("parametre: -b baudrate [115200]\n");
                 printf("           -p comPort [3]\n");
+                printf("           -D zariadenie namiesto com portu, napr. pseudo-terminal PtyRelay\n");
+                printf("           -T cas behu v sekundach, potom vypis suhrnu a koniec (pre skripty)\n");
                 printf("           -s pocet slave zariadeni [4]\n");
+                printf("           -L oneskorenie paketov z PktGenerator -L (p50/p99/p999/max na rovnakom pocitaci)\n");
                 printf("           -o output vystupny log subor [log.txt]\n");
                 printf("           -M (Mikula) extracting data from UWB formated packet \n");
+                printf("           -binary binarne zaznamy mastra (BINARY_OUTPUT) v COBS ramcoch\n");
+                printf("           -decompress komprimovane slova (PktGenerator -c), pakety su kontrolovane v prijimacom bufferi\n");
                 printf("           -t -terminal funguje len ako seriovy termial");
                 printf("           -h help \n");
                 printf("\n");
@@ -277,6 +551,10 @@ int main(int argc, char *argv[])
     char message[100];
     unsigned char buffer[250];
     int bufferPointer = 0;
+    uint8_t frame[RECORD_MAX_FRAME];
+    int framePointer = 0;
+    uint8_t rxBuffer[4096];
+    int rxPointer = 0;
 
     programStart = std::chrono::system_clock::now();
 
@@ -286,6 +564,9 @@ int main(int argc, char *argv[])
     //inicializovanie hodnot pre slave zariadenia
     for(i=0; i<numOfSlaves;i++)
         PRNGinit(&slaves[i],i+1);
+    slavesStat = slaves;
+    if (device != NULL)
+        RS232_SetComportName(comPort -1, device);
 
     //inicialaizacia a otvorenie com portu
     char mode[]={'8','N','1',0};
@@ -324,10 +605,30 @@ int main(int argc, char *argv[])
 
         while(1){
 
-            while ( 0 == RS232_PollComport(comPort -1, &c, 1));
+            if (decompression == true && terminal == false && binary == false){
+                read_compressed(slaves,rxBuffer,&rxPointer,sizeof(rxBuffer),message);
+                continue;
+            }
+
+            while ( 0 >= RS232_PollComport(comPort -1, &c, 1));
 
             if (terminal == true)
                 putchar(c);
+            else if (binary == true){
+                if (c == COBS_DELIMITER){                   //koniec ramca
+                    if (framePointer > (int)sizeof(frame)){
+                        errorPackets++;
+                        printf("\nframe is longer than %d bytes#",(int)sizeof(frame));
+                    }else if (framePointer > 0)
+                        read_record(slaves,frame,framePointer,message);
+                    framePointer = 0;
+                }else{
+                    if (framePointer < (int)sizeof(frame))
+                        frame[framePointer] = c;
+                    if (framePointer <= (int)sizeof(frame))
+                        framePointer++;
+                }
+            }
             else{
                 if (decompression == false)
                 {
@@ -338,11 +639,11 @@ int main(int argc, char *argv[])
                         {
                             fputc(c,logFilePointer);
                             putchar(c);
-                            while ( 0 == RS232_PollComport(comPort -1, &c, 1));
+                            while ( 0 >= RS232_PollComport(comPort -1, &c, 1));
                         }
                         fputc(c,logFilePointer);
                         putchar(c);
-                        while ( 0 == RS232_PollComport(comPort -1, &c, 1));
+                        while ( 0 >= RS232_PollComport(comPort -1, &c, 1));
                     }
                     //skontroluj ci je prijimanie synchronizovane
                     if (synchronizeFlag == true){
@@ -396,50 +697,11 @@ int main(int argc, char *argv[])
                             buffer[(sizeof(struct PRNGrandomPacket))+1] = '\0';
                             
 
-                            if (PRNGcheck(slaves,(struct PRNGrandomPacket*)buffer,(uint8_t *)message,numOfSlaves)){
-                                print_time(true);
-                                puts(message);
-                                fputs(message,logFilePointer);
+                            if (check_packet(slaves,(struct PRNGrandomPacket*)buffer,message))
                                 synchronizeFlag = false;
-                            }
-                            else{
-                                //printf("packet is valid");
-                            }
                             bufferPointer -= ((sizeof(struct PRNGrandomPacket)*2) +1);
                         }
                     }
-                }else{
-                    
-                    buffer[bufferPointer] = c;
-                    bufferPointer++;
-                    
-                    if (bufferPointer >= sizeof(struct PRNGrandomPacket)+1){
-                        uint8_t locBuf[250];
-                        uint16_t len;
-                        
-                        len = binaryToHexaDecompression( buffer, 
-                                    locBuf, sizeof(struct PRNGrandomPacket)+1);
-                                    
-                        //konvertuj paket z hexadecimalnej do binarnej podoby
-                        hexaToBin(locBuf,buffer,sizeof(struct PRNGrandomPacket));
-                        buffer[(sizeof(struct PRNGrandomPacket))] = STRING_TERMINATOR;
-                        buffer[(sizeof(struct PRNGrandomPacket))+1] = '\0';
-                        
-                        if (PRNGcheck(slaves,(struct PRNGrandomPacket*)buffer,(uint8_t *)message,numOfSlaves)){
-                            print_time(true);
-                            puts(message);
-                            fputs(message,logFilePointer);
-                            while(c != sizeof(struct PRNGrandomPacket)+1)
-                                while ( 0 == RS232_PollComport(comPort -1, &c, 1));
-                            buffer[bufferPointer] = c;
-                            bufferPointer -= (sizeof(struct PRNGrandomPacket));
-                        }
-                        else{
-                            //printf("packet is valid");
-                            bufferPointer -= (sizeof(struct PRNGrandomPacket) +1);
-                        }
-                        
-                    }
                 }
             }
         }
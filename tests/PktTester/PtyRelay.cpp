@@ -0,0 +1,339 @@
+/**
+ *****************************************************************************
+   @file     PtyRelay.cpp
+   @brief    concentrator emulator on Linux pseudo-terminals for end-to-end
+             test of PktGenerator and PktReader without boards
+              - one pseudo-terminal per slave UART (input of PktGenerator)
+              - one pseudo-terminal of master UART (input of PktReader)
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    words of slaves are queued in memory of slave and forwarded to
+            master UART in round robin, whole words are never interleaved
+   @note    slave UART is read at -u baud rate, master UART is written at -b
+            baud rate (10 bits per byte), 0 is turning pacing off
+   @note    word is dropped if memory of slave (-q) is full or with
+            probability -l (lost on radio), drops are printed in statistic
+   @note    messages written by PktReader (#...$) are sent to all slaves
+   @note    at the end (-t or SIGTERM) actual word is finished, statistic is
+            printed and pseudo-terminals stay open LINGER_SECONDS
+   @code
+        ./PtyRelay -s 2 -t 10 -p /tmp/pkt &
+        ./PktReader -D /tmp/pkt0 -s 2 -T 9 &
+        ./PktGenerator -D /tmp/pkt1 1 & ./PktGenerator -D /tmp/pkt2 2 &
+   @endcode
+   @see     read_me.txt, pty_test.sh
+**/
+#include <deque>
+#include <string>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "settings.h"
+
+
+#define MAX_SLAVES      9
+/** @brief memory of slave, both halfs of pktMemory **/
+#define SLAVE_MEMORY    (2 * NUM_OF_PACKETS_IN_MEMORY * PACKETRAM_LEN)
+/** @brief time to read rest of data from master UART after end of relay **/
+#define LINGER_SECONDS  1
+/** @brief start, 8 data and stop bit **/
+#define BITS_PER_BYTE   10.0
+
+/** @brief pseudo-terminal of one UART and its statistic **/
+struct ptyPort {
+  int         fd;             /*!< @brief master side, used by relay */
+  int         peerFd;         /*!< @brief slave side kept open, no hangup between runs of tools */
+  std::string link;           /*!< @brief symbolic link to slave side */
+  std::string word;           /*!< @brief actually received word */
+  std::deque<std::string> queue;
+  size_t      queued;         /*!< @brief bytes in queue */
+  double      rxNext;         /*!< @brief time of next read (pacing) */
+  uint64_t    bytesIn, wordsIn, wordsOut, dropped, lost;
+};
+
+static ptyPort  port[MAX_SLAVES + 1];   // 0 = master UART, 1..n = slave UART
+static int      slaves = 4;
+static double   slaveBaud = UART_BAUD_RATE_SLAVE;
+static double   masterBaud = UART_BAUD_RATE_MASTER;
+static size_t   memoryLimit = SLAVE_MEMORY;
+static size_t   fixedLen = 0;
+static double   lossProbability = 0;
+static volatile sig_atomic_t stop = 0;
+
+static void usage(const char* name)
+{
+  printf("usage: %s [options]\n"
+         "  -s <n>      number of slaves 1..%d (default 4)\n"
+         "  -p <path>   prefix of links, <path>0 master UART, <path>1..n slave UART (default /tmp/pkt)\n"
+         "  -u <baud>   baud rate of slave UART, 0 = not paced (default %d)\n"
+         "  -b <baud>   baud rate of master UART, 0 = not paced (default %d)\n"
+         "  -q <bytes>  memory of slave, word is dropped if full (default %d)\n"
+         "  -f <len>    fixed length of word (compressed stream of PktGenerator -c),\n"
+         "              otherwise words are terminated by '%c'\n"
+         "  -l <p>      probability of lost word 0.0 - 1.0 (default 0)\n"
+         "  -r <seed>   seed of loss model (default 1)\n"
+         "  -t <s>      duration in seconds, 0 = until SIGINT/SIGTERM (default 0)\n",
+         name, MAX_SLAVES, UART_BAUD_RATE_SLAVE, UART_BAUD_RATE_MASTER, SLAVE_MEMORY, STRING_TERMINATOR);
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void onSignal(int signal)
+{
+  (void)signal;
+  stop = 1;
+}
+
+/**
+   @fn     static int openPty(ptyPort* p, const std::string& link)
+   @brief  create pseudo-terminal in raw mode and link to its slave side
+   @return 0 if success
+**/
+static int openPty(ptyPort* p, const std::string& link)
+{
+  struct termios tio;
+  const char* name;
+
+  if ((p->fd = posix_openpt(O_RDWR | O_NOCTTY)) < 0 || grantpt(p->fd) || unlockpt(p->fd)
+      || (name = ptsname(p->fd)) == NULL){
+    perror("posix_openpt");
+    return 1;
+  }
+  if ((p->peerFd = open(name, O_RDWR | O_NOCTTY)) < 0){
+    perror(name);
+    return 1;
+  }
+  tcgetattr(p->peerFd, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(p->peerFd, TCSANOW, &tio);
+  fcntl(p->fd, F_SETFL, fcntl(p->fd, F_GETFL) | O_NONBLOCK);
+
+  unlink(link.c_str());
+  if (symlink(name, link.c_str())){
+    perror(link.c_str());
+    return 1;
+  }
+  p->link = link;
+  printf("%s -> %s\n", link.c_str(), name);
+  return 0;
+}
+
+/**
+   @fn     static void storeWord(ptyPort* p)
+   @brief  complete word is stored in memory of slave or dropped
+**/
+static void storeWord(ptyPort* p)
+{
+  p->wordsIn++;
+  if (p->queued + p->word.size() > memoryLimit)
+    p->dropped++;
+  else if (lossProbability > 0 && drand48() < lossProbability)
+    p->lost++;
+  else{
+    p->queued += p->word.size();
+    p->queue.push_back(p->word);
+  }
+  p->word.clear();
+}
+
+/**
+   @fn     static void receive(ptyPort* p, double t)
+   @brief  read from slave UART limited by baud rate and split to words
+**/
+static void receive(ptyPort* p, double t)
+{
+  unsigned char buf[256];
+  size_t size = sizeof(buf);
+  ssize_t n, i;
+
+  if (slaveBaud > 0){
+    if (p->rxNext < t - 0.01)
+      p->rxNext = t - 0.01;                                   // idle line, burst of at most 10 ms
+    // data of elapsed time since rxNext and 1 ms ahead, poll is waking up late
+    size = (size_t)((t - p->rxNext + 0.001) * slaveBaud / BITS_PER_BYTE) + 1;
+    if (size > sizeof(buf))
+      size = sizeof(buf);
+  }
+  if ((n = read(p->fd, buf, size)) <= 0)
+    return;
+  p->bytesIn += n;
+  if (slaveBaud > 0)
+    p->rxNext += n * BITS_PER_BYTE / slaveBaud;
+
+  for (i = 0; i < n; i++){
+    p->word.push_back((char)buf[i]);
+    if (fixedLen ? p->word.size() >= fixedLen : buf[i] == STRING_TERMINATOR)
+      storeWord(p);
+  }
+}
+
+/**
+   @fn     static void broadcast(void)
+   @brief  messages of PktReader to master UART are sent to all slaves
+**/
+static void broadcast(void)
+{
+  unsigned char buf[256];
+  ssize_t n, w;
+  int i;
+
+  if ((n = read(port[0].fd, buf, sizeof(buf))) <= 0)
+    return;
+  for (i = 1; i <= slaves; i++)
+    w = write(port[i].fd, buf, n);    // message is lost if slave is not reading
+  (void)w;
+}
+
+static void printStatistic(double seconds, uint64_t bytesOut)
+{
+  uint64_t in = 0, out = 0, dropped = 0, lost = 0;
+  int i;
+
+  printf("\nslave    bytesIn   wordsIn  wordsOut   dropped      lost  queued\n");
+  for (i = 1; i <= slaves; i++){
+    printf("%5d %10llu %9llu %9llu %9llu %9llu %7zu\n", i,
+           (unsigned long long)port[i].bytesIn, (unsigned long long)port[i].wordsIn,
+           (unsigned long long)port[i].wordsOut, (unsigned long long)port[i].dropped,
+           (unsigned long long)port[i].lost, port[i].queue.size());
+    in += port[i].wordsIn;
+    out += port[i].wordsOut;
+    dropped += port[i].dropped;
+    lost += port[i].lost;
+  }
+  printf("relay words in %llu out %llu dropped %llu lost %llu time %.1f s master UART %.0f B/s\n",
+         (unsigned long long)in, (unsigned long long)out, (unsigned long long)dropped,
+         (unsigned long long)lost, seconds, seconds > 0 ? bytesOut / seconds : 0.0);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt, i, n, rr = 1;
+  double seconds = 0, begin, t, txNext, wait;
+  const char* prefix = "/tmp/pkt";
+  std::string out;                  // word actually written to master UART
+  size_t outPos = 0;
+  uint64_t bytesOut = 0;
+  struct pollfd fds[MAX_SLAVES + 1];
+  long seed = 1;
+
+  while ((opt = getopt(argc, argv, "s:p:u:b:q:f:l:r:t:h")) != -1){
+    switch (opt){
+      case 's': slaves = atoi(optarg); break;
+      case 'p': prefix = optarg; break;
+      case 'u': slaveBaud = atof(optarg); break;
+      case 'b': masterBaud = atof(optarg); break;
+      case 'q': memoryLimit = strtoul(optarg, NULL, 0); break;
+      case 'f': fixedLen = strtoul(optarg, NULL, 0); break;
+      case 'l': lossProbability = atof(optarg); break;
+      case 'r': seed = atol(optarg); break;
+      case 't': seconds = atof(optarg); break;
+      default:
+        usage(argv[0]);
+        return 1;
+    }
+  }
+  if (slaves < 1 || slaves > MAX_SLAVES){
+    fprintf(stderr, "number of slaves must be 1..%d\n", MAX_SLAVES);
+    return 1;
+  }
+  srand48(seed);
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  signal(SIGPIPE, SIG_IGN);
+
+  for (i = 0; i <= slaves; i++)
+    if (openPty(&port[i], std::string(prefix) + std::to_string(i)))
+      return 1;
+  fflush(stdout);
+
+  begin = txNext = now();
+  while (!stop && (seconds <= 0 || now() - begin < seconds)){
+    t = now();
+
+    // master UART, one word at a time paced by baud rate
+    if (outPos == out.size() && t >= txNext){
+      for (i = 0; i < slaves; i++){
+        ptyPort* p = &port[rr];
+        rr = rr % slaves + 1;
+        if (!p->queue.empty()){
+          out = p->queue.front();
+          outPos = 0;
+          p->queue.pop_front();
+          p->queued -= out.size();
+          p->wordsOut++;
+          if (masterBaud > 0)
+            txNext = (txNext > t ? txNext : t) + out.size() * BITS_PER_BYTE / masterBaud;
+          break;
+        }
+      }
+    }
+    if (outPos < out.size()){
+      ssize_t w = write(port[0].fd, out.data() + outPos, out.size() - outPos);
+      if (w > 0){
+        outPos += w;
+        bytesOut += w;
+      }
+    }
+
+    // wait for data or for next word of master UART
+    wait = 0.01;
+    if (outPos < out.size())
+      wait = 0.001;                                   // master UART buffer is full
+    else if (txNext > t && txNext - t < wait)
+      wait = txNext - t;
+    else if (txNext <= t)
+      for (i = 1; i <= slaves; i++)
+        if (!port[i].queue.empty())
+          wait = 0;
+    fds[0].fd = port[0].fd;
+    fds[0].events = POLLIN;
+    for (i = 1; i <= slaves; i++){
+      fds[i].fd = port[i].fd;
+      fds[i].events = (port[i].rxNext <= t) ? POLLIN : 0;
+      if (port[i].rxNext > t && port[i].rxNext - t < wait)
+        wait = port[i].rxNext - t;
+    }
+    n = poll(fds, slaves + 1, (int)(wait * 1000 + 0.999));
+    if (n <= 0)
+      continue;
+
+    t = now();
+    if (fds[0].revents & POLLIN)
+      broadcast();
+    for (i = 1; i <= slaves; i++)
+      if (fds[i].revents & POLLIN)
+        receive(&port[i], t);
+  }
+
+  // finish word, PktReader is reading rest of data before hangup of master UART
+  t = now();
+  while (outPos < out.size() && now() - t < 1.0){
+    ssize_t w = write(port[0].fd, out.data() + outPos, out.size() - outPos);
+    if (w > 0){
+      outPos += w;
+      bytesOut += w;
+    }else
+      usleep(1000);
+  }
+  printStatistic(now() - begin, bytesOut);
+  fflush(stdout);
+  for (i = 0; i <= slaves; i++)
+    unlink(port[i].link.c_str());
+  sleep(LINGER_SECONDS);
+  return 0;
+}
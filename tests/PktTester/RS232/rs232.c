@@ -53,6 +53,23 @@ char comports[38][16]={"/dev/ttyS0","/dev/ttyS1","/dev/ttyS2","/dev/ttyS3","/dev
                        "/dev/cuau0","/dev/cuau1","/dev/cuau2","/dev/cuau3",
                        "/dev/cuaU0","/dev/cuaU1","/dev/cuaU2","/dev/cuaU3"};
 
+/* device paths set by RS232_SetComportName() (pseudo-terminals of PtyRelay) */
+const char *comport_names[38];
+
+
+int RS232_SetComportName(int comport_number, const char *name)
+{
+  if((comport_number>37)||(comport_number<0))
+  {
+    printf("illegal comport number\n");
+    return(1);
+  }
+
+  comport_names[comport_number] = name;
+
+  return(0);
+}
+
 int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
 {
   int baudr,
@@ -193,7 +210,8 @@ http://pubs.opengroup.org/onlinepubs/7908799/xsh/termios.h.html
 http://man7.org/linux/man-pages/man3/termios.3.html
 */
 
-  Cport[comport_number] = open(comports[comport_number], O_RDWR | O_NOCTTY | O_NDELAY);
+  Cport[comport_number] = open(comport_names[comport_number] ? comport_names[comport_number] : comports[comport_number],
+                               O_RDWR | O_NOCTTY | O_NDELAY);
   if(Cport[comport_number]==-1)
   {
     perror("unable to open comport ");
@@ -237,6 +255,10 @@ http://man7.org/linux/man-pages/man3/termios.3.html
 
   if(ioctl(Cport[comport_number], TIOCMGET, &status) == -1)
   {
+    if((errno == ENOTTY) || (errno == EINVAL))  /* pseudo-terminal has no modem lines */
+    {
+      return(0);
+    }
     perror("unable to get portstatus");
     return(1);
   }
@@ -260,15 +282,44 @@ int RS232_PollComport(int comport_number, unsigned char *buf, int size)
 
   n = read(Cport[comport_number], buf, size);
 
+  if((n < 0) && (errno == EAGAIN))  /* port is opened with O_NDELAY, nothing received */
+  {
+    return(0);
+  }
+
   return(n);
 }
 
 
+/* port is opened with O_NDELAY, waiting for space in output buffer like windows version */
+static int RS232_WriteAll(int comport_number, const unsigned char *buf, int size)
+{
+  int n, sent = 0;
+  fd_set wfds;
+
+  while(sent < size)
+  {
+    n = write(Cport[comport_number], buf + sent, size - sent);
+    if(n < 0)
+    {
+      if(errno != EAGAIN)  return(-1);
+      FD_ZERO(&wfds);
+      FD_SET(Cport[comport_number], &wfds);
+      select(Cport[comport_number] + 1, NULL, &wfds, NULL, NULL);
+      continue;
+    }
+    sent += n;
+  }
+
+  return(sent);
+}
+
+
 int RS232_SendByte(int comport_number, unsigned char byte)
 {
   int n;
 
-  n = write(Cport[comport_number], &byte, 1);
+  n = RS232_WriteAll(comport_number, &byte, 1);
   if(n<0)  return(1);
 
   return(0);
@@ -277,7 +328,7 @@ int RS232_SendByte(int comport_number, unsigned char byte)
 
 int RS232_SendBuf(int comport_number, unsigned char *buf, int size)
 {
-  return(write(Cport[comport_number], buf, size));
+  return(RS232_WriteAll(comport_number, buf, size));
 }
 
 
@@ -287,15 +338,20 @@ void RS232_CloseComport(int comport_number)
 
   if(ioctl(Cport[comport_number], TIOCMGET, &status) == -1)
   {
-    perror("unable to get portstatus");
+    if((errno != ENOTTY) && (errno != EINVAL))  /* pseudo-terminal has no modem lines */
+    {
+      perror("unable to get portstatus");
+    }
   }
-
-  status &= ~TIOCM_DTR;    /* turn off DTR */
-  status &= ~TIOCM_RTS;    /* turn off RTS */
-
-  if(ioctl(Cport[comport_number], TIOCMSET, &status) == -1)
+  else
   {
-    perror("unable to set portstatus");
+    status &= ~TIOCM_DTR;    /* turn off DTR */
+    status &= ~TIOCM_RTS;    /* turn off RTS */
+
+    if(ioctl(Cport[comport_number], TIOCMSET, &status) == -1)
+    {
+      perror("unable to set portstatus");
+    }
   }
 
   tcsetattr(Cport[comport_number], TCSANOW, old_port_settings + comport_number);
@@ -457,6 +513,23 @@ char comports[16][10]={"\\\\.\\COM1",  "\\\\.\\COM2",  "\\\\.\\COM3",  "\\\\.\\C
 
 char mode_str[128];
 
+/* device paths set by RS232_SetComportName() */
+const char *comport_names[16];
+
+
+int RS232_SetComportName(int comport_number, const char *name)
+{
+  if((comport_number>15)||(comport_number<0))
+  {
+    printf("illegal comport number\n");
+    return(1);
+  }
+
+  comport_names[comport_number] = name;
+
+  return(0);
+}
+
 
 int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
 {
@@ -559,7 +632,7 @@ http://msdn.microsoft.com/en-us/library/windows/desktop/aa363145%28v=vs.85%29.as
 http://technet.microsoft.com/en-us/library/cc732236.aspx
 */
 
-  Cport[comport_number] = CreateFileA(comports[comport_number],
+  Cport[comport_number] = CreateFileA(comport_names[comport_number] ? comport_names[comport_number] : comports[comport_number],
                       GENERIC_READ|GENERIC_WRITE,
                       0,                          /* no share  */
                       NULL,                       /* no security */
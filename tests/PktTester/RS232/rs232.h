@@ -52,12 +52,15 @@ extern "C" {
 #include <sys/stat.h>
 #include <limits.h>
 #include <sys/file.h>
+#include <sys/select.h>
+#include <errno.h>
 
 #else
 
 #include <windows.h>
 
 #endif
+int RS232_SetComportName(int, const char *);
 int RS232_OpenComport(int, int, const char *);
 int RS232_PollComport(int, unsigned char *, int);
 int RS232_SendByte(int, unsigned char);
@@ -0,0 +1,118 @@
+#!/bin/sh
+#brief       sweep of master UART baud rate by ConcentratorEmu -> PktReader on
+#            pseudo-terminal, looking for ceiling of PktReader throughput
+
+#version     initial
+#date        17.10.2026(dd.mm.yyyy)
+#note        example : ./flood_test.sh -t 5 -s 4 -B "115200 921600 0"
+#            ceiling is first rate where emulator is blocked by PktReader
+#            (achieved rate under 95 % of requested rate), with -O it is first
+#            rate where bytes are dropped (overrun) and valid rate is printed
+#            exit code 0 if runs without injected faults and without -O are
+#            received completely without errors
+#note        with -b master is sending binary records (BINARY_OUTPUT), valid rate
+#            is still in hexadecimal words, it is compared with valid rate without -b
+
+SECONDS_RUN=5
+SLAVES=4
+BAUDS="115200 460800 921600 2000000 4000000 0"
+EMU_OPT=""
+READER_OPT=""
+OVERRUN=0
+
+usage()
+{
+    echo "usage: $0 [-t seconds] [-s slaves] [-B \"baud list\"] [-O] [-b] [-f \"ConcentratorEmu options\"]"
+    echo "  -B  baud rates of master UART, 0 = not paced (default \"$BAUDS\")"
+    echo "  -O  UART overrun, ConcentratorEmu drops bytes if PktReader is slow"
+    echo "  -b  binary COBS records (ConcentratorEmu -B, PktReader -binary)"
+    echo "  -f  faults, for example \"-l 0.01 -w 0.001 -r 0.001 -e 0.001\""
+}
+
+while getopts "t:s:B:Obf:h" opt; do
+    case $opt in
+        t) SECONDS_RUN=$OPTARG ;;
+        s) SLAVES=$OPTARG ;;
+        B) BAUDS=$OPTARG ;;
+        O) OVERRUN=1; EMU_OPT="$EMU_OPT -O" ;;
+        b) EMU_OPT="$EMU_OPT -B"; READER_OPT="-binary" ;;
+        f) EMU_OPT="$EMU_OPT $OPTARG" ;;
+        *) usage; exit 2 ;;
+    esac
+done
+FAULTS=0
+case "$EMU_OPT" in
+    *-[lwre]*) FAULTS=1 ;;
+esac
+
+cd "$(dirname "$0")" || exit 2
+for tool in ConcentratorEmu PktReader; do
+    if [ ! -x ./$tool ]; then
+        echo "$tool is not compiled, run make PktReader ConcentratorEmu"
+        exit 2
+    fi
+done
+
+WORK=$(mktemp -d /tmp/flood_test.XXXXXX)
+LINK=$WORK/master
+RESULT=0
+CEILING=""
+WORD_LEN=55     # hexadecimal PRNGrandomPacket with STRING_TERMINATOR
+
+printf "%9s %10s %10s %9s %9s %8s %7s %10s\n" baud "req B/s" "emu B/s" words valid missing errors "valid B/s"
+for BAUD in $BAUDS; do
+    # PktReader is opening port during delay of emulator
+    ./ConcentratorEmu -s $SLAVES -b $BAUD -p $LINK -t $SECONDS_RUN -d 1 $EMU_OPT \
+        2> $WORK/emu$BAUD.txt &
+    EMU=$!
+    while [ ! -e $LINK ]; do
+        sleep 0.1
+    done
+    ./PktReader 1 -D $LINK -s $SLAVES -T $((SECONDS_RUN + 2)) -o $WORK/log$BAUD.txt $READER_OPT \
+        < /dev/null > $WORK/reader$BAUD.txt 2>&1
+    wait $EMU
+
+    # emu words N bytes N lost packets N words N skipped N reordered N corrupted N overrun N time X s rate N B/s requested N B/s
+    EMU_LINE=$(grep "^emu words" $WORK/emu$BAUD.txt)
+    # summary valid N missing N errors N ...
+    READER_LINE=$(grep "^summary" $WORK/reader$BAUD.txt)
+    WORDS=$(echo "$EMU_LINE" | awk '{print $3}')
+    TIME=$(echo "$EMU_LINE" | awk '{print $20}')
+    RATE=$(echo "$EMU_LINE" | awk '{print $23}')
+    REQUESTED=$(echo "$EMU_LINE" | awk '{print $26}')
+    DROPPED=$(echo "$EMU_LINE" | awk '{print $18}')
+    VALID=$(echo "$READER_LINE" | awk '{print $3}')
+    MISSING=$(echo "$READER_LINE" | awk '{print $5}')
+    ERRORS=$(echo "$READER_LINE" | awk '{print $7}')
+    VALID_RATE=$(awk -v v="${VALID:-0}" -v t="${TIME:-0}" -v l=$WORD_LEN 'BEGIN{printf "%.0f", (t > 0 ? v * l / t : 0)}')
+    printf "%9s %10s %10s %9s %9s %8s %7s %10s\n" $BAUD "$REQUESTED" "$RATE" "$WORDS" "$VALID" "$MISSING" "$ERRORS" "$VALID_RATE"
+
+    if [ -z "$CEILING" ]; then
+        if [ "$BAUD" = 0 ] || awk -v r="$RATE" -v q="$REQUESTED" 'BEGIN{exit !(r < 0.95 * q)}'; then
+            [ "$OVERRUN" = 0 ] && CEILING=$RATE
+        fi
+        if [ "$OVERRUN" = 1 ] && [ "${DROPPED:-0}" != 0 ]; then
+            CEILING=$VALID_RATE
+        fi
+    fi
+    if [ "$FAULTS" = 0 ] && [ "$OVERRUN" = 0 ]; then
+        if [ -z "$VALID" ] || [ "$VALID" != "$WORDS" ] || [ "$ERRORS" != 0 ]; then
+            echo "FAIL baud $BAUD valid $VALID of $WORDS words, errors $ERRORS"
+            RESULT=1
+        fi
+    fi
+    rm -f $LINK
+done
+
+if [ -n "$CEILING" ]; then
+    echo "ceiling of PktReader about $CEILING B/s"
+else
+    echo "ceiling of PktReader not reached"
+fi
+
+if [ $RESULT = 0 ]; then
+    rm -rf $WORK
+else
+    echo "outputs are kept in $WORK"
+fi
+exit $RESULT
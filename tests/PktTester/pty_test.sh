@@ -0,0 +1,134 @@
+#!/bin/sh
+#brief       end-to-end test of PktGenerator -> PtyRelay -> PktReader on
+#            pseudo-terminals, throughput and loss of codec and validator
+#            without boards
+
+#version     initial
+#date        17.10.2026(dd.mm.yyyy)
+#note        example : ./pty_test.sh -t 5 -s 4 -l 0.01
+#            exit code 0 if PktReader received valid packets without errors
+#            and missing packets are explained by drops of PtyRelay
+
+SECONDS_RUN=5
+SLAVES=4
+LOSS=0
+SLAVE_BAUD=9600
+MASTER_BAUD=115200
+COMPRESS=0
+DELAY=0
+LATENCY=0
+
+usage()
+{
+    echo "usage: $0 [-t seconds] [-s slaves] [-l loss] [-u slave baud] [-b master baud] [-d delay ms] [-c] [-L]"
+    echo "  -c  compressed stream (PktGenerator -c, PktReader -decompress, 1 slave)"
+    echo "  -L  latency of packets from PktGenerator to PktReader"
+}
+
+while getopts "t:s:l:u:b:d:cLh" opt; do
+    case $opt in
+        t) SECONDS_RUN=$OPTARG ;;
+        s) SLAVES=$OPTARG ;;
+        l) LOSS=$OPTARG ;;
+        u) SLAVE_BAUD=$OPTARG ;;
+        b) MASTER_BAUD=$OPTARG ;;
+        d) DELAY=$OPTARG ;;
+        c) COMPRESS=1 ;;
+        L) LATENCY=1 ;;
+        *) usage; exit 2 ;;
+    esac
+done
+
+cd "$(dirname "$0")" || exit 2
+for tool in PktGenerator PktReader PtyRelay; do
+    if [ ! -x ./$tool ]; then
+        echo "$tool is not compiled, run make all PtyRelay"
+        exit 2
+    fi
+done
+
+WORK=$(mktemp -d /tmp/pty_test.XXXXXX)
+PREFIX=$WORK/pty
+RELAY_OPT=""
+GEN_OPT=""
+READ_OPT=""
+if [ "$COMPRESS" = 1 ]; then
+    # binary word of hexaToBinaryCompression, see PktReader -decompress
+    SLAVES=1
+    RELAY_OPT="-f 28"
+    GEN_OPT="-c"
+    READ_OPT="-decompress"
+fi
+if [ "$LATENCY" = 1 ]; then
+    GEN_OPT="$GEN_OPT -L"
+    READ_OPT="$READ_OPT -L"
+fi
+if [ "$DELAY" != 0 ]; then
+    GEN_OPT="$GEN_OPT -d $DELAY"
+fi
+
+# relay is stopped first, PktReader is reading rest of data while relay is lingering
+./PtyRelay -s $SLAVES -p $PREFIX -u $SLAVE_BAUD -b $MASTER_BAUD -l $LOSS $RELAY_OPT \
+    > $WORK/relay.txt 2>&1 &
+RELAY=$!
+while [ ! -e ${PREFIX}$SLAVES ]; do
+    sleep 0.1
+done
+
+./PktReader 1 -D ${PREFIX}0 -s $SLAVES -T $((SECONDS_RUN + 1)) -o $WORK/log.txt $READ_OPT \
+    < /dev/null > $WORK/reader.txt 2>&1 &
+READER=$!
+sleep 0.5
+
+GENERATORS=""
+i=1
+while [ $i -le $SLAVES ]; do
+    ./PktGenerator 1 $i -D ${PREFIX}$i $GEN_OPT > $WORK/generator$i.txt 2>&1 &
+    GENERATORS="$GENERATORS $!"
+    i=$((i + 1))
+done
+
+sleep $SECONDS_RUN
+kill $RELAY
+wait $RELAY
+kill $GENERATORS 2>/dev/null
+wait $READER
+
+RELAY_LINE=$(grep "^relay words" $WORK/relay.txt)
+READER_LINE=$(grep "^summary" $WORK/reader.txt)
+cat $WORK/relay.txt | grep -v " -> "
+grep "^slave [0-9]" $WORK/reader.txt
+grep "^latency" $WORK/reader.txt
+echo "$READER_LINE"
+
+# relay words in N out N dropped N lost N ...
+DROPPED=$(echo "$RELAY_LINE" | awk '{print $8 + $10}')
+OUT=$(echo "$RELAY_LINE" | awk '{print $6}')
+# summary valid N missing N errors N ...
+VALID=$(echo "$READER_LINE" | awk '{print $3}')
+MISSING=$(echo "$READER_LINE" | awk '{print $5}')
+ERRORS=$(echo "$READER_LINE" | awk '{print $7}')
+
+RESULT=0
+if [ -z "$VALID" ] || [ "$VALID" = 0 ]; then
+    echo "FAIL no valid packets received"
+    RESULT=1
+elif [ "$ERRORS" != 0 ]; then
+    echo "FAIL $ERRORS packets with errors (see $WORK/log.txt)"
+    RESULT=1
+elif [ "$MISSING" -gt "$DROPPED" ]; then
+    echo "FAIL $MISSING packets missing, only $DROPPED dropped by relay"
+    RESULT=1
+elif [ "$VALID" != "$OUT" ]; then
+    echo "FAIL $VALID valid packets, $OUT forwarded by relay"
+    RESULT=1
+else
+    echo "PASS valid $VALID of $OUT forwarded, missing $MISSING of $DROPPED dropped"
+fi
+
+if [ $RESULT = 0 ]; then
+    rm -rf $WORK
+else
+    echo "outputs are kept in $WORK"
+fi
+exit $RESULT
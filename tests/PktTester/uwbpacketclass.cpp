@@ -10,8 +10,6 @@ uwbPacketTx::uwbPacketTx(int radarId) : endingChar('$'), rounder(100.0)
 
     packet = NULL;
     packetLength = 0;
-
-    crc_tab16_init = FALSE;
 }
 
 void uwbPacketTx::generatePacket(float *data, int data_count)
@@ -62,10 +60,8 @@ void uwbPacketTx::generatePacket(float *data, int data_count)
         }
     }
 
-    // calculate CRC
-    unsigned short crc = 0;
-    for(int k = 0; k<packetLength; k++)
-        crc = update_crc_16(crc, packet[k]);
+    // calculate CRC (P_16 0xA001, table of CrcLib.hpp is shared by all packets)
+    unsigned short crc = crcLibUwb::compute(packet, packetLength);
 
     std::bitset<16> b_crc(crc);
 
@@ -93,45 +89,6 @@ unsigned char uwbPacketTx::makeCorrection(unsigned char ch)
     return (unsigned char)(ascii);
 }
 
-unsigned short uwbPacketTx::update_crc_16( unsigned short crc, char c )
-{
-
-    unsigned short tmp, short_c;
-
-    short_c = 0x00ff & (unsigned short) c;
-
-    if ( ! crc_tab16_init ) this->init_crc16_tab();
-
-    tmp =  crc       ^ short_c;
-    crc = (crc >> 8) ^ crc_tab16[ tmp & 0xff ];
-
-    return crc;
-
-}
-
-void uwbPacketTx::init_crc16_tab()
-{
-        int i, j;
-        unsigned short crc, c;
-
-        for (i=0; i<256; i++) {
-
-            crc = 0;
-            c   = (unsigned short) i;
-
-            for (j=0; j<8; j++) {
-
-                if ( (crc ^ c) & 0x0001 ) crc = ( crc >> 1 ) ^ P_16;
-                else                      crc =   crc >> 1;
-
-                c = c >> 1;
-            }
-
-            crc_tab16[i] = crc;
-        }
-
-        crc_tab16_init = TRUE;
-}
 
 void uwbPacketTx::deleteLastPacket()
 {
@@ -251,42 +208,3 @@ int uwbPacketRx::removeCorrection(unsigned char ch)
     return ascii;
 }
 
-unsigned short uwbPacketRx::update_crc_16( unsigned short crc, char c )
-{
-
-    unsigned short tmp, short_c;
-
-    short_c = 0x00ff & (unsigned short) c;
-
-    if ( ! crc_tab16_init ) this->init_crc16_tab();
-
-    tmp =  crc       ^ short_c;
-    crc = (crc >> 8) ^ crc_tab16[ tmp & 0xff ];
-
-    return crc;
-
-}
-
-void uwbPacketRx::init_crc16_tab()
-{
-        int i, j;
-        unsigned short crc, c;
-
-        for (i=0; i<256; i++) {
-
-            crc = 0;
-            c   = (unsigned short) i;
-
-            for (j=0; j<8; j++) {
-
-                if ( (crc ^ c) & 0x0001 ) crc = ( crc >> 1 ) ^ P_16;
-                else                      crc =   crc >> 1;
-
-                c = c >> 1;
-            }
-
-            crc_tab16[i] = crc;
-        }
-
-        crc_tab16_init = TRUE;
-}
@@ -18,15 +18,12 @@
 #ifndef UWBPACKETCLASS_H
 #define UWBPACKETCLASS_H
 
-#define FALSE   0
-#define TRUE    1
-#define P_16    0xA001
-
 #include <bitset>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string>
 #include <iostream>
+#include "CrcLib.hpp"
 
 class uwbPacketTx
 {
@@ -39,13 +36,6 @@ private:
     void decrementPacketCount(void); ///< Decrement packet count and reset to 255 if value is less then zero
     unsigned char makeCorrection(unsigned char ch); ///< Takes char and modifies it to 0-F form. According to asci table there is unwanted range between characters A-F and digits 0-9
 
-
-    unsigned short update_crc_16( unsigned short crc, char c );
-    void init_crc16_tab(void);
-    unsigned short crc_tab16[256];
-    int crc_tab16_init;
-
-
     const unsigned char endingChar; ///< Ending char. Last character sent after one complete packet
     const float rounder; ///< Multiplier used for conversion float to int value.
 
@@ -74,11 +64,6 @@ private:
 
     int removeCorrection(unsigned char ch); ///< Takes char and modifies it into number representation which is the real number represented by obtained digit
 
-    unsigned short update_crc_16( unsigned short crc, char c );
-    void init_crc16_tab(void);
-    unsigned short crc_tab16[256];
-    int crc_tab16_init;
-
     unsigned char * buffer; ///< Original buffer used for holding lastly read values from link
     unsigned char * c_buffer; ///< Fake cyclic buffer for holding also old values. If packet is not completed in buffer, we can freely copy values here and buffer can be still overwritten
 
@@ -0,0 +1,807 @@
+/**
+ *****************************************************************************
+   @file     TdmaSim.cpp
+   @brief    discrete-event model of TDMA protocol between Master.c and Slave.c
+             used to predict capacity of installation before deployment
+
+   @version     initial version
+   @date        17.10.2026(DD.MM.YYYY)
+
+   @note    modelled protocol
+              - sendID() "Nslot" poll with RETRANSMISION repeats after timeout
+              - transmit() burst of all packets buffered by slave (or zero packet)
+              - ifMissPktGet() "NRE.." request and retransmission of missing packets
+              - synchronize() SYNC3, SYNC2, SYNC1 in SYNC_INTERVAL steps
+              - flushBufferedPackets() decompression and drain of packets on master UART
+              - UART_Int_Handler() of slave closing packets at STRING_TERMINATOR
+   @note    all frames share one channel, frame is lost if it is overlapped by
+            other frame, if receiver is transmitting or if loss model drop it
+   @note    defaults are taken from settings.h, sweep of NUMBER_OF_SLAVES,
+            MAX_LEN_OF_RX_PKT and data rate is set by command line
+   @see     read_me.txt
+**/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+#include "radioeng.h"
+#include "settings.h"
+#include "Airtime.h"
+
+#define MAX_SLAVES              10
+#define CHAR_OFFSET             '0'
+/** @brief lenght of "Nslot" packet (rf_printf sends also '\0') **/
+#define POLL_LEN                6
+/** @brief lenght of ZERO_PACKET "N00" **/
+#define ZERO_LEN                4
+/** @brief lenght of "SYNCn" packet **/
+#define SYNC_LEN                6
+/** @brief time from TX command to begining of preamble (synthesizer settling) **/
+#define TX_TURNAROUND           (AIRTIME_TX_TURNAROUND_US * 1e-6)
+/** @brief clock of timers @see setSynnicTimer() **/
+#define UCLK                    16e6
+
+/*******************************************************************************
+* parameters of model
+*/
+struct Config {
+  int     slaves;
+  int     wordLen;            /*!< @brief MAX_LEN_OF_RX_PKT, chars of one word with STRING_TERMINATOR */
+  int     radioCfg;           /*!< @brief RIE_BaseConfigs */
+  bool    manchester;
+  double  loss[MAX_SLAVES + 1];   /*!< @brief frame loss of link master <-> slave */
+  double  load;               /*!< @brief offered load as part of slave UART capacity */
+  double  pollTime;           /*!< @brief duration of one loop in radioRecieve() */
+  int     timeoutLoops;       /*!< @brief T_TIMEOUT, 0 = derived from data rate like settings.h */
+  double  syncPeriod;         /*!< @brief period of synchronize() directive, 0 = never */
+  double  duration;           /*!< @brief simulated time */
+  unsigned seed;
+};
+
+/** @brief result of one run **/
+struct SlaveResult {
+  uint64_t words, wordsDelivered, wordsDropped, wordsLost;
+  uint64_t bytes;             /*!< @brief delivered UART chars */
+  uint64_t polls, repolls, reRequests, packets, retx;
+  double   maxLatency, sumLatency;
+  double   maxRevisit;        /*!< @brief max time between two slots of slave */
+};
+
+struct Result {
+  SlaveResult slave[MAX_SLAVES + 1];
+  uint64_t slots, collisions, syncs;
+  double   uartBusy;
+  double   duration;
+};
+
+static double dataRate(int radioCfg)
+{
+  return airtimeDataRate((RIE_BaseConfigs)radioCfg);
+}
+
+/**
+   @brief  duration of variable length packet on air
+**/
+static double airtime(const Config& cfg, int len)
+{
+  return airtimeUs((RIE_BaseConfigs)cfg.radioCfg, cfg.manchester ? RIE_TRUE : RIE_FALSE, len) * 1e-6;
+}
+
+/*******************************************************************************
+* discrete-event kernel
+*/
+struct Event {
+  double   time;
+  uint64_t seq;
+  std::function<void()> action;
+  bool operator<(const Event& other) const {
+    return (time != other.time) ? time > other.time : seq > other.seq;
+  }
+};
+
+class Simulator {
+public:
+  double now = 0;
+  void at(double time, std::function<void()> action){
+    queue.push(Event{time, seq++, action});
+  }
+  void run(double until){
+    while (!queue.empty() && queue.top().time <= until){
+      Event ev = queue.top();
+      queue.pop();
+      now = ev.time;
+      ev.action();
+    }
+    now = until;
+  }
+private:
+  std::priority_queue<Event> queue;
+  uint64_t seq = 0;
+};
+
+/*******************************************************************************
+* model of protocol
+*/
+enum FrameKind { POLL, DATA, ZERO, RETX_REQ, SYNC };
+
+struct Word {
+  double arrival;             /*!< @brief time when STRING_TERMINATOR was received by slave */
+};
+
+struct Packet {
+  int len;                    /*!< @brief compressed lenght without head */
+  std::vector<Word> words;
+};
+
+struct Frame {
+  double start, end;
+  int    sender;              /*!< @brief 0 = master */
+  int    dest;
+  FrameKind kind;
+  int    len;
+  int    index;               /*!< @brief DATA: number of packet 0.., RETX_REQ: first of list */
+  int    total;               /*!< @brief DATA: number of packets in burst */
+  std::vector<int> list;      /*!< @brief RETX_REQ: requested packets */
+  Packet packet;              /*!< @brief DATA: content */
+};
+
+class Model {
+public:
+  Model(const Config& c) : cfg(c), rng(c.seed), uniform(0.0, 1.0) {
+    memset(&res, 0, sizeof(res));
+  }
+  Result run();
+
+private:
+  struct Node {
+    double txEnd = 0;         /*!< @brief end of last own transmission */
+    double rxArmed = 0;       /*!< @brief receiver is listening since */
+    bool   listening = true;
+  };
+  struct Slave : Node {
+    std::vector<Packet> rxMemory, txMemory;
+    Packet uartPkt;
+    int    uartCount = 0;
+    bool   closeFlag = false;
+    double lastPoll = -1;
+  };
+
+  const Config& cfg;
+  std::mt19937 rng;
+  std::uniform_real_distribution<double> uniform;
+  Simulator sim;
+  Result res;
+  std::vector<Frame> air;     /*!< @brief frames on air (for collisions) */
+  Node master;
+  Slave slave[MAX_SLAVES + 1];
+
+  // master state
+  enum { SLOT, RETX, IDLE } phase = IDLE;
+  int    slaveId = 1;
+  int    retransmision = 0;
+  bool   firstRxPkt = false;
+  int    numOfPkt = 0;
+  std::vector<bool>   got;
+  std::vector<Packet> rxPkts;
+  std::vector<int>    missing;
+  int    reReceived = 0;
+  uint64_t timeoutGen = 0;
+  double uartFree = 0;
+  double nextSync = 0;
+
+  // helpers
+  double uartCharTime(int baud) const { return 10.0 / baud; }
+  int    closeThreshold() const {
+#if COMPRESSION
+    return UART_BUFFER_DEEPTH - ((HEAD_LENGHT * 2) + cfg.wordLen);
+#else
+    return UART_BUFFER_DEEPTH - (HEAD_LENGHT + cfg.wordLen);
+#endif
+  }
+  int    wordBinaryLen() const {
+#if COMPRESSION
+    return 1 + (cfg.wordLen - 1) / 2;
+#else
+    return cfg.wordLen;
+#endif
+  }
+
+  void transmit(int sender, Frame f, std::function<void()> done);
+  void deliver(const Frame& f);
+  void receive(int node, const Frame& f);
+
+  void wordArrival(int s);
+  void slaveReceive(int s, const Frame& f);
+  void slaveBurst(int s, std::vector<int> list);
+
+  void slotStart();
+  void sendPoll();
+  void armTimeout();
+  void masterReceive(const Frame& f);
+  void masterTimeout(uint64_t gen);
+  void slotRxDone();
+  void sendRetxRequest();
+  void flush();
+  void nextSlot(double at);
+  void synchronize(int step);
+};
+
+/**
+   @brief  put frame on air, done is called at end of transmission
+**/
+void Model::transmit(int sender, Frame f, std::function<void()> done)
+{
+  Node& node = sender ? (Node&)slave[sender] : master;
+  f.sender = sender;
+  f.start = std::max(sim.now + TX_TURNAROUND, node.txEnd);
+  f.end = f.start + airtime(cfg, f.len);
+  node.txEnd = f.end;
+  node.listening = false;
+  air.push_back(f);
+  sim.at(f.end, [this, f, sender, done](){
+    Node& node = sender ? (Node&)slave[sender] : master;
+    deliver(f);
+    node.listening = true;
+    node.rxArmed = sim.now + TX_TURNAROUND;
+    done();
+  });
+}
+
+/**
+   @brief  end of frame, decide which node received it
+**/
+void Model::deliver(const Frame& f)
+{
+  bool collided = false;
+  double preamble = airtimePreambleUs((RIE_BaseConfigs)cfg.radioCfg) * 1e-6;
+
+  for (const Frame& other : air)
+    if (&other != &f && other.sender != f.sender && other.start < f.end && other.end > f.start)
+      collided = true;
+  if (collided)
+    res.collisions++;
+
+  // forget old frames
+  while (!air.empty() && air.front().end < sim.now - 1.0)
+    air.erase(air.begin());
+
+  for (int n = 0; n <= cfg.slaves; n++){
+    Node& node = n ? (Node&)slave[n] : master;
+    int link = n ? n : f.sender;
+    if (n == f.sender || collided || !node.listening)
+      continue;
+    if (node.rxArmed > f.start + preamble / 2 || node.txEnd > f.start)
+      continue;
+    if (uniform(rng) < cfg.loss[link])
+      continue;
+    receive(n, f);
+  }
+}
+
+void Model::receive(int node, const Frame& f)
+{
+  if (node == 0)
+    masterReceive(f);
+  else
+    slaveReceive(node, f);
+}
+
+/*******************************************************************************
+* slave
+*/
+
+/**
+   @brief  one word (hexadecimal chars + STRING_TERMINATOR) received on UART
+   @see    UART_Int_Handler() of Slave.c
+**/
+void Model::wordArrival(int s)
+{
+  Slave& sl = slave[s];
+  double period = cfg.wordLen * uartCharTime(UART_BAUD_RATE_SLAVE) / cfg.load;
+
+  res.slave[s].words++;
+#if COMPRESSION
+  if (cfg.wordLen > UART_BUFFER_DEEPTH || (cfg.wordLen - 1) % 2){  // overflow or odd word is dropped
+#else
+  if (cfg.wordLen > UART_BUFFER_DEEPTH){
+#endif
+    res.slave[s].wordsDropped++;
+  }
+  else {
+    sl.uartPkt.words.push_back(Word{sim.now});
+    sl.uartPkt.len += wordBinaryLen();
+    sl.uartCount += cfg.wordLen;
+    if (sl.uartCount >= closeThreshold() || sl.closeFlag){
+      if (sl.rxMemory.size() < NUM_OF_PACKETS_IN_MEMORY && sl.uartPkt.len + HEAD_LENGHT <= PACKETRAM_LEN)
+        sl.rxMemory.push_back(sl.uartPkt);
+      else
+        res.slave[s].wordsDropped += sl.uartPkt.words.size();
+      sl.uartPkt = Packet();
+      sl.uartCount = 0;
+      sl.closeFlag = false;
+    }
+  }
+  sim.at(sim.now + period, [this, s](){ wordArrival(s); });
+}
+
+/**
+   @brief  packet received by slave @see main() of Slave.c
+**/
+void Model::slaveReceive(int s, const Frame& f)
+{
+  Slave& sl = slave[s];
+
+  if (f.dest != s)
+    return;
+  if (f.kind == POLL){
+    sl.closeFlag = true;
+    // transmit() rotate memory, not delivered packets are lost
+    sl.txMemory = sl.rxMemory;
+    sl.rxMemory.clear();
+    if (sl.txMemory.empty()){
+      Frame z;
+      z.dest = 0; z.kind = ZERO; z.len = ZERO_LEN; z.index = 0; z.total = 0;
+      transmit(s, z, [](){});
+      return;
+    }
+    std::vector<int> list;
+    for (size_t i = 0; i < sl.txMemory.size(); i++)
+      list.push_back(i);
+    slaveBurst(s, list);
+  }
+  else if (f.kind == RETX_REQ)
+    slaveBurst(s, f.list);
+}
+
+/**
+   @brief  transmit packets back to back @see transmit(), retransmit()
+**/
+void Model::slaveBurst(int s, std::vector<int> list)
+{
+  Slave& sl = slave[s];
+  if (list.empty())
+    return;
+  int i = list.front();
+  list.erase(list.begin());
+  if (i >= (int)sl.txMemory.size())
+    return;
+  Frame d;
+  d.dest = 0; d.kind = DATA; d.index = i; d.total = sl.txMemory.size();
+  d.len = sl.txMemory[i].len + HEAD_LENGHT;
+  d.packet = sl.txMemory[i];
+  transmit(s, d, [this, s, list](){ slaveBurst(s, list); });
+}
+
+/*******************************************************************************
+* master
+*/
+
+/**
+   @brief  begining of new time slot @see receivePackets(), sendID()
+**/
+void Model::slotStart()
+{
+  SlaveResult& r = res.slave[slaveId];
+
+  if (cfg.syncPeriod > 0 && sim.now >= nextSync){
+    nextSync += cfg.syncPeriod;
+    synchronize(0);
+    return;
+  }
+  if (slave[slaveId].lastPoll >= 0 && sim.now - slave[slaveId].lastPoll > r.maxRevisit)
+    r.maxRevisit = sim.now - slave[slaveId].lastPoll;
+  slave[slaveId].lastPoll = sim.now;
+
+  res.slots++;
+  phase = SLOT;
+  retransmision = 0;
+  firstRxPkt = false;
+  numOfPkt = 0;
+  got.clear();
+  rxPkts.clear();
+  r.polls++;
+  sendPoll();
+}
+
+void Model::sendPoll()
+{
+  Frame p;
+  p.dest = slaveId; p.kind = POLL; p.len = POLL_LEN; p.index = 0; p.total = 0;
+  timeoutGen++;
+  transmit(0, p, [this](){ armTimeout(); });
+}
+
+/**
+   @brief  radioRecieve() is waiting T_TIMEOUT loops for packet
+**/
+void Model::armTimeout()
+{
+  uint64_t gen = ++timeoutGen;
+  sim.at(sim.now + cfg.timeoutLoops * cfg.pollTime, [this, gen](){ masterTimeout(gen); });
+}
+
+void Model::masterReceive(const Frame& f)
+{
+  if (f.sender != slaveId || (phase != SLOT && phase != RETX))
+    return;
+  if (f.kind == ZERO){
+    if (phase == SLOT){
+      timeoutGen++;
+      nextSlot(sim.now);
+    }
+    return;
+  }
+  if (f.kind != DATA)
+    return;
+
+  if (!firstRxPkt){             // validPacket() take number of packets from first one
+    firstRxPkt = true;
+    numOfPkt = f.total;
+    got.assign(numOfPkt, false);
+    rxPkts.assign(numOfPkt, Packet());
+  }
+  if (f.index < numOfPkt && !got[f.index]){
+    got[f.index] = true;
+    rxPkts[f.index] = f.packet;
+  }
+  res.slave[slaveId].packets++;
+
+  if (phase == SLOT){
+    if (f.index + 1 >= numOfPkt){     // actualPacket >= numOfPkt
+      timeoutGen++;
+      slotRxDone();
+    }
+    else
+      armTimeout();
+  }
+  else {
+    res.slave[slaveId].retx++;
+    if (++reReceived >= (int)missing.size()){
+      timeoutGen++;
+      flush();
+    }
+    else
+      armTimeout();
+  }
+}
+
+void Model::masterTimeout(uint64_t gen)
+{
+  if (gen != timeoutGen)
+    return;
+  if (phase == SLOT){
+    if (!firstRxPkt){
+      if (retransmision < RETRANSMISION){
+        retransmision++;
+        res.slave[slaveId].repolls++;
+        sendPoll();
+      }
+      else
+        nextSlot(sim.now);
+    }
+    else
+      slotRxDone();
+  }
+  else if (phase == RETX){
+    // @note ifMissPktGet() never increment retransmision, model limit it
+    if (retransmision < RETRANSMISION - 1){
+      retransmision++;
+      sendRetxRequest();
+    }
+    else
+      flush();
+  }
+}
+
+/**
+   @brief  all packets of burst received or timeout @see ifMissPktGet()
+**/
+void Model::slotRxDone()
+{
+  missing.clear();
+  for (int i = 0; i < numOfPkt; i++)
+    if (!got[i])
+      missing.push_back(i);
+  if (missing.empty()){
+    flush();
+    return;
+  }
+  phase = RETX;
+  retransmision = 0;
+  sendRetxRequest();
+}
+
+void Model::sendRetxRequest()
+{
+  Frame r;
+  r.dest = slaveId; r.kind = RETX_REQ; r.len = missing.size() + 4;
+  r.index = 0; r.total = 0; r.list = missing;
+  reReceived = 0;
+  res.slave[slaveId].reRequests++;
+  timeoutGen++;
+  transmit(0, r, [this](){ armTimeout(); });
+}
+
+/**
+   @brief  send received packets on UART @see flushBufferedPackets(), slowFlush()
+**/
+void Model::flush()
+{
+  SlaveResult& r = res.slave[slaveId];
+  double charTime = uartCharTime(UART_BAUD_RATE_MASTER);
+  double start = std::max(sim.now, uartFree);
+  double lastStart = sim.now;
+
+  phase = IDLE;
+  for (int i = 0; i < numOfPkt; i++){
+    int chars;
+    if (!got[i])
+      continue;
+    chars = rxPkts[i].words.size() * cfg.wordLen;
+    lastStart = start;
+    start += chars * charTime;
+    for (const Word& w : rxPkts[i].words){
+      double latency = start - w.arrival;
+      r.wordsDelivered++;
+      r.sumLatency += latency;
+      if (latency > r.maxLatency)
+        r.maxLatency = latency;
+    }
+    r.bytes += chars;
+    res.uartBusy += chars * charTime;
+  }
+  uartFree = start;
+#if SLOW_FLUSH
+  nextSlot(lastStart);          // main loop waits for dmaTx_flag before last packet
+#else
+  nextSlot(sim.now);
+#endif
+}
+
+/**
+   @brief  next slave in round robin @see initializeNewSlot()
+**/
+void Model::nextSlot(double at)
+{
+  phase = IDLE;
+  slaveId++;
+  if (slaveId > cfg.slaves)
+    slaveId = 1;
+  sim.at(std::max(at, sim.now), [this](){ slotStart(); });
+}
+
+/**
+   @brief  synchronize() SYNC3, SYNC2, SYNC1 after timer interrupts
+**/
+void Model::synchronize(int step)
+{
+  double interval = SYNC_INTERVAL * 256.0 / UCLK;
+
+  if (step == 0)
+    res.syncs++;
+  if (step == 3){
+    sim.at(sim.now + interval, [this](){ slotStart(); });
+    return;
+  }
+  sim.at(sim.now + interval, [this, step](){
+    Frame s;
+    s.dest = -1; s.kind = SYNC; s.len = SYNC_LEN; s.index = 0; s.total = 0;
+    transmit(0, s, [this, step](){ synchronize(step + 1); });
+  });
+}
+
+Result Model::run()
+{
+  std::uniform_real_distribution<double> phaseDist(0.0, 1.0);
+  double period = cfg.wordLen * uartCharTime(UART_BAUD_RATE_SLAVE) / cfg.load;
+
+  for (int s = 1; s <= cfg.slaves; s++)
+    sim.at(phaseDist(rng) * period, [this, s](){ wordArrival(s); });
+  nextSync = cfg.syncPeriod;
+  sim.at(0, [this](){ slotStart(); });
+  sim.run(cfg.duration);
+  res.duration = cfg.duration;
+
+  // words not delivered and still not waiting in slave memory are lost
+  for (int s = 1; s <= cfg.slaves; s++){
+    SlaveResult& r = res.slave[s];
+    uint64_t pending = slave[s].uartPkt.words.size();
+    for (const Packet& p : slave[s].rxMemory)
+      pending += p.words.size();
+    if (s == slaveId && phase != IDLE)
+      for (const Packet& p : slave[s].txMemory)
+        pending += p.words.size();
+    r.wordsLost = r.words - r.wordsDelivered - r.wordsDropped - std::min(pending, r.words - r.wordsDelivered - r.wordsDropped);
+  }
+  return res;
+}
+
+/*******************************************************************************
+* command line
+*/
+static std::vector<int> parseList(const char* arg)
+{
+  std::vector<int> list;
+  char* end;
+  while (*arg){
+    list.push_back(strtol(arg, &end, 10));
+    if (*end != ',')
+      break;
+    arg = end + 1;
+  }
+  return list;
+}
+
+static void shortHelp(void)
+{
+  printf("\nfor more information use 'TdmaSim -h'\n");
+}
+
+static void printHeader(bool csv)
+{
+  if (csv)
+    printf("rate,slaves,wordLen,goodput,minSlaveGoodput,wordLoss,maxLatency,avgLatency,maxRevisit,uartBusy,drainMargin,collisions\n");
+  else
+    printf("%7s %6s %7s %10s %10s %8s %10s %10s %10s %8s %8s %6s\n",
+           "rate", "slaves", "wordLen", "goodput", "minSlave", "loss", "maxLat", "avgLat",
+           "maxRevisit", "uart", "margin", "coll");
+}
+
+static void printResult(const Config& cfg, const Result& res, bool csv, bool verbose)
+{
+  uint64_t words = 0, lost = 0, delivered = 0, bytes = 0;
+  double minGoodput = -1, maxLatency = 0, sumLatency = 0, maxRevisit = 0;
+  double uartBusy = res.uartBusy / res.duration;
+  int s;
+
+  for (s = 1; s <= cfg.slaves; s++){
+    const SlaveResult& r = res.slave[s];
+    double goodput = r.bytes / res.duration;
+    words += r.words;
+    lost += r.wordsLost + r.wordsDropped;
+    delivered += r.wordsDelivered;
+    bytes += r.bytes;
+    sumLatency += r.sumLatency;
+    if (minGoodput < 0 || goodput < minGoodput)
+      minGoodput = goodput;
+    if (r.maxLatency > maxLatency)
+      maxLatency = r.maxLatency;
+    if (r.maxRevisit > maxRevisit)
+      maxRevisit = r.maxRevisit;
+  }
+
+  double loss = words ? (double)lost / words * 100.0 : 0;
+  double avgLatency = delivered ? sumLatency / delivered : 0;
+  if (csv)
+    printf("%.0f,%d,%d,%.1f,%.1f,%.2f,%.4f,%.4f,%.4f,%.2f,%.2f,%llu\n",
+           dataRate(cfg.radioCfg), cfg.slaves, cfg.wordLen, bytes / res.duration, minGoodput,
+           loss, maxLatency, avgLatency, maxRevisit, uartBusy * 100.0, (1.0 - uartBusy) * 100.0,
+           (unsigned long long)res.collisions);
+  else
+    printf("%7.0f %6d %7d %8.1f/s %8.1f/s %7.2f%% %9.4fs %9.4fs %9.4fs %7.2f%% %7.2f%% %6llu\n",
+           dataRate(cfg.radioCfg), cfg.slaves, cfg.wordLen, bytes / res.duration, minGoodput,
+           loss, maxLatency, avgLatency, maxRevisit, uartBusy * 100.0, (1.0 - uartBusy) * 100.0,
+           (unsigned long long)res.collisions);
+
+  if (verbose && !csv){
+    printf("   slave   words  delivered  dropped  lost   polls repolls  reReq  packets  retx  goodput   maxLat\n");
+    for (s = 1; s <= cfg.slaves; s++){
+      const SlaveResult& r = res.slave[s];
+      printf("   %5d %7llu %10llu %8llu %5llu %7llu %7llu %6llu %8llu %5llu %6.1f/s %7.4fs\n", s,
+             (unsigned long long)r.words, (unsigned long long)r.wordsDelivered,
+             (unsigned long long)r.wordsDropped, (unsigned long long)r.wordsLost,
+             (unsigned long long)r.polls, (unsigned long long)r.repolls,
+             (unsigned long long)r.reRequests, (unsigned long long)r.packets,
+             (unsigned long long)r.retx, r.bytes / res.duration, r.maxLatency);
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Config cfg;
+  std::vector<int> slavesList = {NUMBER_OF_SLAVES};
+  std::vector<int> wordList = {MAX_LEN_OF_RX_PKT};
+  std::vector<int> rateList = {RADIO_CFG};
+  bool csv = false, verbose = false;
+  char *ptr;
+  int i, s;
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.manchester = RADIO_MANCHASTER;
+  cfg.load = 1.0;
+  cfg.pollTime = RX_LOOP_NS * 1e-9;
+  cfg.duration = 60;
+  cfg.seed = 500;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)       // -s list of NUMBER_OF_SLAVES
+      slavesList = parseList(argv[++i]);
+    else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)  // -w list of MAX_LEN_OF_RX_PKT
+      wordList = parseList(argv[++i]);
+    else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)  // -r list of RIE_BaseConfigs
+      rateList = parseList(argv[++i]);
+    else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc){ // -l loss of all links
+      double l = strtod(argv[++i], &ptr);
+      for (s = 0; s <= MAX_SLAVES; s++)
+        cfg.loss[s] = l;
+    }
+    else if (strcmp(argv[i], "-L") == 0 && i + 1 < argc){ // -L loss per link p1,p2,..
+      ptr = argv[++i];
+      for (s = 1; s <= MAX_SLAVES && *ptr; s++){
+        cfg.loss[s] = strtod(ptr, &ptr);
+        if (*ptr == ',')
+          ptr++;
+      }
+    }
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)  // -o offered load
+      cfg.load = strtod(argv[++i], &ptr);
+    else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)  // -p time of one loop in radioRecieve()
+      cfg.pollTime = strtod(argv[++i], &ptr) * 1e-9;
+    else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)  // -e fixed T_TIMEOUT
+      cfg.timeoutLoops = strtol(argv[++i], &ptr, 10);
+    else if (strcmp(argv[i], "-y") == 0 && i + 1 < argc)  // -y period of synchronization
+      cfg.syncPeriod = strtod(argv[++i], &ptr);
+    else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)  // -t simulated time
+      cfg.duration = strtod(argv[++i], &ptr);
+    else if (strcmp(argv[i], "-m") == 0)                  // -m Manchester encoding
+      cfg.manchester = true;
+    else if (strcmp(argv[i], "-seed") == 0 && i + 1 < argc)
+      cfg.seed = strtol(argv[++i], &ptr, 10);
+    else if (strcmp(argv[i], "-c") == 0)
+      csv = true;
+    else if (strcmp(argv[i], "-v") == 0)
+      verbose = true;
+    else if (strcmp(argv[i], "-h") == 0){
+      printf("\nTdmaSim is discrete-event model of TDMA protocol of Master.c and Slave.c\n");
+      printf("defaults are taken from settings.h\n");
+      printf("usage: 'TdmaSim [-s, -w, -r, -l, -L, -o, -p, -e, -y, -t, -m, -c, -v, -h]'\n");
+      printf("example: 'TdmaSim -s 1,2,4,6,8,10 -w 17,33,65 -r 1,2 -l 0.01'\n");
+      printf("parameters: -s list of NUMBER_OF_SLAVES [%d]\n", NUMBER_OF_SLAVES);
+      printf("            -w list of MAX_LEN_OF_RX_PKT, chars of word with '%c' [%d]\n", STRING_TERMINATOR, MAX_LEN_OF_RX_PKT);
+      printf("            -r list of RIE_BaseConfigs 0 = 1 kbps, 1 = 38.4 kbps, 2 = 300 kbps [%d]\n", RADIO_CFG);
+      printf("            -l frame loss of all links [0]\n");
+      printf("            -L frame loss per link 'p1,p2,..' of slave 1,2,..\n");
+      printf("            -o offered load, part of slave UART capacity %d baud [1.0]\n", UART_BAUD_RATE_SLAVE);
+      printf("            -p ns of one loop in radioRecieve(), timeout = T_TIMEOUT * p [RX_LOOP_NS %d]\n", RX_LOOP_NS);
+      printf("            -e fixed T_TIMEOUT loops [derived from data rate like settings.h]\n");
+      printf("            -y period of synchronize() in s [0 = never]\n");
+      printf("            -t simulated time in s [60]\n");
+      printf("            -m Manchester encoding [RADIO_MANCHASTER]\n");
+      printf("            -seed seed of loss model [500]\n");
+      printf("            -c csv output\n");
+      printf("            -v output per slave\n");
+      printf("            -h help\n\n");
+      return 0;
+    }
+    else {
+      printf("Invalid option %s", argv[i]);
+      shortHelp();
+      return 2;
+    }
+  }
+
+  printHeader(csv);
+  for (int rate : rateList)
+    for (int slaves : slavesList)
+      for (int wordLen : wordList){
+        if (slaves < 1 || slaves > MAX_SLAVES || wordLen < 2 || dataRate(rate) == 0){
+          printf("Invalid combination rate %d slaves %d wordLen %d\n", rate, slaves, wordLen);
+          continue;
+        }
+        Config run = cfg;
+        run.radioCfg = rate;
+        run.slaves = slaves;
+        run.wordLen = wordLen;
+        if (run.timeoutLoops <= 0)
+          run.timeoutLoops = RX_TIMEOUT_LOOPS((RIE_BaseConfigs)rate, run.manchester ? RIE_TRUE : RIE_FALSE);
+        Model model(run);
+        Result res = model.run();
+        printResult(run, res, csv, verbose);
+      }
+  return 0;
+}